@@ -25,6 +25,10 @@
 #include "AppDelegate.h"
 #include "GameScene.h"
 #include "managers/ConfigManager.h"
+#include "managers/FrameRateGovernor.h"
+#include "managers/TweenManager.h"
+#include "managers/TexturePreloader.h"
+#include "views/CardFaceCache.h"
 
 // #define USE_AUDIO_ENGINE 1
 // #define USE_SIMPLE_AUDIO_ENGINE 1
@@ -60,7 +64,11 @@ AppDelegate::~AppDelegate()
     SimpleAudioEngine::end();
 #endif
 
-    // 清理配置管理器
+    // 清理帧率调节器、补间、纹理预加载、牌面缓存与配置管理器
+    FrameRateGovernor::destroyInstance();
+    TweenManager::destroyInstance();
+    TexturePreloader::destroyInstance();
+    CardFaceCache::destroyInstance();
     ConfigManager::destroyInstance();
 }
 
@@ -98,6 +106,11 @@ bool AppDelegate::applicationDidFinishLaunching() {
         CCLOG("AppDelegate::applicationDidFinishLaunching - Failed to load configs, using defaults");
     }
 
+#if COCOS2D_DEBUG > 0 && ((CC_TARGET_PLATFORM == CC_PLATFORM_WIN32) || (CC_TARGET_PLATFORM == CC_PLATFORM_MAC) || (CC_TARGET_PLATFORM == CC_PLATFORM_LINUX))
+    // 开发时监视配置文件，修改后增量热重载
+    configManager->startHotReload();
+#endif
+
     // 使用显示配置创建窗口
     auto displayConfig = configManager->getDisplayConfig();
     if(!glview) {
@@ -117,8 +130,8 @@ bool AppDelegate::applicationDidFinishLaunching() {
     // turn off display FPS and stats
     director->setDisplayStats(false);
 
-    // set FPS. the default value is 1.0/60 if you don't call this
-    director->setAnimationInterval(1.0f / 60);
+    // 按显示配置设置帧率，棋盘静止时降到空闲帧率，输入或动画时恢复
+    FrameRateGovernor::getInstance()->start();
 
     // Set the design resolution using config
     auto designSize = displayConfig->getDesignResolutionSize();
@@ -142,6 +155,8 @@ bool AppDelegate::applicationDidFinishLaunching() {
 
     register_all_packages();
 
+    // 牌面在关卡选择界面异步预加载卡牌图片后合成（见GameScene::startTexturePreload）
+
     // create a scene. it's an autorelease object
     auto scene = GameScene::createScene();
 
@@ -166,6 +181,7 @@ void AppDelegate::applicationDidEnterBackground() {
 // this function will be called when the app is active again
 void AppDelegate::applicationWillEnterForeground() {
     Director::getInstance()->startAnimation();
+    FrameRateGovernor::getInstance()->wake();
 
 #if USE_AUDIO_ENGINE
     AudioEngine::resumeAll();
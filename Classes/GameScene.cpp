@@ -28,10 +28,20 @@
 #include "views/CardView.h"
 #include "configs/loaders/LevelConfigLoader.h"
 #include "views/GameView.h"
+#include "views/LevelSelectListView.h"
 #include "controllers/GameController.h"
+#include "managers/ConfigManager.h"
+#include "managers/TexturePreloader.h"
+#include "views/CardFaceCache.h"
+#include "utils/CardAtlas.h"
 
 USING_NS_CC;
 
+// 预加载进度条尺寸与颜色
+static const Size kPreloadBarSize(600.0f, 24.0f);
+static const Color4F kPreloadBarBackground(1.0f, 1.0f, 1.0f, 0.25f);
+static const Color4F kPreloadBarFill(1.0f, 1.0f, 1.0f, 0.90f);
+
 Scene* GameScene::createScene()
 {
     return GameScene::create();
@@ -95,10 +105,93 @@ bool GameScene::init()
     // 初始化关卡选择UI（选择后再创建与加载游戏）
     initLevelSelectUI();
     initBackButtonUI();
+    initLevelPrefetchListeners();
+
+    // 在关卡选择界面预加载卡牌图片，进入关卡后不再在主线程解码
+    startTexturePreload();
 
     return true;
 }
 
+void GameScene::onExit() {
+    // 预加载回调引用本场景
+    if (_isPreloading) {
+        TexturePreloader::getInstance()->cancel();
+        _isPreloading = false;
+    }
+    Scene::onExit();
+}
+
+void GameScene::startTexturePreload() {
+    auto visibleSize = Director::getInstance()->getVisibleSize();
+    Vec2 origin = Director::getInstance()->getVisibleOrigin();
+
+    // 图集存在时只需加载图集纹理，否则加载各张散图
+    std::vector<std::string> imagePaths;
+    std::vector<std::string> texturePaths;
+    CardFaceCache::getSourceImagePaths(imagePaths);
+    CardAtlas::getTexturePaths(imagePaths, texturePaths);
+
+    // 进度文字与进度条放在关卡列表下方
+    _preloadLabel = Label::createWithTTF("", "fonts/Marker Felt.ttf", 36);
+    _preloadLabel->setPosition(origin.x + visibleSize.width * 0.5f, origin.y + 120.0f);
+    this->addChild(_preloadLabel, 21);
+
+    _preloadBar = DrawNode::create();
+    _preloadBar->setPosition(origin.x + (visibleSize.width - kPreloadBarSize.width) * 0.5f, origin.y + 70.0f);
+    this->addChild(_preloadBar, 21);
+
+    _isPreloading = true;
+    updatePreloadProgress(0, texturePaths.size());
+
+    // 全部已在缓存中时在本调用内完成
+    TexturePreloader::getInstance()->preload(texturePaths,
+        [this](size_t loadedCount, size_t totalCount) {
+            this->updatePreloadProgress(loadedCount, totalCount);
+        },
+        [this](size_t failedCount) {
+            this->onTexturePreloadComplete(failedCount);
+        });
+}
+
+void GameScene::updatePreloadProgress(size_t loadedCount, size_t totalCount) {
+    if (!_preloadLabel || !_preloadBar) {
+        return;
+    }
+
+    float progress = totalCount > 0 ? static_cast<float>(loadedCount) / totalCount : 1.0f;
+    _preloadLabel->setString(StringUtils::format("Loading cards %d%%", static_cast<int>(progress * 100)));
+
+    _preloadBar->clear();
+    _preloadBar->drawSolidRect(Vec2::ZERO, Vec2(kPreloadBarSize.width, kPreloadBarSize.height), kPreloadBarBackground);
+    _preloadBar->drawSolidRect(Vec2::ZERO, Vec2(kPreloadBarSize.width * progress, kPreloadBarSize.height), kPreloadBarFill);
+}
+
+void GameScene::onTexturePreloadComplete(size_t failedCount) {
+    if (failedCount > 0) {
+        CCLOG("GameScene::onTexturePreloadComplete - %zu card textures failed to load", failedCount);
+    }
+
+    // 图片均已在纹理缓存中，合成牌面只在GPU上绘制
+    CardFaceCache::getInstance()->build();
+    _isPreloading = false;
+
+    if (_preloadLabel) {
+        _preloadLabel->removeFromParent();
+        _preloadLabel = nullptr;
+    }
+    if (_preloadBar) {
+        _preloadBar->removeFromParent();
+        _preloadBar = nullptr;
+    }
+
+    if (_pendingLevelId > 0) {
+        int levelId = _pendingLevelId;
+        _pendingLevelId = 0;
+        startLevel(levelId);
+    }
+}
+
 void GameScene::testConfigSystem() {
     CCLOG("=== Testing Config System ===");
 
@@ -188,34 +281,9 @@ void GameScene::initLevelSelectUI() {
         _levelSelectBg->setVisible(true);
     }
 
-    // 列出关卡目录中的所有关卡文件
-    std::string levelsDir = "configs/data/levels/";
-    std::vector<std::string> files = FileUtils::getInstance()->listFiles(levelsDir);
-
-    std::vector<int> levelIds;
-    levelIds.reserve(files.size());
-
-    auto extractLevelId = [](const std::string& filename) -> int {
-        // 期望格式: level_<id>.json
-        size_t slash = filename.find_last_of("/");
-        std::string name = (slash == std::string::npos) ? filename : filename.substr(slash + 1);
-        if (name.size() < 12) return -1; // 最小长度粗略检查
-        const std::string kPrefix = "level_";
-        const std::string kSuffix = ".json";
-        if (name.rfind(kPrefix, 0) != 0) return -1; // 必须以 level_ 开头
-        if (name.size() <= kPrefix.size() + kSuffix.size()) return -1;
-        if (name.substr(name.size() - kSuffix.size()) != kSuffix) return -1;
-        std::string idPart = name.substr(kPrefix.size(), name.size() - kPrefix.size() - kSuffix.size());
-        for (char c : idPart) { if (c < '0' || c > '9') return -1; }
-        return idPart.empty() ? -1 : atoi(idPart.c_str());
-    };
-
-    for (const auto& path : files) {
-        // 过滤目录，仅保留文件
-        if (FileUtils::getInstance()->isDirectoryExist(path)) continue;
-        int id = extractLevelId(path);
-        if (id > 0) levelIds.push_back(id);
-    }
+    // 列出关卡目录中的所有关卡（优先使用关卡包索引）
+    std::string levelsDir = LevelConfigLoader::kDefaultLevelDirectory;
+    std::vector<int> levelIds = ConfigManager::getInstance()->getLevelConfigLoader()->enumerateLevelIds(levelsDir);
 
     if (levelIds.empty()) {
         CCLOG("initLevelSelectUI - No level files found in %s", levelsDir.c_str());
@@ -223,83 +291,37 @@ void GameScene::initLevelSelectUI() {
         levelIds.push_back(1);
     }
 
-    std::sort(levelIds.begin(), levelIds.end());
-    levelIds.erase(std::unique(levelIds.begin(), levelIds.end()), levelIds.end());
-
-    // 创建菜单项，按列排列（居中，竖向）
-    std::vector<MenuItem*> items;
-    items.reserve(levelIds.size());
-
-    const float kFontSize = 48.0f;
-    const float kGapY = 150.0f; // 拉开间距
-    const float kCenterX = origin.x + visibleSize.width * 0.5f;
-    const float kTotalHeight = (levelIds.empty() ? 0.0f : (static_cast<float>(levelIds.size() - 1) * kGapY));
-    const float kStartY = origin.y + visibleSize.height * 0.5f + kTotalHeight * 0.5f + 20.0f; // 略微上移
-
-    for (size_t i = 0; i < levelIds.size(); ++i) {
-        int levelId = levelIds[i];
-        auto label = Label::createWithTTF(StringUtils::format("Level %d", levelId), "fonts/Marker Felt.ttf", kFontSize);
-        label->setColor(Color3B::WHITE);
-
-        // 计算按钮尺寸（根据文字大小添加内边距）
-        const Size textSize = label->getContentSize();
-        const float paddingX = 28.0f;
-        const float paddingY = 22.0f;
-        const Size btnSize(textSize.width + paddingX * 2.0f, textSize.height + paddingY * 2.0f);
-
-        auto makeButtonNode = [&](const Color4F& bgColor, const Color4F& borderColor) -> Node* {
-            auto container = Node::create();
-            container->setContentSize(btnSize);
-            // 背景
-            auto bg = DrawNode::create();
-            bg->drawSolidRect(Vec2::ZERO, Vec2(btnSize.width, btnSize.height), bgColor);
-            // 边框
-            bg->drawRect(Vec2(0.5f, 0.5f), Vec2(btnSize.width - 0.5f, btnSize.height - 0.5f), borderColor);
-            container->addChild(bg);
-            // 文本
-            auto text = Label::createWithTTF(StringUtils::format("Level %d", levelId), "fonts/Marker Felt.ttf", kFontSize);
-            text->setColor(Color3B::WHITE);
-            text->setPosition(Vec2(btnSize.width * 0.5f, btnSize.height * 0.5f));
-            container->addChild(text, 1);
-            return container;
-        };
-
-        // 正常与按下态颜色
-        // 更明亮的按钮配色
-        Color4F normalBg(0.22f, 0.36f, 0.52f, 0.96f);     // 蓝色
-        Color4F normalBorder(1.f, 1.f, 1.f, 0.60f);
-        Color4F selectedBg(0.30f, 0.50f, 0.70f, 0.98f);   // 更亮
-        Color4F selectedBorder(1.f, 1.f, 1.f, 0.80f);
-
-        auto normalNode = makeButtonNode(normalBg, normalBorder);
-        auto selectedNode = makeButtonNode(selectedBg, selectedBorder);
-
-        auto item = MenuItemSprite::create(normalNode, selectedNode, nullptr, [this, levelId](Ref*) {
+    // 虚拟化列表：只创建可见行的按钮，打开耗时与关卡数量无关
+    if (_levelList == nullptr) {
+        _levelList = LevelSelectListView::create(visibleSize);
+        _levelList->setPosition(origin);
+        _levelList->setLevelSelectedCallback([this](int levelId) {
             this->startLevel(levelId);
         });
-        item->setPosition(Vec2(kCenterX, kStartY - static_cast<float>(i) * kGapY));
-        items.push_back(item);
-    }
-
-    // 如果数量太多，简单地限制在可视范围内（生产可改为滚动列表）
-    // 这里只是基础实现
-
-    // 将 std::vector<MenuItem*> 转换为 cocos2d::Vector<MenuItem*>
-    cocos2d::Vector<MenuItem*> menuItems;
-    menuItems.reserve(static_cast<int>(items.size()));
-    for (auto* it : items) {
-        menuItems.pushBack(it);
+        this->addChild(_levelList, 20);
+    } else {
+        _levelList->setVisible(true);
     }
-
-    _levelMenu = Menu::createWithArray(menuItems);
-    _levelMenu->setPosition(Vec2::ZERO);
-    this->addChild(_levelMenu, 20);
+    _levelList->setLevelIds(levelIds);
 }
 
 void GameScene::startLevel(int levelId) {
     CCLOG("startLevel - Starting level %d", levelId);
 
-    // 若已有游戏在运行，则先彻底清理
+    // 卡牌图片仍在预加载：记下最后选择的关卡，预加载完成后开始
+    if (_isPreloading) {
+        CCLOG("startLevel - Card textures still loading, level %d starts when ready", levelId);
+        _pendingLevelId = levelId;
+        return;
+    }
+
+    // 上一次点击的关卡仍在加载，忽略重复点击
+    if (_isLevelLoading) {
+        CCLOG("startLevel - Level is still loading, ignore");
+        return;
+    }
+
+    // 若已有游戏在运行，则先彻底清理；视图回收复用，卡牌视图留在对象池中
     if (_gameController || _gameView) {
         CCLOG("startLevel - Cleaning previous game before starting new level");
         if (_gameController) {
@@ -307,12 +329,11 @@ void GameScene::startLevel(int levelId) {
             _gameController = nullptr;
         }
         if (_gameView) {
-            _gameView->removeFromParentAndCleanup(true);
-            _gameView = nullptr;
+            _gameView->recycle();
         }
     }
 
-    // 首次选择关卡时创建视图与控制器
+    // 首次选择关卡时创建视图，之后复用
     if (_gameView == nullptr) {
         _gameView = GameView::create();
         if (!_gameView) {
@@ -321,6 +342,7 @@ void GameScene::startLevel(int levelId) {
         }
         this->addChild(_gameView, 10);
     }
+    _gameView->setVisible(true);
 
     if (_gameController == nullptr) {
         _gameController = new GameController();
@@ -332,16 +354,60 @@ void GameScene::startLevel(int levelId) {
         }
     }
 
-    // 开始关卡
-    if (_gameController->startGame(levelId)) {
-        CCLOG("✅ Level %d started", levelId);
-        _gameView->setUserData(_gameController);
-        if (_levelMenu) _levelMenu->setVisible(false); // 隐藏关卡菜单
-        if (_levelSelectBg) _levelSelectBg->setVisible(false); // 隐藏背景
-        if (_backMenu) _backMenu->setVisible(true);    // 显示返回按钮
-    } else {
-        CCLOG("❌ Failed to start level %d", levelId);
+    // 开始关卡：解析与生成在后台进行，本帧不阻塞
+    _isLevelLoading = true;
+    _gameController->startGameAsync(levelId, [this, levelId](bool success) {
+        _isLevelLoading = false;
+        if (success) {
+            CCLOG("✅ Level %d started", levelId);
+            _gameView->setUserData(_gameController);
+            if (_levelList) _levelList->setVisible(false); // 隐藏关卡列表
+            if (_levelSelectBg) _levelSelectBg->setVisible(false); // 隐藏背景
+            if (_backMenu) _backMenu->setVisible(true);    // 显示返回按钮
+        } else {
+            CCLOG("❌ Failed to start level %d", levelId);
+        }
+    });
+}
+
+void GameScene::initLevelPrefetchListeners() {
+    // 桌面端：光标停留在哪个关卡按钮上就预取哪一关
+    auto mouseListener = EventListenerMouse::create();
+    mouseListener->onMouseMove = [this](EventMouse* event) {
+        this->prefetchLevelAt(Vec2(event->getCursorX(), event->getCursorY()));
+    };
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(mouseListener, this);
+
+    // 触屏端：按下时即开始预取，抬起触发开局时多半已命中缓存
+    // 使用固定优先级先于菜单收到事件，且不吞没触摸
+    auto touchListener = EventListenerTouchOneByOne::create();
+    touchListener->setSwallowTouches(false);
+    touchListener->onTouchBegan = [this](Touch* touch, Event*) {
+        this->prefetchLevelAt(touch->getLocation());
+        return false;
+    };
+    _eventDispatcher->addEventListenerWithFixedPriority(touchListener, -1);
+
+    // 场景销毁时移除固定优先级监听
+    auto dispatcher = _eventDispatcher;
+    this->setOnExitCallback([dispatcher, touchListener]() {
+        dispatcher->removeEventListener(touchListener);
+    });
+}
+
+void GameScene::prefetchLevelAt(const Vec2& location) {
+    if (!_levelList) {
+        return;
     }
+
+    int levelId = _levelList->getLevelIdAt(location);
+
+    if (levelId <= 0 || levelId == _hoveredLevelId) {
+        return;
+    }
+
+    _hoveredLevelId = levelId;
+    ConfigManager::getInstance()->getLevelConfigLoader()->prefetchLevelConfig(levelId);
 }
 
 void GameScene::initBackButtonUI() {
@@ -365,18 +431,17 @@ void GameScene::initBackButtonUI() {
 void GameScene::returnToLevelSelect() {
     CCLOG("returnToLevelSelect - Returning to level selection");
 
-    // 彻底销毁并回到初始状态，避免悬垂指针
+    // 销毁控制器并回收视图，避免悬垂指针；视图与卡牌对象池留待下一局复用
     if (_gameController) {
         delete _gameController;
         _gameController = nullptr;
     }
     if (_gameView) {
-        _gameView->removeFromParentAndCleanup(true);
-        _gameView = nullptr;
+        _gameView->recycle();
     }
 
     // 切换UI可见性
-    if (_levelMenu) _levelMenu->setVisible(true);
+    if (_levelList) _levelList->setVisible(true);
     if (_levelSelectBg) _levelSelectBg->setVisible(true);
     if (_backMenu) _backMenu->setVisible(false);
 }
@@ -29,6 +29,7 @@
 
 class GameView;
 class GameController;
+class LevelSelectListView;
 
 class GameScene : public cocos2d::Scene
 {
@@ -36,6 +37,11 @@ public:
     static cocos2d::Scene* createScene();
 
     virtual bool init();
+
+    /**
+     * 离开场景时取消未完成的纹理预加载
+     */
+    virtual void onExit() override;
     
     // a selector callback
     void menuCloseCallback(cocos2d::Ref* pSender);
@@ -55,15 +61,45 @@ private:
     void createGameScene();
 
     /**
-     * 初始化关卡选择UI
+     * 初始化关卡选择UI（虚拟化滚动列表）
      */
     void initLevelSelectUI();
 
+    /**
+     * 开始异步预加载卡牌图片并显示进度，完成后合成牌面
+     */
+    void startTexturePreload();
+
+    /**
+     * 更新预加载进度条
+     * @param loadedCount 已完成数量
+     * @param totalCount 总数量
+     */
+    void updatePreloadProgress(size_t loadedCount, size_t totalCount);
+
+    /**
+     * 预加载完成：合成牌面，移除进度条，开始加载期间选择的关卡
+     * @param failedCount 加载失败的数量
+     */
+    void onTexturePreloadComplete(size_t failedCount);
+
     /**
      * 开始指定关卡
+     * 关卡在后台加载，完成后再切换界面；卡牌图片仍在预加载时等预加载完成后再开始
      */
     void startLevel(int levelId);
 
+    /**
+     * 初始化关卡预取监听（鼠标悬停或按下关卡按钮时预取该关卡）
+     */
+    void initLevelPrefetchListeners();
+
+    /**
+     * 预取指定位置下的关卡配置
+     * @param location 世界坐标
+     */
+    void prefetchLevelAt(const cocos2d::Vec2& location);
+
     /**
      * 初始化返回按钮（回到关卡选择）
      */
@@ -77,9 +113,15 @@ private:
 private:
     GameView* _gameView = nullptr;
     GameController* _gameController = nullptr;
-    cocos2d::Menu* _levelMenu = nullptr;
+    LevelSelectListView* _levelList = nullptr;
     cocos2d::Menu* _backMenu = nullptr;
     cocos2d::LayerColor* _levelSelectBg = nullptr;
+    int _hoveredLevelId = 0;          // 当前光标所在的关卡按钮
+    bool _isLevelLoading = false;     // 是否正在后台加载关卡
+    bool _isPreloading = false;       // 是否正在预加载卡牌图片
+    int _pendingLevelId = 0;          // 预加载期间选择的关卡
+    cocos2d::Label* _preloadLabel = nullptr;     // 预加载进度文字
+    cocos2d::DrawNode* _preloadBar = nullptr;    // 预加载进度条
 };
 
 #endif // __GAME_SCENE_H__
@@ -0,0 +1,194 @@
+#include "LevelConfigCache.h"
+#include <algorithm>
+
+const size_t LevelConfigCache::kDefaultBudgetBytes = 512 * 1024;
+
+// 每个条目在哈希表与LRU链表中的额外开销（估算值）
+static const size_t kEntryOverheadBytes = 64;
+
+LevelConfigCache::LevelConfigCache(size_t budgetBytes)
+    : _usedBytes(0)
+    , _budgetBytes(budgetBytes)
+    , _hitCount(0)
+    , _missCount(0)
+    , _evictionCount(0) {
+}
+
+std::shared_ptr<LevelConfig> LevelConfigCache::get(int levelId) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _entries.find(levelId);
+    if (it == _entries.end()) {
+        _missCount++;
+        return nullptr;
+    }
+
+    _hitCount++;
+    _lruList.splice(_lruList.begin(), _lruList, it->second.lruIterator);
+    return it->second.config;
+}
+
+std::shared_ptr<LevelConfig> LevelConfigCache::peek(int levelId) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _entries.find(levelId);
+    return (it != _entries.end()) ? it->second.config : nullptr;
+}
+
+std::shared_ptr<LevelConfig> LevelConfigCache::insert(int levelId, std::shared_ptr<LevelConfig> config) {
+    if (!config) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _entries.find(levelId);
+    if (it != _entries.end()) {
+        _lruList.splice(_lruList.begin(), _lruList, it->second.lruIterator);
+        return it->second.config;
+    }
+
+    addEntry(levelId, config, computeEntryBytes(*config), true);
+    evictIfNeeded(levelId);
+    return config;
+}
+
+std::shared_ptr<LevelConfig> LevelConfigCache::insertIfFits(int levelId, std::shared_ptr<LevelConfig> config) {
+    if (!config) {
+        return nullptr;
+    }
+
+    size_t bytes = computeEntryBytes(*config);
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _entries.find(levelId);
+    if (it != _entries.end()) {
+        return it->second.config;
+    }
+
+    // 被钉住的关卡本来就不受预算限制
+    if (_usedBytes + bytes > _budgetBytes && !isPinned(levelId)) {
+        return nullptr;
+    }
+
+    addEntry(levelId, config, bytes, false);
+    return config;
+}
+
+void LevelConfigCache::pin(int levelId) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pinCounts[levelId]++;
+}
+
+void LevelConfigCache::unpin(int levelId) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _pinCounts.find(levelId);
+    if (it == _pinCounts.end()) {
+        CCLOG("LevelConfigCache::unpin - Level %d is not pinned", levelId);
+        return;
+    }
+
+    if (--it->second <= 0) {
+        _pinCounts.erase(it);
+        // 解除钉住后可能已超出预算
+        evictIfNeeded(0);
+    }
+}
+
+void LevelConfigCache::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+    _lruList.clear();
+    _usedBytes = 0;
+}
+
+void LevelConfigCache::setBudgetBytes(size_t budgetBytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _budgetBytes = budgetBytes;
+    evictIfNeeded(0);
+}
+
+size_t LevelConfigCache::getBudgetBytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _budgetBytes;
+}
+
+LevelConfigCache::Stats LevelConfigCache::getStats() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    Stats stats;
+    stats.hitCount = _hitCount;
+    stats.missCount = _missCount;
+    stats.evictionCount = _evictionCount;
+    stats.usedBytes = _usedBytes;
+    stats.budgetBytes = _budgetBytes;
+    stats.entryCount = static_cast<int>(_entries.size());
+    stats.pinnedCount = static_cast<int>(_pinCounts.size());
+    return stats;
+}
+
+void LevelConfigCache::resetStats() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _hitCount = 0;
+    _missCount = 0;
+    _evictionCount = 0;
+}
+
+int LevelConfigCache::getEntryCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return static_cast<int>(_entries.size());
+}
+
+std::vector<int> LevelConfigCache::getLevelIds() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    std::vector<int> levelIds;
+    levelIds.reserve(_entries.size());
+    for (const auto& pair : _entries) {
+        levelIds.push_back(pair.first);
+    }
+    std::sort(levelIds.begin(), levelIds.end());
+    return levelIds;
+}
+
+size_t LevelConfigCache::computeEntryBytes(const LevelConfig& config) {
+    return config.getMemoryFootprint() + kEntryOverheadBytes;
+}
+
+void LevelConfigCache::addEntry(int levelId, std::shared_ptr<LevelConfig> config, size_t bytes, bool isMostRecent) {
+    Entry entry;
+    entry.config = config;
+    entry.bytes = bytes;
+    entry.lruIterator = isMostRecent ? _lruList.insert(_lruList.begin(), levelId)
+                                     : _lruList.insert(_lruList.end(), levelId);
+    _entries[levelId] = entry;
+    _usedBytes += entry.bytes;
+}
+
+void LevelConfigCache::evictIfNeeded(int protectedLevelId) {
+    // 从表尾（最久未使用）开始淘汰，跳过被钉住的关卡
+    auto it = _lruList.end();
+    while (_usedBytes > _budgetBytes && it != _lruList.begin()) {
+        --it;
+        int levelId = *it;
+        if (levelId == protectedLevelId || isPinned(levelId)) {
+            continue;
+        }
+
+        auto entry = _entries.find(levelId);
+        _usedBytes -= entry->second.bytes;
+        _entries.erase(entry);
+        it = _lruList.erase(it);
+        _evictionCount++;
+    }
+
+    if (_usedBytes > _budgetBytes) {
+        CCLOG("LevelConfigCache::evictIfNeeded - Over budget (%zu/%zu bytes), remaining entries are pinned",
+              _usedBytes, _budgetBytes);
+    }
+}
+
+bool LevelConfigCache::isPinned(int levelId) const {
+    return _pinCounts.find(levelId) != _pinCounts.end();
+}
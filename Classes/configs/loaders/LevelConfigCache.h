@@ -0,0 +1,185 @@
+#ifndef __LEVEL_CONFIG_CACHE_H__
+#define __LEVEL_CONFIG_CACHE_H__
+
+#include "../../utils/PlatformShim.h"
+#include "../models/LevelConfig.h"
+#include <memory>
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+
+USING_NS_CC;
+
+/**
+ * 关卡配置缓存
+ * 按字节预算限制内存占用，超出预算时按LRU淘汰最久未使用的关卡
+ * 被钉住的关卡（当前关卡、预取关卡）不会被淘汰
+ * 批量预加载使用insertIfFits，只填充剩余预算而不淘汰已有关卡：
+ * 关卡包大于预算时预加载到预算为止，需要整包常驻时先按关卡包大小调用setBudgetBytes
+ * 所有接口线程安全
+ */
+class LevelConfigCache {
+public:
+    /**
+     * 缓存统计信息（供遥测上报）
+     */
+    struct Stats {
+        uint64_t hitCount;          // 命中次数
+        uint64_t missCount;         // 未命中次数
+        uint64_t evictionCount;     // 淘汰次数
+        size_t usedBytes;           // 当前占用字节数
+        size_t budgetBytes;         // 字节预算
+        int entryCount;             // 缓存条目数
+        int pinnedCount;            // 被钉住的关卡数
+    };
+
+    /**
+     * 默认字节预算
+     */
+    static const size_t kDefaultBudgetBytes;
+
+    /**
+     * 构造函数
+     * @param budgetBytes 字节预算
+     */
+    explicit LevelConfigCache(size_t budgetBytes = kDefaultBudgetBytes);
+
+    /**
+     * 查找关卡配置，计入命中/未命中统计并刷新LRU顺序
+     * @param levelId 关卡ID
+     * @return 关卡配置，未找到返回nullptr
+     */
+    std::shared_ptr<LevelConfig> get(int levelId);
+
+    /**
+     * 查找关卡配置，不计入统计也不刷新LRU顺序
+     * @param levelId 关卡ID
+     * @return 关卡配置，未找到返回nullptr
+     */
+    std::shared_ptr<LevelConfig> peek(int levelId) const;
+
+    /**
+     * 写入关卡配置
+     * 已存在同ID配置时保留旧对象；写入后按预算淘汰
+     * @param levelId 关卡ID
+     * @param config 关卡配置
+     * @return 缓存中的配置对象
+     */
+    std::shared_ptr<LevelConfig> insert(int levelId, std::shared_ptr<LevelConfig> config);
+
+    /**
+     * 在剩余预算内写入关卡配置，不淘汰其他关卡
+     * 新条目置于LRU表尾，之后需要空间时优先淘汰；已存在同ID配置时返回旧对象
+     * @param levelId 关卡ID
+     * @param config 关卡配置
+     * @return 缓存中的配置对象，剩余预算不足（且关卡未被钉住）时不写入并返回nullptr
+     */
+    std::shared_ptr<LevelConfig> insertIfFits(int levelId, std::shared_ptr<LevelConfig> config);
+
+    /**
+     * 钉住关卡，被钉住的关卡不会被淘汰
+     * 可在关卡写入缓存之前调用；可重复调用，需对应次数的unpin
+     * @param levelId 关卡ID
+     */
+    void pin(int levelId);
+
+    /**
+     * 取消钉住关卡
+     * @param levelId 关卡ID
+     */
+    void unpin(int levelId);
+
+    /**
+     * 清空缓存条目（保留钉住记录与统计）
+     */
+    void clear();
+
+    /**
+     * 设置字节预算，立即按新预算淘汰
+     * @param budgetBytes 字节预算
+     */
+    void setBudgetBytes(size_t budgetBytes);
+
+    /**
+     * 获取字节预算
+     * @return 字节预算
+     */
+    size_t getBudgetBytes() const;
+
+    /**
+     * 获取统计信息
+     * @return 统计信息
+     */
+    Stats getStats() const;
+
+    /**
+     * 重置命中/未命中/淘汰计数
+     */
+    void resetStats();
+
+    /**
+     * 获取缓存条目数
+     * @return 条目数
+     */
+    int getEntryCount() const;
+
+    /**
+     * 获取所有缓存的关卡ID（升序）
+     * @return 关卡ID列表
+     */
+    std::vector<int> getLevelIds() const;
+
+private:
+    /**
+     * 缓存条目
+     */
+    struct Entry {
+        std::shared_ptr<LevelConfig> config;    // 关卡配置
+        size_t bytes;                           // 占用字节数
+        std::list<int>::iterator lruIterator;   // 在LRU链表中的位置
+    };
+
+    /**
+     * 计算配置占用的字节数（含条目开销）
+     * @param config 关卡配置
+     * @return 字节数
+     */
+    static size_t computeEntryBytes(const LevelConfig& config);
+
+    /**
+     * 新增条目（调用方需持有锁，且确认关卡不在缓存中）
+     * @param levelId 关卡ID
+     * @param config 关卡配置
+     * @param bytes 占用字节数
+     * @param isMostRecent 置于LRU表头（true）或表尾（false）
+     */
+    void addEntry(int levelId, std::shared_ptr<LevelConfig> config, size_t bytes, bool isMostRecent);
+
+    /**
+     * 按预算淘汰（调用方需持有锁）
+     * @param protectedLevelId 本次不淘汰的关卡ID（刚写入的关卡）
+     */
+    void evictIfNeeded(int protectedLevelId);
+
+    /**
+     * 检查关卡是否被钉住（调用方需持有锁）
+     * @param levelId 关卡ID
+     * @return 是否被钉住
+     */
+    bool isPinned(int levelId) const;
+
+    std::unordered_map<int, Entry> _entries;    // 缓存条目
+    std::list<int> _lruList;                    // LRU链表，表头为最近使用
+    std::map<int, int> _pinCounts;              // 钉住计数
+    size_t _usedBytes;                          // 当前占用字节数
+    size_t _budgetBytes;                        // 字节预算
+    uint64_t _hitCount;                         // 命中次数
+    uint64_t _missCount;                        // 未命中次数
+    uint64_t _evictionCount;                    // 淘汰次数
+    mutable std::mutex _mutex;                  // 保护以上所有成员
+};
+
+#endif // __LEVEL_CONFIG_CACHE_H__
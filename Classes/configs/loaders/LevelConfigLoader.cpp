@@ -2,20 +2,32 @@
 #include "external/json/document.h"
 #include "external/json/writer.h"
 #include "external/json/stringbuffer.h"
-
-LevelConfigLoader::LevelConfigLoader() {
+#include "base/CCAsyncTaskPool.h"
+#include "LevelConfigSaxHandler.h"
+#include "LevelFileUtils.h"
+#include "../../services/LevelLinter.h"
+#include "../../utils/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+
+const std::string LevelConfigLoader::kDefaultLevelDirectory = "configs/data/levels/";
+
+LevelConfigLoader::LevelConfigLoader()
+    : _aliveToken(std::make_shared<bool>(true)) {
 }
 
 LevelConfigLoader::~LevelConfigLoader() {
+    // 先停止预加载线程，再清理缓存
+    _preloadPool.reset();
     clearCache();
 }
 
 std::shared_ptr<LevelConfig> LevelConfigLoader::loadLevelConfig(int levelId) {
     // 先检查缓存
-    auto it = _cachedConfigs.find(levelId);
-    if (it != _cachedConfigs.end()) {
+    auto cached = _cache.get(levelId);
+    if (cached) {
     // found cached config
-        return it->second;
+        return cached;
     }
     
     // 从文件加载
@@ -25,13 +37,143 @@ std::shared_ptr<LevelConfig> LevelConfigLoader::loadLevelConfig(int levelId) {
     if (config) {
         // 设置关卡ID并缓存
         config->setLevelId(levelId);
-        _cachedConfigs[levelId] = config;
+        config = _cache.insert(levelId, config);
         CCLOG("LevelConfigLoader::loadLevelConfig - Loaded and cached level %d", levelId);
     }
     
     return config;
 }
 
+void LevelConfigLoader::loadLevelConfigAsync(int levelId, const LevelConfigCallback& callback) {
+    // 命中缓存直接回调
+    auto cached = _cache.get(levelId);
+    if (cached) {
+        if (callback) {
+            callback(cached);
+        }
+        return;
+    }
+    
+    requestAsyncLoad(levelId, callback);
+}
+
+void LevelConfigLoader::requestAsyncLoad(int levelId, const LevelConfigCallback& callback) {
+    // 已在加载中，只登记回调
+    auto pending = _pendingRequests.find(levelId);
+    if (pending != _pendingRequests.end()) {
+        if (callback) {
+            pending->second.push_back(callback);
+        }
+        return;
+    }
+    
+    // 在主线程解析完整路径，工作线程只按完整路径读取文件
+    std::string fullPath = FileUtils::getInstance()->fullPathForFilename(getLevelConfigFilePath(levelId));
+    if (fullPath.empty()) {
+        CCLOG("LevelConfigLoader::requestAsyncLoad - File not found for level %d", levelId);
+        if (callback) {
+            callback(nullptr);
+        }
+        return;
+    }
+    
+    auto& waiters = _pendingRequests[levelId];
+    if (callback) {
+        waiters.push_back(callback);
+    }
+    
+    auto result = std::make_shared<std::shared_ptr<LevelConfig>>();
+    std::weak_ptr<bool> aliveToken = _aliveToken;
+    
+    AsyncTaskPool::getInstance()->enqueue(AsyncTaskPool::TaskType::TASK_IO,
+        [this, aliveToken, levelId, result](void*) {
+            // 主线程：加载器已销毁则丢弃结果
+            if (aliveToken.expired()) {
+                return;
+            }
+            onAsyncLoadFinished(levelId, *result);
+        },
+        nullptr,
+        [fullPath, levelId, result]() {
+            // 工作线程：读取并解析
+            std::string content = readFileContent(fullPath);
+            if (!content.empty()) {
+                *result = parseLevelConfig(content, levelId);
+            }
+        });
+}
+
+void LevelConfigLoader::prefetchLevelConfig(int levelId, const LevelConfigCallback& callback) {
+    auto cached = levelId > 0 ? _cache.peek(levelId) : nullptr;
+    bool isCached = (cached != nullptr);
+    if (levelId <= 0 || (!isCached && !isLevelConfigPending(levelId) &&
+                         !FileUtils::getInstance()->isFileExist(getLevelConfigFilePath(levelId)))) {
+        if (callback) {
+            callback(nullptr);
+        }
+        return;
+    }
+    
+    // 钉住最近的预取关卡，挤出最早的预取钉
+    if (std::find(_prefetchPinnedIds.begin(), _prefetchPinnedIds.end(), levelId) == _prefetchPinnedIds.end()) {
+        _cache.pin(levelId);
+        _prefetchPinnedIds.push_back(levelId);
+        if (static_cast<int>(_prefetchPinnedIds.size()) > kMaxPrefetchPinnedLevels) {
+            _cache.unpin(_prefetchPinnedIds.front());
+            _prefetchPinnedIds.pop_front();
+        }
+    }
+    
+    // 预取不计入命中统计
+    if (!isCached) {
+        requestAsyncLoad(levelId, callback);
+    } else if (callback) {
+        callback(cached);
+    }
+}
+
+void LevelConfigLoader::pinLevel(int levelId) {
+    _cache.pin(levelId);
+}
+
+void LevelConfigLoader::unpinLevel(int levelId) {
+    _cache.unpin(levelId);
+}
+
+void LevelConfigLoader::setCacheBudget(size_t budgetBytes) {
+    _cache.setBudgetBytes(budgetBytes);
+}
+
+LevelConfigCache::Stats LevelConfigLoader::getCacheStats() const {
+    return _cache.getStats();
+}
+
+bool LevelConfigLoader::isLevelConfigPending(int levelId) const {
+    return _pendingRequests.find(levelId) != _pendingRequests.end();
+}
+
+void LevelConfigLoader::onAsyncLoadFinished(int levelId, std::shared_ptr<LevelConfig> config) {
+    auto pending = _pendingRequests.find(levelId);
+    if (pending == _pendingRequests.end()) {
+        return;
+    }
+    
+    std::vector<LevelConfigCallback> waiters;
+    waiters.swap(pending->second);
+    _pendingRequests.erase(pending);
+    
+    if (config) {
+        // 同步加载或批量预加载可能已抢先写入缓存，以缓存中的对象为准
+        config = _cache.insert(levelId, config);
+    } else {
+        CCLOG("LevelConfigLoader::onAsyncLoadFinished - Failed to load level %d", levelId);
+    }
+    
+    for (const auto& callback : waiters) {
+        callback(config);
+    }
+}
+
 std::shared_ptr<LevelConfig> LevelConfigLoader::loadLevelConfigFromFile(const std::string& filePath) {
     // loading from file
     
@@ -41,75 +183,174 @@ std::shared_ptr<LevelConfig> LevelConfigLoader::loadLevelConfigFromFile(const st
         return nullptr;
     }
     
-    return loadLevelConfigFromString(content);
+    return parseLevelConfig(content, 0);
 }
 
 std::shared_ptr<LevelConfig> LevelConfigLoader::loadLevelConfigFromString(const std::string& jsonString, int levelId) {
-    rapidjson::Document document;
-    if (!parseJsonDocument(jsonString, document)) {
-        CCLOG("LevelConfigLoader::loadLevelConfigFromString - Failed to parse JSON");
-        return nullptr;
-    }
-    
-    if (!validateJsonDocument(document)) {
-        CCLOG("LevelConfigLoader::loadLevelConfigFromString - Invalid JSON format");
-        return nullptr;
-    }
-    
+    // 就地解析会改写缓冲区，这里复制一份
+    std::string buffer(jsonString);
+    return parseLevelConfig(buffer, levelId);
+}
+
+std::shared_ptr<LevelConfig> LevelConfigLoader::parseLevelConfig(std::string& buffer, int levelId) {
     auto config = std::make_shared<LevelConfig>();
 
-    // 如果提供了关卡ID，先设置它（在fromJson之前）
+    // 如果提供了关卡ID，先设置它（JSON中的LevelId优先）
     if (levelId > 0) {
         config->setLevelId(levelId);
     }
 
-    if (!config->fromJson(document)) {
-        CCLOG("LevelConfigLoader::loadLevelConfigFromString - Failed to create config from JSON");
+    // 单遍SAX就地解析：校验格式的同时填充配置，不构建DOM
+    std::string errorMessage;
+    if (!LevelConfigSaxHandler::parseInsitu(&buffer[0], config.get(), errorMessage)) {
+        CCLOG("LevelConfigLoader::parseLevelConfig - Invalid level JSON: %s", errorMessage.c_str());
+        return nullptr;
+    }
+
+    if (!config->isValid()) {
+        CCLOG("LevelConfigLoader::parseLevelConfig - Failed to create config from JSON");
         return nullptr;
     }
     
-    // loaded config
+    // 加载时计算内容哈希，供按内容缓存与去重
+    config->updateContentHash();
     
     return config;
 }
 
 int LevelConfigLoader::preloadAllLevelConfigs(const std::string& configDirectory) {
-    // preload from directory
+    auto levelFiles = LevelFileUtils::enumerateLevelFiles(configDirectory);
+    if (levelFiles.empty()) {
+        CCLOG("LevelConfigLoader::preloadAllLevelConfigs - No level files found in %s", configDirectory.c_str());
+        return 0;
+    }
     
-    int loadedCount = 0;
+    std::atomic<int> loadedCount(0);
+    std::atomic<bool> isBudgetFull(false);
+    ThreadPool pool;
     
-    // 尝试加载关卡1-10（可以根据需要调整范围）
-    for (int levelId = 1; levelId <= 10; levelId++) {
-        auto config = loadLevelConfig(levelId);
-        if (config) {
-            loadedCount++;
+    for (const auto& levelFile : levelFiles) {
+        int levelId = levelFile.first;
+        std::string fullPath = levelFile.second;
+        pool.enqueue([this, levelId, fullPath, &loadedCount, &isBudgetFull]() {
+            if (preloadLevelConfig(levelId, fullPath, isBudgetFull)) {
+                loadedCount++;
+            }
+        });
+    }
+    
+    pool.waitForAll();
+    
+    CCLOG("LevelConfigLoader::preloadAllLevelConfigs - Preloaded %d/%zu levels with %d threads%s",
+          loadedCount.load(), levelFiles.size(), pool.getThreadCount(),
+          isBudgetFull.load() ? " (stopped at cache budget)" : "");
+    return loadedCount.load();
+}
+
+void LevelConfigLoader::preloadAllLevelConfigsAsync(const std::string& configDirectory,
+                                                    const PreloadProgressCallback& progressCallback,
+                                                    const PreloadCompleteCallback& completeCallback) {
+    auto levelFiles = LevelFileUtils::enumerateLevelFiles(configDirectory);
+    const int totalCount = static_cast<int>(levelFiles.size());
+    if (totalCount == 0) {
+        CCLOG("LevelConfigLoader::preloadAllLevelConfigsAsync - No level files found in %s", configDirectory.c_str());
+        if (completeCallback) {
+            completeCallback(0);
         }
+        return;
+    }
+    
+    if (!_preloadPool) {
+        _preloadPool.reset(new ThreadPool());
+    }
+    
+    // 进度约每1%回报一次，避免向主线程投递过多任务
+    const int progressStep = std::max(1, totalCount / 100);
+    auto processedCount = std::make_shared<std::atomic<int>>(0);
+    auto loadedCount = std::make_shared<std::atomic<int>>(0);
+    auto isBudgetFull = std::make_shared<std::atomic<bool>>(false);
+    std::weak_ptr<bool> aliveToken = _aliveToken;
+    auto scheduler = Director::getInstance()->getScheduler();
+    
+    for (const auto& levelFile : levelFiles) {
+        int levelId = levelFile.first;
+        std::string fullPath = levelFile.second;
+        _preloadPool->enqueue([=]() {
+            if (preloadLevelConfig(levelId, fullPath, *isBudgetFull)) {
+                (*loadedCount)++;
+            }
+            
+            int processed = ++(*processedCount);
+            if (processed % progressStep != 0 && processed != totalCount) {
+                return;
+            }
+            
+            int loaded = loadedCount->load();
+            scheduler->performFunctionInCocosThread([=]() {
+                if (aliveToken.expired()) {
+                    return;
+                }
+                if (progressCallback) {
+                    progressCallback(processed, totalCount);
+                }
+                if (processed == totalCount) {
+                    CCLOG("LevelConfigLoader::preloadAllLevelConfigsAsync - Preloaded %d/%d levels%s", loaded, totalCount,
+                          isBudgetFull->load() ? " (stopped at cache budget)" : "");
+                    if (completeCallback) {
+                        completeCallback(loaded);
+                    }
+                }
+            });
+        });
+    }
+}
+
+bool LevelConfigLoader::preloadLevelConfig(int levelId, const std::string& fullPath, std::atomic<bool>& isBudgetFull) {
+    if (getCachedLevelConfig(levelId)) {
+        return true;
+    }
+    
+    // 预算已满后不再读取解析，剩余任务只计入进度
+    if (isBudgetFull.load()) {
+        return false;
     }
     
-    // loaded count
-    return loadedCount;
+    std::string content = readFileContent(fullPath);
+    auto config = content.empty() ? nullptr : parseLevelConfig(content, levelId);
+    if (!config) {
+        return false;
+    }
+    
+    if (!_cache.insertIfFits(levelId, config)) {
+        isBudgetFull.store(true);
+        return false;
+    }
+    return true;
+}
+
+std::vector<int> LevelConfigLoader::enumerateLevelIds(const std::string& configDirectory) const {
+    std::vector<int> levelIds;
+    for (const auto& levelFile : LevelFileUtils::enumerateLevelFiles(configDirectory)) {
+        levelIds.push_back(levelFile.first);
+    }
+    return levelIds;
 }
 
 std::shared_ptr<LevelConfig> LevelConfigLoader::getCachedLevelConfig(int levelId) const {
-    auto it = _cachedConfigs.find(levelId);
-    return (it != _cachedConfigs.end()) ? it->second : nullptr;
+    return _cache.peek(levelId);
 }
 
 void LevelConfigLoader::clearCache() {
-    _cachedConfigs.clear();
+    _cache.clear();
     // cache cleared
 }
 
 int LevelConfigLoader::getLoadedLevelCount() const {
-    return static_cast<int>(_cachedConfigs.size());
+    return _cache.getEntryCount();
 }
 
 std::vector<int> LevelConfigLoader::getLoadedLevelIds() const {
-    std::vector<int> levelIds;
-    for (const auto& pair : _cachedConfigs) {
-        levelIds.push_back(pair.first);
-    }
-    return levelIds;
+    return _cache.getLevelIds();
 }
 
 bool LevelConfigLoader::validateConfigFile(const std::string& filePath) const {
@@ -118,12 +359,22 @@ bool LevelConfigLoader::validateConfigFile(const std::string& filePath) const {
         return false;
     }
     
-    rapidjson::Document document;
-    if (!parseJsonDocument(content, document)) {
+    LevelConfig config;
+    std::string errorMessage;
+    if (!LevelConfigSaxHandler::parseInsitu(&content[0], &config, errorMessage)) {
+        CCLOG("LevelConfigLoader::validateConfigFile - %s: %s", filePath.c_str(), errorMessage.c_str());
         return false;
     }
     
-    return validateJsonDocument(document);
+    // 内容检查：越界、重叠、重复牌等
+    auto issues = LevelLinter::lint(config);
+    for (const auto& issue : issues) {
+        CCLOG("LevelConfigLoader::validateConfigFile - %s: %s %s %s: %s", filePath.c_str(),
+              LevelLinter::getSeverityName(issue.severity), issue.rule.c_str(),
+              issue.location.c_str(), issue.message.c_str());
+    }
+    
+    return !LevelLinter::hasErrors(issues);
 }
 
 
@@ -164,19 +415,7 @@ bool LevelConfigLoader::saveLevelConfig(std::shared_ptr<LevelConfig> levelConfig
     return success;
 }
 
-bool LevelConfigLoader::parseJsonDocument(const std::string& jsonString, rapidjson::Document& document) const {
-    document.Parse(jsonString.c_str());
-
-    if (document.HasParseError()) {
-        CCLOG("LevelConfigLoader::parseJsonDocument - Parse error at offset %zu: %d",
-              document.GetErrorOffset(), document.GetParseError());
-        return false;
-    }
-
-    return true;
-}
-
-std::string LevelConfigLoader::readFileContent(const std::string& filePath) const {
+std::string LevelConfigLoader::readFileContent(const std::string& filePath) {
     std::string fullPath = FileUtils::getInstance()->fullPathForFilename(filePath);
 
     if (fullPath.empty()) {
@@ -184,62 +423,17 @@ std::string LevelConfigLoader::readFileContent(const std::string& filePath) cons
         return "";
     }
 
-    Data data = FileUtils::getInstance()->getDataFromFile(fullPath);
-    if (data.isNull()) {
+    // 直接读入字符串，作为就地解析的缓冲区
+    std::string content = FileUtils::getInstance()->getStringFromFile(fullPath);
+    if (content.empty()) {
         CCLOG("LevelConfigLoader::readFileContent - Failed to read file: %s", fullPath.c_str());
-        return "";
     }
 
-    return std::string(reinterpret_cast<const char*>(data.getBytes()), data.getSize());
+    return content;
 }
 
 std::string LevelConfigLoader::getLevelConfigFilePath(int levelId) const {
-    char buffer[64];
-    snprintf(buffer, sizeof(buffer), "configs/data/levels/level_%d.json", levelId);
+    char buffer[128];
+    snprintf(buffer, sizeof(buffer), "%slevel_%d.json", kDefaultLevelDirectory.c_str(), levelId);
     return std::string(buffer);
 }
-
-bool LevelConfigLoader::validateJsonDocument(const rapidjson::Document& document) const {
-    if (!document.IsObject()) {
-        CCLOG("LevelConfigLoader::validateJsonDocument - Root is not an object");
-        return false;
-    }
-
-    // 检查必需的字段
-    if (!document.HasMember("Playfield") || !document["Playfield"].IsArray()) {
-        CCLOG("LevelConfigLoader::validateJsonDocument - Missing or invalid Playfield array");
-        return false;
-    }
-
-    if (!document.HasMember("Stack") || !document["Stack"].IsArray()) {
-        CCLOG("LevelConfigLoader::validateJsonDocument - Missing or invalid Stack array");
-        return false;
-    }
-
-    // 检查Playfield数组中的卡牌格式
-    const rapidjson::Value& playfield = document["Playfield"];
-    for (rapidjson::SizeType i = 0; i < playfield.Size(); i++) {
-        const rapidjson::Value& card = playfield[i];
-        if (!card.IsObject() ||
-            !card.HasMember("CardFace") || !card["CardFace"].IsInt() ||
-            !card.HasMember("CardSuit") || !card["CardSuit"].IsInt() ||
-            !card.HasMember("Position") || !card["Position"].IsObject()) {
-            CCLOG("LevelConfigLoader::validateJsonDocument - Invalid Playfield card at index %u", i);
-            return false;
-        }
-    }
-
-    // 检查Stack数组中的卡牌格式
-    const rapidjson::Value& stack = document["Stack"];
-    for (rapidjson::SizeType i = 0; i < stack.Size(); i++) {
-        const rapidjson::Value& card = stack[i];
-        if (!card.IsObject() ||
-            !card.HasMember("CardFace") || !card["CardFace"].IsInt() ||
-            !card.HasMember("CardSuit") || !card["CardSuit"].IsInt()) {
-            CCLOG("LevelConfigLoader::validateJsonDocument - Invalid Stack card at index %u", i);
-            return false;
-        }
-    }
-
-    return true;
-}
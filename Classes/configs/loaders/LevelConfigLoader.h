@@ -3,9 +3,16 @@
 
 #include "cocos2d.h"
 #include "../models/LevelConfig.h"
+#include "LevelConfigCache.h"
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
+#include <functional>
+#include <deque>
+#include <atomic>
+
+class ThreadPool;
 
 USING_NS_CC;
 
@@ -13,9 +20,39 @@ USING_NS_CC;
  * 关卡配置加载器
  * 负责从文件系统加载关卡配置数据
  * 支持JSON格式的配置文件加载和缓存管理
+ * 异步加载时文件读取与解析在工作线程完成，回调只在主线程执行
+ * 缓存按字节预算做LRU淘汰且线程安全，批量预加载的工作线程可直接写入
  */
 class LevelConfigLoader {
 public:
+    /**
+     * 异步加载回调（主线程调用）
+     * 参数为加载结果，失败时为nullptr
+     */
+    typedef std::function<void(std::shared_ptr<LevelConfig>)> LevelConfigCallback;
+
+    /**
+     * 预加载进度回调（主线程调用）
+     * 参数为已处理数量与总数量
+     */
+    typedef std::function<void(int processedCount, int totalCount)> PreloadProgressCallback;
+
+    /**
+     * 预加载完成回调（主线程调用）
+     * 参数为成功加载的数量
+     */
+    typedef std::function<void(int loadedCount)> PreloadCompleteCallback;
+
+    /**
+     * 默认关卡目录
+     */
+    static const std::string kDefaultLevelDirectory;
+
+    /**
+     * 同时保持钉住的预取关卡数量（下一关与菜单光标所在关卡）
+     */
+    static const int kMaxPrefetchPinnedLevels = 2;
+
     /**
      * 构造函数
      */
@@ -33,6 +70,53 @@ public:
      */
     std::shared_ptr<LevelConfig> loadLevelConfig(int levelId);
     
+    /**
+     * 异步加载指定关卡的配置
+     * 命中缓存时立即回调；同一关卡的重复请求合并为一次解析
+     * @param levelId 关卡ID
+     * @param callback 加载完成回调，在主线程执行
+     */
+    void loadLevelConfigAsync(int levelId, const LevelConfigCallback& callback);
+    
+    /**
+     * 预取关卡配置到缓存
+     * 已缓存或正在加载时不重复加载，文件不存在时直接忽略；预取不计入缓存命中统计
+     * @param levelId 关卡ID
+     * @param callback 配置就绪回调（主线程），已缓存时立即执行，文件不存在或加载失败时参数为nullptr；可为空
+     */
+    void prefetchLevelConfig(int levelId, const LevelConfigCallback& callback = nullptr);
+    
+    /**
+     * 钉住关卡，使其不被缓存淘汰（如当前正在玩的关卡）
+     * @param levelId 关卡ID
+     */
+    void pinLevel(int levelId);
+    
+    /**
+     * 取消钉住关卡
+     * @param levelId 关卡ID
+     */
+    void unpinLevel(int levelId);
+    
+    /**
+     * 设置缓存字节预算
+     * @param budgetBytes 字节预算
+     */
+    void setCacheBudget(size_t budgetBytes);
+    
+    /**
+     * 获取缓存统计信息（命中、未命中、淘汰次数等）
+     * @return 统计信息
+     */
+    LevelConfigCache::Stats getCacheStats() const;
+    
+    /**
+     * 检查关卡是否正在异步加载
+     * @param levelId 关卡ID
+     * @return 是否正在加载
+     */
+    bool isLevelConfigPending(int levelId) const;
+    
     /**
      * 从文件路径加载关卡配置
      * @param filePath 配置文件路径
@@ -49,14 +133,37 @@ public:
     std::shared_ptr<LevelConfig> loadLevelConfigFromString(const std::string& jsonString, int levelId = 0);
     
     /**
-     * 预加载所有关卡配置
+     * 预加载所有关卡配置（阻塞）
+     * 按关卡包索引或目录列举实际存在的关卡，在线程池中并行解析。
+     * 只填充缓存的剩余预算，不淘汰已缓存的关卡，预算用完即停止；
+     * 需要整个关卡包常驻时先用setCacheBudget按关卡包大小放宽预算
      * @param configDirectory 配置文件目录
-     * @return 成功加载的关卡数量
+     * @return 加载后在缓存中的关卡数量（含已缓存的关卡）
+     */
+    int preloadAllLevelConfigs(const std::string& configDirectory = kDefaultLevelDirectory);
+    
+    /**
+     * 后台预加载所有关卡配置
+     * 解析在线程池中并行进行，进度与完成回调在主线程执行，可用于加载界面。
+     * 与preloadAllLevelConfigs相同，只填充缓存的剩余预算；预算用完后剩余关卡仍计入进度
+     * @param configDirectory 配置文件目录
+     * @param progressCallback 进度回调，可为空
+     * @param completeCallback 完成回调，可为空
+     */
+    void preloadAllLevelConfigsAsync(const std::string& configDirectory,
+                                     const PreloadProgressCallback& progressCallback,
+                                     const PreloadCompleteCallback& completeCallback);
+    
+    /**
+     * 列举目录中的关卡ID（升序、去重）
+     * 优先读取关卡包索引，缺失时列举目录中的level_<id>.json
+     * @param configDirectory 配置文件目录
+     * @return 关卡ID列表
      */
-    int preloadAllLevelConfigs(const std::string& configDirectory = "configs/data/levels/");
+    std::vector<int> enumerateLevelIds(const std::string& configDirectory = kDefaultLevelDirectory) const;
     
     /**
-     * 获取已加载的关卡配置
+     * 获取已加载的关卡配置（不计入缓存命中统计）
      * @param levelId 关卡ID
      * @return 关卡配置对象，未找到返回nullptr
      */
@@ -80,7 +187,7 @@ public:
     std::vector<int> getLoadedLevelIds() const;
     
     /**
-     * 验证关卡配置文件格式
+     * 验证关卡配置文件格式与内容（LevelLinter检查项）
      * @param filePath 配置文件路径
      * @return 是否为有效的配置文件
      */
@@ -96,22 +203,54 @@ public:
     bool saveLevelConfig(std::shared_ptr<LevelConfig> levelConfig, const std::string& filePath) const;
 
 private:
-    std::map<int, std::shared_ptr<LevelConfig>> _cachedConfigs;  // 缓存的配置
+    LevelConfigCache _cache;                                     // 缓存的配置（线程安全）
+    std::deque<int> _prefetchPinnedIds;                          // 因预取而钉住的关卡（仅主线程）
+    std::map<int, std::vector<LevelConfigCallback>> _pendingRequests;  // 异步加载中的关卡及等待的回调（仅主线程）
+    std::shared_ptr<bool> _aliveToken;                           // 存活标记，异步回调据此判断加载器是否已销毁
+    std::unique_ptr<ThreadPool> _preloadPool;                    // 批量预加载线程池（按需创建）
     
     /**
-     * 解析JSON文档
-     * @param jsonString JSON字符串
-     * @param document 输出的JSON文档
-     * @return 是否解析成功
+     * 预加载单个关卡（工作线程）
+     * 已缓存时直接返回；否则解析后在剩余预算内写入缓存，放不下时标记预算已满
+     * @param levelId 关卡ID
+     * @param fullPath 关卡文件完整路径
+     * @param isBudgetFull 本轮预加载共享的预算已满标记
+     * @return 关卡是否在缓存中
+     */
+    bool preloadLevelConfig(int levelId, const std::string& fullPath, std::atomic<bool>& isBudgetFull);
+    
+    /**
+     * 发起异步加载（不查缓存）
+     * 同一关卡已在加载中时只登记回调
+     * @param levelId 关卡ID
+     * @param callback 加载完成回调，可为空
+     */
+    void requestAsyncLoad(int levelId, const LevelConfigCallback& callback);
+    
+    /**
+     * 完成一次异步加载（主线程）
+     * 写入缓存并通知所有等待该关卡的回调
+     * @param levelId 关卡ID
+     * @param config 解析结果，失败为nullptr
+     */
+    void onAsyncLoadFinished(int levelId, std::shared_ptr<LevelConfig> config);
+    
+    /**
+     * 解析关卡配置（不访问成员状态，可在工作线程调用）
+     * 在缓冲区上单遍SAX就地解析，缓冲区内容会被改写
+     * @param buffer JSON缓冲区
+     * @param levelId 关卡ID，大于0时写入配置
+     * @return 关卡配置对象，失败返回nullptr
      */
-    bool parseJsonDocument(const std::string& jsonString, rapidjson::Document& document) const;
+    static std::shared_ptr<LevelConfig> parseLevelConfig(std::string& buffer, int levelId);
     
     /**
      * 从文件读取内容
+     * 传入完整路径时不会访问FileUtils的路径缓存，可在工作线程调用
      * @param filePath 文件路径
      * @return 文件内容，读取失败返回空字符串
      */
-    std::string readFileContent(const std::string& filePath) const;
+    static std::string readFileContent(const std::string& filePath);
     
     /**
      * 获取关卡配置文件路径
@@ -119,13 +258,6 @@ private:
      * @return 配置文件路径
      */
     std::string getLevelConfigFilePath(int levelId) const;
-    
-    /**
-     * 验证JSON文档格式
-     * @param document JSON文档
-     * @return 是否为有效的关卡配置格式
-     */
-    bool validateJsonDocument(const rapidjson::Document& document) const;
 };
 
 #endif // __LEVEL_CONFIG_LOADER_H__
@@ -0,0 +1,356 @@
+#include "LevelConfigSaxHandler.h"
+#include "external/json/error/en.h"
+#include <climits>
+#include <cstring>
+
+LevelConfigSaxHandler::LevelConfigSaxHandler(LevelConfig* config)
+    : _config(config)
+    , _currentKey(KEY_UNKNOWN)
+    , _hasPlayfield(false)
+    , _hasStack(false)
+    , _hasCardFace(false)
+    , _hasCardSuit(false)
+    , _hasPosition(false)
+    , _hasPositionX(false)
+    , _hasPositionY(false)
+    , _hasWidth(false)
+    , _hasHeight(false) {
+    _frames.reserve(8);
+}
+
+bool LevelConfigSaxHandler::parseInsitu(char* buffer, LevelConfig* config, std::string& errorMessage) {
+    if (!buffer || !config) {
+        errorMessage = "Invalid parse arguments";
+        return false;
+    }
+
+    LevelConfigSaxHandler handler(config);
+    rapidjson::Reader reader;
+    rapidjson::InsituStringStream stream(buffer);
+    rapidjson::ParseResult result = reader.Parse<rapidjson::kParseInsituFlag>(stream, handler);
+
+    if (result.IsError()) {
+        // 处理器主动终止时使用其错误信息，否则为语法错误
+        if (!handler.getErrorMessage().empty()) {
+            errorMessage = handler.getErrorMessage();
+        } else {
+            errorMessage = StringUtils::format("Parse error at offset %zu: %s",
+                                               result.Offset(), rapidjson::GetParseError_En(result.Code()));
+        }
+        return false;
+    }
+
+    if (!handler.finish()) {
+        errorMessage = handler.getErrorMessage();
+        return false;
+    }
+
+    return true;
+}
+
+bool LevelConfigSaxHandler::finish() {
+    if (!_hasPlayfield) {
+        return fail("Missing or invalid Playfield array");
+    }
+
+    if (!_hasStack) {
+        return fail("Missing or invalid Stack array");
+    }
+
+    return true;
+}
+
+bool LevelConfigSaxHandler::Default() {
+    // null、bool等与关卡无关的标量
+    if (_frames.empty()) {
+        return fail("Root is not an object");
+    }
+
+    switch (_frames.back().type) {
+        case FRAME_ROOT:
+            if (_currentKey == KEY_PLAYFIELD) {
+                return fail("Missing or invalid Playfield array");
+            }
+            if (_currentKey == KEY_STACK) {
+                return fail("Missing or invalid Stack array");
+            }
+            return true;
+        case FRAME_PLAYFIELD:
+        case FRAME_STACK:
+            return failInvalidCard();
+        case FRAME_CARD:
+            if (_currentKey == KEY_CARD_FACE || _currentKey == KEY_CARD_SUIT) {
+                return failInvalidCard();
+            }
+            if (_currentKey == KEY_POSITION && _frames[_frames.size() - 2].type == FRAME_PLAYFIELD) {
+                return failInvalidCard();
+            }
+            return true;
+        case FRAME_POSITION:
+            if (_currentKey == KEY_X || _currentKey == KEY_Y) {
+                return failInvalidCard();
+            }
+            return true;
+        default:
+            return true;
+    }
+}
+
+bool LevelConfigSaxHandler::Uint(unsigned value) {
+    if (value <= static_cast<unsigned>(INT_MAX)) {
+        return onNumber(true, static_cast<int>(value), value);
+    }
+    return onNumber(false, 0, value);
+}
+
+bool LevelConfigSaxHandler::String(const char* str, rapidjson::SizeType length, bool /* copy */) {
+    if (!_frames.empty() && _frames.back().type == FRAME_ROOT && _currentKey == KEY_LEVEL_NAME) {
+        _config->setLevelName(std::string(str, length));
+        return true;
+    }
+    return Default();
+}
+
+bool LevelConfigSaxHandler::onNumber(bool isInt, int intValue, double value) {
+    if (_frames.empty()) {
+        return fail("Root is not an object");
+    }
+
+    switch (_frames.back().type) {
+        case FRAME_ROOT:
+            if (_currentKey == KEY_LEVEL_ID) {
+                if (isInt) {
+                    _config->setLevelId(intValue);
+                }
+                return true;
+            }
+            return Default();
+        case FRAME_CARD:
+            if (_currentKey == KEY_CARD_FACE || _currentKey == KEY_CARD_SUIT) {
+                if (!isInt) {
+                    return failInvalidCard();
+                }
+                if (_currentKey == KEY_CARD_FACE) {
+                    _card.cardFace = static_cast<CardFaceType>(intValue);
+                    _hasCardFace = true;
+                } else {
+                    _card.cardSuit = static_cast<CardSuitType>(intValue);
+                    _hasCardSuit = true;
+                }
+                return true;
+            }
+            return Default();
+        case FRAME_POSITION:
+            if (_currentKey == KEY_X) {
+                _card.position.x = static_cast<float>(value);
+                _hasPositionX = true;
+            } else if (_currentKey == KEY_Y) {
+                _card.position.y = static_cast<float>(value);
+                _hasPositionY = true;
+            }
+            return true;
+        case FRAME_PLAYFIELD_SIZE:
+        case FRAME_STACK_SIZE:
+            if (_currentKey == KEY_WIDTH) {
+                _size.width = static_cast<float>(value);
+                _hasWidth = true;
+            } else if (_currentKey == KEY_HEIGHT) {
+                _size.height = static_cast<float>(value);
+                _hasHeight = true;
+            }
+            return true;
+        default:
+            return Default();
+    }
+}
+
+bool LevelConfigSaxHandler::StartObject() {
+    return onContainerStart(true);
+}
+
+bool LevelConfigSaxHandler::StartArray() {
+    return onContainerStart(false);
+}
+
+bool LevelConfigSaxHandler::onContainerStart(bool isObject) {
+    Frame frame;
+    frame.type = FRAME_SKIP;
+    frame.index = 0;
+
+    if (_frames.empty()) {
+        if (!isObject) {
+            return fail("Root is not an object");
+        }
+        frame.type = FRAME_ROOT;
+        _frames.push_back(frame);
+        _currentKey = KEY_UNKNOWN;
+        return true;
+    }
+
+    switch (_frames.back().type) {
+        case FRAME_ROOT:
+            if (_currentKey == KEY_PLAYFIELD || _currentKey == KEY_STACK) {
+                if (isObject) {
+                    return Default();
+                }
+                if (_currentKey == KEY_PLAYFIELD) {
+                    frame.type = FRAME_PLAYFIELD;
+                    _hasPlayfield = true;
+                    _config->clearPlayfieldCards();
+                } else {
+                    frame.type = FRAME_STACK;
+                    _hasStack = true;
+                    _config->clearStackCards();
+                }
+            } else if (isObject && (_currentKey == KEY_PLAYFIELD_SIZE || _currentKey == KEY_STACK_SIZE)) {
+                frame.type = (_currentKey == KEY_PLAYFIELD_SIZE) ? FRAME_PLAYFIELD_SIZE : FRAME_STACK_SIZE;
+                _size = Size::ZERO;
+                _hasWidth = false;
+                _hasHeight = false;
+            }
+            break;
+        case FRAME_PLAYFIELD:
+        case FRAME_STACK:
+            if (!isObject) {
+                return failInvalidCard();
+            }
+            frame.type = FRAME_CARD;
+            _card = CardConfigData();
+            _hasCardFace = false;
+            _hasCardSuit = false;
+            _hasPosition = false;
+            _hasPositionX = false;
+            _hasPositionY = false;
+            break;
+        case FRAME_CARD:
+            if (_currentKey == KEY_POSITION && isObject) {
+                frame.type = FRAME_POSITION;
+                _hasPosition = true;
+            } else if (!Default()) {
+                return false;
+            }
+            break;
+        case FRAME_POSITION:
+            if (!Default()) {
+                return false;
+            }
+            break;
+        default:
+            break;
+    }
+
+    _frames.push_back(frame);
+    _currentKey = KEY_UNKNOWN;
+    return true;
+}
+
+bool LevelConfigSaxHandler::Key(const char* str, rapidjson::SizeType length, bool /* copy */) {
+    _currentKey = (_frames.back().type == FRAME_SKIP) ? KEY_UNKNOWN : lookupKey(str, length);
+    return true;
+}
+
+bool LevelConfigSaxHandler::EndObject(rapidjson::SizeType /* memberCount */) {
+    FrameType type = _frames.back().type;
+
+    switch (type) {
+        case FRAME_CARD:
+            if (!finishCard()) {
+                return false;
+            }
+            break;
+        case FRAME_PLAYFIELD_SIZE:
+        case FRAME_STACK_SIZE:
+            // 与DOM解析一致：宽高都存在才生效
+            if (_hasWidth && _hasHeight) {
+                if (type == FRAME_PLAYFIELD_SIZE) {
+                    _config->setPlayfieldSize(_size);
+                } else {
+                    _config->setStackSize(_size);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+
+    _frames.pop_back();
+    _currentKey = KEY_UNKNOWN;
+    return true;
+}
+
+bool LevelConfigSaxHandler::EndArray(rapidjson::SizeType /* elementCount */) {
+    _frames.pop_back();
+    _currentKey = KEY_UNKNOWN;
+    return true;
+}
+
+bool LevelConfigSaxHandler::finishCard() {
+    bool isPlayfieldCard = (cardArrayFrame().type == FRAME_PLAYFIELD);
+
+    if (!_hasCardFace || !_hasCardSuit || (isPlayfieldCard && !_hasPosition)) {
+        return failInvalidCard();
+    }
+
+    // 与DOM解析一致：x、y都存在才使用该坐标
+    if (!_hasPositionX || !_hasPositionY) {
+        _card.position = Vec2::ZERO;
+    }
+
+    if (isPlayfieldCard) {
+        _config->addPlayfieldCard(_card);
+    } else {
+        _config->addStackCard(_card);
+    }
+
+    _frames[_frames.size() - 2].index++;
+    return true;
+}
+
+bool LevelConfigSaxHandler::fail(const std::string& message) {
+    if (_errorMessage.empty()) {
+        _errorMessage = message;
+    }
+    return false;
+}
+
+bool LevelConfigSaxHandler::failInvalidCard() {
+    // 找到最近的卡牌数组帧确定所属区域与下标
+    for (size_t i = _frames.size(); i > 0; i--) {
+        const Frame& frame = _frames[i - 1];
+        if (frame.type == FRAME_PLAYFIELD || frame.type == FRAME_STACK) {
+            return fail(StringUtils::format("Invalid %s card at index %u",
+                                            frame.type == FRAME_PLAYFIELD ? "Playfield" : "Stack",
+                                            frame.index));
+        }
+    }
+    return fail("Invalid card");
+}
+
+LevelConfigSaxHandler::FieldKey LevelConfigSaxHandler::lookupKey(const char* str, rapidjson::SizeType length) {
+    struct KeyEntry {
+        const char* name;
+        FieldKey key;
+    };
+    static const KeyEntry kKeys[] = {
+        { "LevelId", KEY_LEVEL_ID },
+        { "LevelName", KEY_LEVEL_NAME },
+        { "Playfield", KEY_PLAYFIELD },
+        { "Stack", KEY_STACK },
+        { "PlayfieldSize", KEY_PLAYFIELD_SIZE },
+        { "StackSize", KEY_STACK_SIZE },
+        { "CardFace", KEY_CARD_FACE },
+        { "CardSuit", KEY_CARD_SUIT },
+        { "Position", KEY_POSITION },
+        { "x", KEY_X },
+        { "y", KEY_Y },
+        { "width", KEY_WIDTH },
+        { "height", KEY_HEIGHT }
+    };
+
+    for (const auto& entry : kKeys) {
+        if (strlen(entry.name) == length && memcmp(entry.name, str, length) == 0) {
+            return entry.key;
+        }
+    }
+    return KEY_UNKNOWN;
+}
@@ -0,0 +1,166 @@
+#ifndef __LEVEL_CONFIG_SAX_HANDLER_H__
+#define __LEVEL_CONFIG_SAX_HANDLER_H__
+
+#include "../../utils/PlatformShim.h"
+#include "external/json/rapidjson.h"
+#include "external/json/reader.h"
+#include "../models/LevelConfig.h"
+#include <string>
+#include <vector>
+
+USING_NS_CC;
+
+/**
+ * 关卡配置SAX解析处理器
+ * 单遍扫描JSON事件流，边校验边填充LevelConfig与CardConfigData，不构建DOM
+ * 校验规则与原DOM校验一致：
+ * - 根节点必须为对象，且包含Playfield与Stack数组
+ * - 每张卡牌必须为对象，包含整数CardFace与CardSuit
+ * - Playfield中的卡牌还必须包含Position对象
+ * 校验失败时返回false终止解析，错误信息通过getErrorMessage获取
+ */
+class LevelConfigSaxHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, LevelConfigSaxHandler> {
+public:
+    /**
+     * 构造函数
+     * @param config 待填充的关卡配置（调用方持有）
+     */
+    explicit LevelConfigSaxHandler(LevelConfig* config);
+
+    /**
+     * 在可写的以'\0'结尾的缓冲区上就地解析
+     * 缓冲区内容会被改写，解析后不可再作为JSON使用
+     * @param buffer JSON缓冲区
+     * @param config 待填充的关卡配置
+     * @param errorMessage 输出的错误信息
+     * @return 是否解析并通过格式校验
+     */
+    static bool parseInsitu(char* buffer, LevelConfig* config, std::string& errorMessage);
+
+    /**
+     * 解析结束后检查必需字段
+     * @return 是否完整
+     */
+    bool finish();
+
+    /**
+     * 获取错误信息
+     * @return 错误信息，无错误时为空
+     */
+    const std::string& getErrorMessage() const { return _errorMessage; }
+
+    // rapidjson SAX 事件
+    bool Default();
+    bool Null() { return Default(); }
+    bool Bool(bool) { return Default(); }
+    bool Int(int value) { return onNumber(true, value, value); }
+    bool Uint(unsigned value);
+    bool Int64(int64_t value) { return onNumber(false, 0, static_cast<double>(value)); }
+    bool Uint64(uint64_t value) { return onNumber(false, 0, static_cast<double>(value)); }
+    bool Double(double value) { return onNumber(false, 0, value); }
+    bool String(const char* str, rapidjson::SizeType length, bool copy);
+    bool StartObject();
+    bool Key(const char* str, rapidjson::SizeType length, bool copy);
+    bool EndObject(rapidjson::SizeType memberCount);
+    bool StartArray();
+    bool EndArray(rapidjson::SizeType elementCount);
+
+private:
+    /**
+     * 解析上下文
+     */
+    enum FrameType {
+        FRAME_ROOT,             // 根对象
+        FRAME_PLAYFIELD,        // Playfield数组
+        FRAME_STACK,            // Stack数组
+        FRAME_CARD,             // 卡牌对象
+        FRAME_POSITION,         // Position对象
+        FRAME_PLAYFIELD_SIZE,   // PlayfieldSize对象
+        FRAME_STACK_SIZE,       // StackSize对象
+        FRAME_SKIP              // 无关字段，整体跳过
+    };
+
+    /**
+     * 已知字段
+     */
+    enum FieldKey {
+        KEY_UNKNOWN,
+        KEY_LEVEL_ID,
+        KEY_LEVEL_NAME,
+        KEY_PLAYFIELD,
+        KEY_STACK,
+        KEY_PLAYFIELD_SIZE,
+        KEY_STACK_SIZE,
+        KEY_CARD_FACE,
+        KEY_CARD_SUIT,
+        KEY_POSITION,
+        KEY_X,
+        KEY_Y,
+        KEY_WIDTH,
+        KEY_HEIGHT
+    };
+
+    struct Frame {
+        FrameType type;
+        unsigned int index;     // 数组帧：当前元素下标
+    };
+
+    /**
+     * 数值事件
+     * @param isInt 是否可表示为int
+     * @param intValue 整数值
+     * @param value 数值
+     */
+    bool onNumber(bool isInt, int intValue, double value);
+
+    /**
+     * 进入对象或数组
+     * @param isObject 是否为对象
+     */
+    bool onContainerStart(bool isObject);
+
+    /**
+     * 完成一张卡牌
+     */
+    bool finishCard();
+
+    /**
+     * 记录错误并终止解析
+     * @param message 错误信息
+     */
+    bool fail(const std::string& message);
+
+    /**
+     * 记录当前卡牌无效并终止解析
+     */
+    bool failInvalidCard();
+
+    /**
+     * 当前卡牌数组帧（卡牌帧的父帧）
+     */
+    const Frame& cardArrayFrame() const { return _frames[_frames.size() - 2]; }
+
+    static FieldKey lookupKey(const char* str, rapidjson::SizeType length);
+
+    LevelConfig* _config;               // 待填充的关卡配置
+    std::vector<Frame> _frames;         // 上下文栈
+    FieldKey _currentKey;               // 当前对象中的字段
+    std::string _errorMessage;          // 错误信息
+    bool _hasPlayfield;                 // 是否出现Playfield数组
+    bool _hasStack;                     // 是否出现Stack数组
+
+    // 当前卡牌
+    CardConfigData _card;
+    bool _hasCardFace;
+    bool _hasCardSuit;
+    bool _hasPosition;
+    bool _hasPositionX;
+    bool _hasPositionY;
+
+    // 当前尺寸对象
+    Size _size;
+    bool _hasWidth;
+    bool _hasHeight;
+};
+
+#endif // __LEVEL_CONFIG_SAX_HANDLER_H__
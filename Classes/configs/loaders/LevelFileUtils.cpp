@@ -0,0 +1,101 @@
+#include "LevelFileUtils.h"
+#include "external/json/document.h"
+#include <algorithm>
+#include <cstdlib>
+
+const std::string LevelFileUtils::kLevelIndexFileName = "index.json";
+
+std::vector<std::pair<int, std::string>> LevelFileUtils::enumerateLevelFiles(const std::string& directory) {
+    std::vector<std::pair<int, std::string>> levelFiles;
+    auto fileUtils = FileUtils::getInstance();
+
+    std::string normalizedDirectory = directory;
+    if (!normalizedDirectory.empty() && normalizedDirectory[normalizedDirectory.size() - 1] != '/') {
+        normalizedDirectory += "/";
+    }
+
+    // 优先使用关卡包索引，只需一次读取
+    std::string indexPath = normalizedDirectory + kLevelIndexFileName;
+    if (fileUtils->isFileExist(indexPath)) {
+        std::string fullIndexPath = fileUtils->fullPathForFilename(indexPath);
+        std::string fullDirectory = fullIndexPath.substr(0, fullIndexPath.find_last_of("/") + 1);
+
+        std::string content;
+        std::string errorMessage;
+        rapidjson::Document document;
+        if (readFile(fullIndexPath, content, errorMessage)) {
+            document.Parse(content.c_str());
+        }
+        if (!content.empty() && !document.HasParseError() &&
+            document.IsObject() && document.HasMember("Levels") && document["Levels"].IsArray()) {
+            const rapidjson::Value& levels = document["Levels"];
+            levelFiles.reserve(levels.Size());
+            for (rapidjson::SizeType i = 0; i < levels.Size(); i++) {
+                if (!levels[i].IsInt() || levels[i].GetInt() <= 0) {
+                    CCLOG("LevelFileUtils::enumerateLevelFiles - Invalid level id at index %u", i);
+                    continue;
+                }
+                int levelId = levels[i].GetInt();
+                levelFiles.push_back(std::make_pair(levelId, fullDirectory + StringUtils::format("level_%d.json", levelId)));
+            }
+        } else {
+            CCLOG("LevelFileUtils::enumerateLevelFiles - Invalid level index: %s", indexPath.c_str());
+        }
+    }
+
+    // 无索引时列举目录（listFiles返回完整路径，目录以'/'结尾）
+    if (levelFiles.empty()) {
+        for (const auto& path : fileUtils->listFiles(normalizedDirectory)) {
+            int levelId = parseLevelIdFromFileName(path);
+            if (levelId > 0) {
+                levelFiles.push_back(std::make_pair(levelId, path));
+            }
+        }
+    }
+
+    std::sort(levelFiles.begin(), levelFiles.end());
+    levelFiles.erase(std::unique(levelFiles.begin(), levelFiles.end(),
+                                 [](const std::pair<int, std::string>& a, const std::pair<int, std::string>& b) {
+                                     return a.first == b.first;
+                                 }),
+                     levelFiles.end());
+    return levelFiles;
+}
+
+int LevelFileUtils::parseLevelIdFromFileName(const std::string& fileName) {
+    // 期望格式: level_<id>.json
+    size_t slash = fileName.find_last_of("/");
+    std::string name = (slash == std::string::npos) ? fileName : fileName.substr(slash + 1);
+    const std::string kPrefix = "level_";
+    const std::string kSuffix = ".json";
+    if (name.size() <= kPrefix.size() + kSuffix.size()) return -1;
+    if (name.compare(0, kPrefix.size(), kPrefix) != 0) return -1; // 必须以 level_ 开头
+    if (name.compare(name.size() - kSuffix.size(), kSuffix.size(), kSuffix) != 0) return -1;
+    std::string idPart = name.substr(kPrefix.size(), name.size() - kPrefix.size() - kSuffix.size());
+    for (char c : idPart) { if (c < '0' || c > '9') return -1; }
+    return atoi(idPart.c_str());
+}
+
+bool LevelFileUtils::readFile(const std::string& filePath, std::string& content, std::string& errorMessage) {
+    content.clear();
+    FileUtils::Status status = FileUtils::getInstance()->getContents(filePath, &content);
+    if (status != FileUtils::Status::OK) {
+        content.clear();
+        errorMessage = getStatusMessage(status);
+        return false;
+    }
+    return true;
+}
+
+const char* LevelFileUtils::getStatusMessage(FileUtils::Status status) {
+    switch (status) {
+        case FileUtils::Status::OK:                 return "OK";
+        case FileUtils::Status::NotExists:          return "File does not exist";
+        case FileUtils::Status::OpenFailed:         return "Failed to open file";
+        case FileUtils::Status::ReadFailed:         return "Failed to read file";
+        case FileUtils::Status::NotInitialized:     return "File utils not initialized";
+        case FileUtils::Status::TooLarge:           return "File is too large";
+        case FileUtils::Status::ObtainSizeFailed:   return "Failed to obtain file size";
+        default:                                    return "Unknown file error";
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef __LEVEL_FILE_UTILS_H__
+#define __LEVEL_FILE_UTILS_H__
+
+#include "../../utils/PlatformShim.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+USING_NS_CC;
+
+/**
+ * 关卡文件工具
+ * 关卡目录的列举与关卡文件的读取，游戏内的LevelConfigLoader与关卡命令行工具共用。
+ * 只通过FileUtils访问文件系统，不访问其他引擎对象
+ */
+class LevelFileUtils {
+public:
+    /**
+     * 关卡包索引文件名（位于关卡目录下，可选）
+     * 格式：{"Levels": [1, 2, 3]}，存在时不再列举目录
+     */
+    static const std::string kLevelIndexFileName;
+
+    /**
+     * 列举目录中的关卡文件
+     * 优先读取关卡包索引，缺失或无效时列举目录中的level_<id>.json。
+     * 返回的路径为完整路径，工作线程可直接读取
+     * @param directory 关卡目录
+     * @return 关卡ID与完整路径列表，按ID升序且ID不重复
+     */
+    static std::vector<std::pair<int, std::string>> enumerateLevelFiles(const std::string& directory);
+
+    /**
+     * 从文件名解析关卡ID
+     * @param fileName 文件名或路径，期望格式 level_<id>.json
+     * @return 关卡ID，格式不符返回-1
+     */
+    static int parseLevelIdFromFileName(const std::string& fileName);
+
+    /**
+     * 读取文件全部内容
+     * 传入完整路径时不会访问FileUtils的路径缓存，可在工作线程调用
+     * @param filePath 文件路径
+     * @param content 输出的文件内容
+     * @param errorMessage 失败时的错误信息
+     * @return 是否读取成功
+     */
+    static bool readFile(const std::string& filePath, std::string& content, std::string& errorMessage);
+
+    /**
+     * 获取FileUtils读取状态的描述
+     * @param status 读取状态
+     * @return 状态描述
+     */
+    static const char* getStatusMessage(FileUtils::Status status);
+};
+
+#endif // __LEVEL_FILE_UTILS_H__
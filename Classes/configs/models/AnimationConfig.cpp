@@ -17,6 +17,12 @@ void AnimationConfig::resetToDefault() {
     // 默认动画效果配置
     _highlightScaleFactor = 1.1f;
     _clickScaleFactor = 1.2f;
+    
+    // 默认缓动配置（与原MoveTo/ScaleTo一致为线性）
+    _moveEasing = EasingType::LINEAR;
+    _flipEasing = EasingType::LINEAR;
+    _scaleEasing = EasingType::LINEAR;
+    _highlightEasing = EasingType::LINEAR;
 }
 
 bool AnimationConfig::fromJson(const rapidjson::Value& json) {
@@ -51,6 +57,12 @@ bool AnimationConfig::fromJson(const rapidjson::Value& json) {
         _clickScaleFactor = json["ClickScaleFactor"].GetFloat();
     }
     
+    // 解析缓动配置
+    parseEasingMember(json, "MoveEasing", _moveEasing);
+    parseEasingMember(json, "FlipEasing", _flipEasing);
+    parseEasingMember(json, "ScaleEasing", _scaleEasing);
+    parseEasingMember(json, "HighlightEasing", _highlightEasing);
+    
     return isValid();
 }
 
@@ -67,6 +79,12 @@ rapidjson::Value AnimationConfig::toJson(rapidjson::Document::AllocatorType& all
     configJson.AddMember("HighlightScaleFactor", _highlightScaleFactor, allocator);
     configJson.AddMember("ClickScaleFactor", _clickScaleFactor, allocator);
     
+    // 序列化缓动配置
+    configJson.AddMember("MoveEasing", rapidjson::StringRef(getEasingName(_moveEasing)), allocator);
+    configJson.AddMember("FlipEasing", rapidjson::StringRef(getEasingName(_flipEasing)), allocator);
+    configJson.AddMember("ScaleEasing", rapidjson::StringRef(getEasingName(_scaleEasing)), allocator);
+    configJson.AddMember("HighlightEasing", rapidjson::StringRef(getEasingName(_highlightEasing)), allocator);
+    
     return configJson;
 }
 
@@ -108,3 +126,39 @@ std::string AnimationConfig::getSummary() const {
              _scaleAnimationDuration, _highlightAnimationDuration);
     return std::string(buffer);
 }
+
+bool AnimationConfig::parseEasing(const std::string& name, EasingType& easing) {
+    if (name == "Linear") {
+        easing = EasingType::LINEAR;
+    } else if (name == "SineInOut") {
+        easing = EasingType::SINE_IN_OUT;
+    } else if (name == "QuadOut") {
+        easing = EasingType::QUAD_OUT;
+    } else if (name == "CubicOut") {
+        easing = EasingType::CUBIC_OUT;
+    } else if (name == "BackOut") {
+        easing = EasingType::BACK_OUT;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* AnimationConfig::getEasingName(EasingType easing) {
+    switch (easing) {
+        case EasingType::SINE_IN_OUT: return "SineInOut";
+        case EasingType::QUAD_OUT:    return "QuadOut";
+        case EasingType::CUBIC_OUT:   return "CubicOut";
+        case EasingType::BACK_OUT:    return "BackOut";
+        default:                      return "Linear";
+    }
+}
+
+void AnimationConfig::parseEasingMember(const rapidjson::Value& json, const char* key, EasingType& easing) {
+    if (!json.HasMember(key) || !json[key].IsString()) {
+        return;
+    }
+    if (!parseEasing(json[key].GetString(), easing)) {
+        CCLOG("AnimationConfig::fromJson - Unknown easing '%s' for %s", json[key].GetString(), key);
+    }
+}
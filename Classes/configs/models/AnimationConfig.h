@@ -7,6 +7,17 @@
 
 USING_NS_CC;
 
+/**
+ * 缓动类型
+ */
+enum class EasingType {
+    LINEAR,                 // 线性
+    SINE_IN_OUT,            // 正弦缓入缓出
+    QUAD_OUT,               // 二次缓出
+    CUBIC_OUT,              // 三次缓出
+    BACK_OUT                // 回弹缓出（略微越过目标再回到目标）
+};
+
 /**
  * 动画配置类
  * 负责管理游戏中所有动画的时长、效果等配置
@@ -44,6 +55,34 @@ public:
     float getClickScaleFactor() const { return _clickScaleFactor; }
     void setClickScaleFactor(float factor) { _clickScaleFactor = factor; }
     
+    // 缓动配置
+    EasingType getMoveEasing() const { return _moveEasing; }
+    void setMoveEasing(EasingType easing) { _moveEasing = easing; }
+    
+    EasingType getFlipEasing() const { return _flipEasing; }
+    void setFlipEasing(EasingType easing) { _flipEasing = easing; }
+    
+    EasingType getScaleEasing() const { return _scaleEasing; }
+    void setScaleEasing(EasingType easing) { _scaleEasing = easing; }
+    
+    EasingType getHighlightEasing() const { return _highlightEasing; }
+    void setHighlightEasing(EasingType easing) { _highlightEasing = easing; }
+    
+    /**
+     * 解析缓动名称
+     * @param name 缓动名称，如"Linear"、"QuadOut"
+     * @param easing 输出缓动类型
+     * @return 是否为有效名称
+     */
+    static bool parseEasing(const std::string& name, EasingType& easing);
+    
+    /**
+     * 获取缓动名称
+     * @param easing 缓动类型
+     * @return 缓动名称
+     */
+    static const char* getEasingName(EasingType easing);
+    
     /**
      * 从JSON加载配置
      * @param json JSON对象
@@ -85,6 +124,17 @@ private:
     // 动画效果配置
     float _highlightScaleFactor;            // 高亮缩放因子
     float _clickScaleFactor;                // 点击缩放因子
+    
+    // 缓动配置
+    EasingType _moveEasing;                 // 移动动画缓动
+    EasingType _flipEasing;                 // 翻牌动画缓动
+    EasingType _scaleEasing;                // 缩放动画缓动
+    EasingType _highlightEasing;            // 高亮动画缓动
+    
+    /**
+     * 读取缓动字段，名称无效时保留原值
+     */
+    static void parseEasingMember(const rapidjson::Value& json, const char* key, EasingType& easing);
 };
 
 #endif // __ANIMATION_CONFIG_H__
@@ -16,6 +16,11 @@ void DisplayConfig::resetToDefault() {
     _resolutionPolicy = "FIXED_WIDTH";
     _windowTitle = "CardGame";
     
+    // 默认帧率配置（原硬编码60帧），空闲2秒后降到10帧
+    _frameRate = 60.0f;
+    _idleFrameRate = 10.0f;
+    _idleTimeout = 2.0f;
+    
     // 默认支持的分辨率列表（原硬编码值）
     _supportedResolutions = {
         ResolutionInfo("small", 480, 320),
@@ -53,6 +58,19 @@ bool DisplayConfig::fromJson(const rapidjson::Value& json) {
             _windowTitle = display["WindowTitle"].GetString();
         }
         
+        // 解析帧率配置
+        if (display.HasMember("FrameRate") && display["FrameRate"].IsNumber()) {
+            _frameRate = display["FrameRate"].GetFloat();
+        }
+        
+        if (display.HasMember("IdleFrameRate") && display["IdleFrameRate"].IsNumber()) {
+            _idleFrameRate = display["IdleFrameRate"].GetFloat();
+        }
+        
+        if (display.HasMember("IdleTimeout") && display["IdleTimeout"].IsNumber()) {
+            _idleTimeout = display["IdleTimeout"].GetFloat();
+        }
+        
         // 解析支持的分辨率列表
         if (display.HasMember("SupportedResolutions") && display["SupportedResolutions"].IsArray()) {
             const rapidjson::Value& resolutions = display["SupportedResolutions"];
@@ -87,6 +105,11 @@ rapidjson::Value DisplayConfig::toJson(rapidjson::Document::AllocatorType& alloc
     rapidjson::Value titleValue(_windowTitle.c_str(), allocator);
     displayJson.AddMember("WindowTitle", titleValue, allocator);
     
+    // 序列化帧率配置
+    displayJson.AddMember("FrameRate", _frameRate, allocator);
+    displayJson.AddMember("IdleFrameRate", _idleFrameRate, allocator);
+    displayJson.AddMember("IdleTimeout", _idleTimeout, allocator);
+    
     // 序列化支持的分辨率列表
     rapidjson::Value resolutionsArray(rapidjson::kArrayType);
     for (const auto& resolution : _supportedResolutions) {
@@ -115,6 +138,19 @@ bool DisplayConfig::isValid() const {
         return false;
     }
     
+    // 检查帧率有效性：空闲帧率不高于正常帧率
+    if (_frameRate <= 0.0f || _frameRate > 240.0f) {
+        return false;
+    }
+    
+    if (_idleFrameRate <= 0.0f || _idleFrameRate > _frameRate) {
+        return false;
+    }
+    
+    if (_idleTimeout < 0.0f) {
+        return false;
+    }
+    
     // 检查支持的分辨率列表
     for (const auto& resolution : _supportedResolutions) {
         if (!isValidResolutionInfo(resolution)) {
@@ -128,10 +164,11 @@ bool DisplayConfig::isValid() const {
 std::string DisplayConfig::getSummary() const {
     char buffer[256];
     snprintf(buffer, sizeof(buffer),
-             "Display - Design:%dx%d Scale:%.1f Policy:%s Resolutions:%zu",
+             "Display - Design:%dx%d Scale:%.1f Policy:%s Resolutions:%zu FPS:%.0f/%.0f IdleTimeout:%.1f",
              _designResolution.width, _designResolution.height,
              _windowScale, _resolutionPolicy.c_str(),
-             _supportedResolutions.size());
+             _supportedResolutions.size(),
+             _frameRate, _idleFrameRate, _idleTimeout);
     return std::string(buffer);
 }
 
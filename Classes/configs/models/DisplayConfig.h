@@ -55,6 +55,16 @@ public:
     std::string getWindowTitle() const { return _windowTitle; }
     void setWindowTitle(const std::string& title) { _windowTitle = title; }
     
+    // 帧率配置：有动画或输入时按FrameRate渲染，空闲IdleTimeout秒后降到IdleFrameRate
+    float getFrameRate() const { return _frameRate; }
+    void setFrameRate(float frameRate) { _frameRate = frameRate; }
+    
+    float getIdleFrameRate() const { return _idleFrameRate; }
+    void setIdleFrameRate(float frameRate) { _idleFrameRate = frameRate; }
+    
+    float getIdleTimeout() const { return _idleTimeout; }
+    void setIdleTimeout(float timeout) { _idleTimeout = timeout; }
+    
     // 支持的分辨率配置
     std::vector<ResolutionInfo> getSupportedResolutions() const { return _supportedResolutions; }
     void setSupportedResolutions(const std::vector<ResolutionInfo>& resolutions) { _supportedResolutions = resolutions; }
@@ -100,6 +110,9 @@ private:
     float _windowScale;                             // 窗口缩放比例
     std::string _resolutionPolicy;                  // 分辨率策略
     std::string _windowTitle;                       // 窗口标题
+    float _frameRate;                               // 正常帧率
+    float _idleFrameRate;                           // 空闲帧率，等于正常帧率时不降帧
+    float _idleTimeout;                             // 无动画无输入多少秒后进入空闲
     std::vector<ResolutionInfo> _supportedResolutions; // 支持的分辨率列表
     
     /**
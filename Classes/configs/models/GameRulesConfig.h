@@ -1,7 +1,7 @@
 #ifndef __GAME_RULES_CONFIG_H__
 #define __GAME_RULES_CONFIG_H__
 
-#include "cocos2d.h"
+#include "../../utils/PlatformShim.h"
 #include "external/json/rapidjson.h"
 #include "external/json/document.h"
 
@@ -1,4 +1,5 @@
 #include "LevelConfig.h"
+#include <cstring>
 
 // CardConfigData 实现
 rapidjson::Value CardConfigData::toJson(rapidjson::Document::AllocatorType& allocator) const {
@@ -38,7 +39,8 @@ LevelConfig::LevelConfig()
     : _levelId(0)
     , _levelName("")
     , _playfieldSize(Size(1080, 1500))  // 默认主牌区尺寸
-    , _stackSize(Size(1080, 580)) {     // 默认堆牌区尺寸
+    , _stackSize(Size(1080, 580))       // 默认堆牌区尺寸
+    , _contentHash(0) {
 }
 
 LevelConfig::~LevelConfig() {
@@ -114,6 +116,66 @@ std::string LevelConfig::getSummary() const {
     return std::string(buffer);
 }
 
+size_t LevelConfig::getMemoryFootprint() const {
+    return sizeof(LevelConfig)
+        + _levelName.capacity()
+        + _playfieldCards.capacity() * sizeof(CardConfigData)
+        + _stackCards.capacity() * sizeof(CardConfigData);
+}
+
+// 内容哈希格式版本，哈希覆盖的字段变化时递增
+static const uint32_t kContentHashVersion = 1;
+
+/**
+ * FNV-1a：按小端字节序累加32位整数，保证跨平台结果一致
+ */
+static void hashUInt32(uint64_t& hash, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        hash ^= static_cast<uint64_t>((value >> (i * 8)) & 0xff);
+        hash *= 1099511628211ULL;
+    }
+}
+
+/**
+ * 浮点数按位累加，-0与+0视为相同
+ */
+static void hashFloat(uint64_t& hash, float value) {
+    if (value == 0.0f) {
+        value = 0.0f;
+    }
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    hashUInt32(hash, bits);
+}
+
+uint64_t LevelConfig::computeContentHash() const {
+    uint64_t hash = 14695981039346656037ULL;
+    hashUInt32(hash, kContentHashVersion);
+
+    // 桌面牌：位置决定遮挡关系，计入哈希
+    hashUInt32(hash, static_cast<uint32_t>(_playfieldCards.size()));
+    for (const auto& card : _playfieldCards) {
+        hashUInt32(hash, static_cast<uint32_t>(card.cardFace));
+        hashUInt32(hash, static_cast<uint32_t>(card.cardSuit));
+        hashFloat(hash, card.position.x);
+        hashFloat(hash, card.position.y);
+    }
+
+    // 手牌堆：按顺序排布，位置不影响玩法
+    hashUInt32(hash, static_cast<uint32_t>(_stackCards.size()));
+    for (const auto& card : _stackCards) {
+        hashUInt32(hash, static_cast<uint32_t>(card.cardFace));
+        hashUInt32(hash, static_cast<uint32_t>(card.cardSuit));
+    }
+
+    hashFloat(hash, _playfieldSize.width);
+    hashFloat(hash, _playfieldSize.height);
+    hashFloat(hash, _stackSize.width);
+    hashFloat(hash, _stackSize.height);
+
+    return hash;
+}
+
 rapidjson::Value LevelConfig::toJson(rapidjson::Document::AllocatorType& allocator) const {
     rapidjson::Value levelJson(rapidjson::kObjectType);
     
@@ -195,6 +257,7 @@ void LevelConfig::reset() {
     _stackCards.clear();
     _playfieldSize = Size(1080, 1500);
     _stackSize = Size(1080, 580);
+    _contentHash = 0;
 }
 
 rapidjson::Value LevelConfig::serializeCardArray(const std::vector<CardConfigData>& cards,
@@ -1,12 +1,13 @@
 #ifndef __LEVEL_CONFIG_H__
 #define __LEVEL_CONFIG_H__
 
-#include "cocos2d.h"
+#include "../../utils/PlatformShim.h"
 #include "external/json/rapidjson.h"
 #include "external/json/document.h"
 #include "../../models/CardModel.h"
 #include <vector>
 #include <memory>
+#include <cstdint>
 
 USING_NS_CC;
 
@@ -98,6 +99,34 @@ public:
      */
     std::string getSummary() const;
     
+    /**
+     * 估算配置占用的内存字节数
+     * 按卡牌数组与名称的实际容量计算，供缓存做预算统计
+     * @return 字节数
+     */
+    size_t getMemoryFootprint() const;
+    
+    /**
+     * 计算内容哈希（FNV-1a 64位）
+     * 覆盖桌面牌（牌面、花色、位置）、手牌堆（牌面、花色，按顺序）与区域尺寸，
+     * 不含关卡ID和名称，与JSON排版、字段顺序无关
+     * 内容相同的关卡哈希相同，可用于去重，以及按内容缓存求解结果、难度指标、缩略图等
+     * @return 内容哈希
+     */
+    uint64_t computeContentHash() const;
+    
+    /**
+     * 获取加载时计算的内容哈希
+     * 加载后修改卡牌或尺寸需调用updateContentHash
+     * @return 内容哈希，未计算时为0
+     */
+    uint64_t getContentHash() const { return _contentHash; }
+    
+    /**
+     * 重新计算并缓存内容哈希
+     */
+    void updateContentHash() { _contentHash = computeContentHash(); }
+    
     /**
      * 序列化到JSON
      * @return JSON对象
@@ -123,6 +152,7 @@ private:
     std::vector<CardConfigData> _stackCards;        // 手牌堆卡牌配置
     Size _playfieldSize;                            // 主牌区尺寸 (1080*1500)
     Size _stackSize;                                // 堆牌区尺寸 (1080*580)
+    uint64_t _contentHash;                          // 内容哈希
     
     /**
      * 序列化卡牌配置数组
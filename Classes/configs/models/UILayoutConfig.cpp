@@ -13,6 +13,10 @@ void UILayoutConfig::resetToDefault() {
     _currentCardPosition = Vec2(300, 200);
     _playfieldAreaOffset = Vec2(0, 300);
     
+    // 默认桌面视口配置（与默认桌面尺寸一致，普通关卡无需平移缩放）
+    _playfieldViewportSize = Size(1080, 1500);
+    _playfieldMaxZoom = 2.0f;
+    
     // 默认间距配置
     _stackCardOffset = 30.0f;
     
@@ -47,6 +51,19 @@ bool UILayoutConfig::fromJson(const rapidjson::Value& json) {
         _playfieldAreaOffset = parseVec2FromJson(json["PlayfieldAreaOffset"]);
     }
     
+    // 解析桌面视口配置
+    if (json.HasMember("PlayfieldViewportSize") && json["PlayfieldViewportSize"].IsObject()) {
+        const rapidjson::Value& size = json["PlayfieldViewportSize"];
+        if (size.HasMember("width") && size["width"].IsNumber() &&
+            size.HasMember("height") && size["height"].IsNumber()) {
+            _playfieldViewportSize = Size(size["width"].GetFloat(), size["height"].GetFloat());
+        }
+    }
+    
+    if (json.HasMember("PlayfieldMaxZoom") && json["PlayfieldMaxZoom"].IsNumber()) {
+        _playfieldMaxZoom = json["PlayfieldMaxZoom"].GetFloat();
+    }
+    
     // 解析间距配置
     if (json.HasMember("StackCardOffset") && json["StackCardOffset"].IsNumber()) {
         _stackCardOffset = json["StackCardOffset"].GetFloat();
@@ -113,6 +130,13 @@ rapidjson::Value UILayoutConfig::toJson(rapidjson::Document::AllocatorType& allo
     configJson.AddMember("CurrentCardPosition", serializeVec2ToJson(_currentCardPosition, allocator), allocator);
     configJson.AddMember("PlayfieldAreaOffset", serializeVec2ToJson(_playfieldAreaOffset, allocator), allocator);
     
+    // 序列化桌面视口配置
+    rapidjson::Value viewportSizeJson(rapidjson::kObjectType);
+    viewportSizeJson.AddMember("width", _playfieldViewportSize.width, allocator);
+    viewportSizeJson.AddMember("height", _playfieldViewportSize.height, allocator);
+    configJson.AddMember("PlayfieldViewportSize", viewportSizeJson, allocator);
+    configJson.AddMember("PlayfieldMaxZoom", _playfieldMaxZoom, allocator);
+    
     // 序列化间距配置
     configJson.AddMember("StackCardOffset", _stackCardOffset, allocator);
     
@@ -126,6 +150,18 @@ rapidjson::Value UILayoutConfig::toJson(rapidjson::Document::AllocatorType& allo
     configJson.AddMember("StackBackgroundWidthRatio", _stackBgWidthRatio, allocator);
     configJson.AddMember("StackBackgroundHeight", _stackBgHeight, allocator);
     
+    // 序列化按钮配置
+    rapidjson::Value undoBtnJson(rapidjson::kObjectType);
+    undoBtnJson.AddMember("Position", serializeVec2ToJson(_undoButtonConfig.position, allocator), allocator);
+    rapidjson::Value sizeJson(rapidjson::kObjectType);
+    sizeJson.AddMember("width", _undoButtonConfig.size.width, allocator);
+    sizeJson.AddMember("height", _undoButtonConfig.size.height, allocator);
+    undoBtnJson.AddMember("Size", sizeJson, allocator);
+    rapidjson::Value textValue(_undoButtonConfig.text.c_str(), allocator);
+    undoBtnJson.AddMember("Text", textValue, allocator);
+    undoBtnJson.AddMember("FontSize", _undoButtonConfig.fontSize, allocator);
+    configJson.AddMember("UndoButton", undoBtnJson, allocator);
+    
     return configJson;
 }
 
@@ -143,6 +179,14 @@ bool UILayoutConfig::isValid() const {
         return false;
     }
     
+    if (_playfieldViewportSize.width <= 0 || _playfieldViewportSize.height <= 0) {
+        return false;
+    }
+    
+    if (_playfieldMaxZoom < 1.0f) {
+        return false;
+    }
+    
     return true;
 }
 
@@ -62,6 +62,13 @@ public:
     Vec2 getPlayfieldAreaOffset() const { return _playfieldAreaOffset; }
     void setPlayfieldAreaOffset(const Vec2& offset) { _playfieldAreaOffset = offset; }
     
+    // 桌面视口配置（桌面尺寸超过视口时可平移、缩放）
+    Size getPlayfieldViewportSize() const { return _playfieldViewportSize; }
+    void setPlayfieldViewportSize(const Size& size) { _playfieldViewportSize = size; }
+    
+    float getPlayfieldMaxZoom() const { return _playfieldMaxZoom; }
+    void setPlayfieldMaxZoom(float zoom) { _playfieldMaxZoom = zoom; }
+    
     // 间距配置
     float getStackCardOffset() const { return _stackCardOffset; }
     void setStackCardOffset(float offset) { _stackCardOffset = offset; }
@@ -121,6 +128,10 @@ private:
     Vec2 _currentCardPosition;              // 底牌位置
     Vec2 _playfieldAreaOffset;              // 桌面区域偏移
     
+    // 桌面视口配置
+    Size _playfieldViewportSize;            // 桌面视口尺寸
+    float _playfieldMaxZoom;                // 桌面最大缩放
+    
     // 间距配置
     float _stackCardOffset;                 // 手牌堆卡牌间距
     
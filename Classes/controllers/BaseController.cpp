@@ -102,9 +102,8 @@ Node* BaseController::getOverlayParent(CardView* cardView) {
         return nullptr;
     }
     
-    Node* parent = cardView->getParent();
-    // 通常覆盖层是父节点的父节点（GameView）
-    return (parent && parent->getParent()) ? parent->getParent() : parent;
+    // 卡牌始终挂在CardLayer下，动画覆盖层是同一父节点中的z段
+    return cardView->getParent();
 }
 
 BaseController::AnimationCoordinates BaseController::calculateAnimationCoordinates(
@@ -148,25 +147,29 @@ void BaseController::moveCardWithAnimation(CardView* cardView,
         return;
     }
     
-    // 获取覆盖层父节点
-    Node* overlayParent = getOverlayParent(cardView);
-    if (!overlayParent) {
-        CCLOG("BaseController::moveCardWithAnimation - No overlay parent found");
+    // 获取卡牌层
+    auto cardLayer = dynamic_cast<CardLayer*>(getOverlayParent(cardView));
+    if (!cardLayer) {
+        CCLOG("BaseController::moveCardWithAnimation - No card layer found");
         if (callback) callback(false);
         return;
     }
     
-    // 计算动画坐标
-    auto coords = calculateAnimationCoordinates(cardView, targetWorldPosition, overlayParent);
+    // 计算动画坐标（覆盖层z段的原点即卡牌层原点）
+    auto coords = calculateAnimationCoordinates(cardView, targetWorldPosition, cardLayer);
     
-    // 提升到覆盖层并设置起始位置
-    cardView->retain();
-    cardView->removeFromParent();
-    overlayParent->addChild(cardView, animationZOrder);
-    cardView->setPosition(coords.startPosition);
+    // 提升到覆盖层z段并设置起始位置
+    float startScale = cardView->getBandScale();
+    cardLayer->placeCard(cardView, CardBand::OVERLAY, coords.startPosition, animationZOrder);
     
     // 播放移动动画
     auto animationConfig = _configManager->getAnimationConfig();
+    
+    // 从缩放的桌面镜头中移出时，从原来的大小缩放回覆盖层的原始大小
+    if (startScale != 1.0f) {
+        cardView->setScale(startScale);
+        cardView->playScaleAnimation(1.0f, animationConfig->getMoveAnimationDuration());
+    }
     cardView->playMoveAnimation(coords.targetPosition, 
                                animationConfig->getMoveAnimationDuration(), 
                                [callback]() {
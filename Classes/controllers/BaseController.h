@@ -6,6 +6,7 @@
 #include "../models/CardModel.h"
 #include "../models/UndoModel.h"
 #include "../views/CardView.h"
+#include "../views/CardLayer.h"
 #include "../managers/UndoManager.h"
 #include "../managers/ConfigManager.h"
 #include <memory>
@@ -81,7 +82,7 @@ protected:
     Vec2 getWorldPosition(CardView* cardView);
     
     /**
-     * 获取覆盖层父节点（通常是GameView）
+     * 获取覆盖层父节点（卡牌所在的CardLayer，动画覆盖层是其中的一个z段）
      * @param cardView 卡牌视图
      * @return 覆盖层父节点
      */
@@ -104,9 +105,10 @@ protected:
     
     /**
      * 通用的卡牌动画移动方法
+     * 卡牌提升到CardLayer的动画覆盖层z段后移动，只修改z序与位置，不改动节点树
      * @param cardView 要移动的卡牌视图
      * @param targetWorldPosition 目标世界坐标
-     * @param animationZOrder 动画时的Z顺序
+     * @param animationZOrder 动画时在覆盖层内的Z顺序
      * @param callback 动画完成回调
      */
     void moveCardWithAnimation(CardView* cardView, 
@@ -1,18 +1,34 @@
 #include "GameController.h"
+#include "base/CCAsyncTaskPool.h"
+#include <chrono>
 
 GameController::GameController()
     : _gameView(nullptr)
+    , _engineContext(nullptr)
     , _gameModel(nullptr)
     , _levelConfig(nullptr)
+    , _configLoader(nullptr)
     , _playfieldController(nullptr)
     , _stackController(nullptr)
     , _undoManager(nullptr)
     , _undoController(nullptr)
     , _currentLevelId(0)
-    , _isInitialized(false) {
+    , _pinnedLevelId(0)
+    , _isInitialized(false)
+    , _startRequestId(0)
+    , _aliveToken(std::make_shared<bool>(true))
+    , _lastStartDurationMs(0.0)
+    , _lastStartFrameCount(0)
+    , _prepareRequestId(0) {
 }
 
 GameController::~GameController() {
+    // 释放当前关卡在配置缓存中的钉住
+    if (_configLoader && _pinnedLevelId > 0) {
+        _configLoader->unpinLevel(_pinnedLevelId);
+        _pinnedLevelId = 0;
+    }
+
     // 清理子控制器
     if (_playfieldController) {
         delete _playfieldController;
@@ -42,7 +58,9 @@ bool GameController::init(GameView* gameView) {
     }
     
     _gameView = gameView;
-    _gameModel = std::make_shared<GameModel>();
+    _engineContext = createEngineContext(ConfigManager::getInstance()->getSnapshot());
+    _gameModel = std::make_shared<GameModel>(_engineContext);
+    _configLoader = ConfigManager::getInstance()->getLevelConfigLoader();
 
     // 创建子控制器
     _playfieldController = new PlayFieldController();
@@ -64,26 +82,132 @@ bool GameController::startGame(int levelId) {
 
     // starting level
 
+    // 同步开局会取代尚未完成的异步请求
+    ++_startRequestId;
+
     // 按照README要求的初始化流程：
 
     // 1. 调用LevelConfigLoader::loadLevelConfig(levelId)获取LevelConfig
-    _levelConfig = _configLoader.loadLevelConfig(levelId);
-    if (!_levelConfig) {
+    auto levelConfig = _configLoader->loadLevelConfig(levelId);
+    if (!levelConfig) {
         CCLOG("GameController::startGame - Failed to load level config for level %d", levelId);
 
         // 配置文件缺失，无法继续
         return false;
     }
 
-    _currentLevelId = levelId;
-
     // 2. 使用GameModelFromLevelGenerator::generateGameModel生成GameModel
-    _gameModel = GameModelFromLevelGenerator::generateGameModel(_levelConfig);
-    if (!_gameModel) {
+    auto engineContext = createEngineContext(ConfigManager::getInstance()->getSnapshot());
+    auto gameModel = GameModelFromLevelGenerator::generateGameModel(engineContext, levelConfig);
+    if (!gameModel) {
         CCLOG("GameController::startGame - Failed to generate game model");
         return false;
     }
 
+    // 3~5. 初始化子控制器与视图
+    return finishStartGame(levelId, levelConfig, gameModel);
+}
+
+void GameController::startGameAsync(int levelId, const StartGameCallback& callback) {
+    if (!_isInitialized) {
+        CCLOG("GameController::startGameAsync - Controller not initialized");
+        if (callback) {
+            callback(false);
+        }
+        return;
+    }
+
+    int requestId = ++_startRequestId;
+    std::weak_ptr<bool> aliveToken = _aliveToken;
+
+    // 记录请求时间与帧序号，视图建好后统计点击到首帧的耗时
+    auto requestTime = std::chrono::steady_clock::now();
+    unsigned int requestFrame = Director::getInstance()->getTotalFrames();
+
+    // 已预先准备好这一关：本帧直接完成开局
+    std::shared_ptr<LevelConfig> preparedConfig;
+    std::shared_ptr<GameModel> preparedModel;
+    if (takePreparedGame(levelId, preparedConfig, preparedModel)) {
+        bool success = finishStartGame(levelId, preparedConfig, preparedModel);
+        _lastStartDurationMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - requestTime).count();
+        _lastStartFrameCount = 0;
+        CCLOG("GameController::startGameAsync - Level %d ready in %.2f ms from prepared game", levelId, _lastStartDurationMs);
+        if (callback) {
+            callback(success);
+        }
+        return;
+    }
+
+    // 1. 工作线程读取并解析LevelConfig（命中预取缓存时立即返回）
+    _configLoader->loadLevelConfigAsync(levelId, [this, aliveToken, requestId, levelId, callback, requestTime, requestFrame](std::shared_ptr<LevelConfig> levelConfig) {
+        if (aliveToken.expired() || requestId != _startRequestId) {
+            return;
+        }
+
+        if (!levelConfig) {
+            CCLOG("GameController::startGameAsync - Failed to load level config for level %d", levelId);
+            if (callback) {
+                callback(false);
+            }
+            return;
+        }
+
+        // 2. 工作线程生成GameModel
+        auto gameModel = std::make_shared<std::shared_ptr<GameModel>>();
+        auto engineContext = createEngineContext(ConfigManager::getInstance()->getSnapshot());
+        auto configTime = std::chrono::steady_clock::now();
+        AsyncTaskPool::getInstance()->enqueue(AsyncTaskPool::TaskType::TASK_OTHER,
+            [this, aliveToken, requestId, levelId, levelConfig, gameModel, callback, requestTime, requestFrame, configTime](void*) {
+                // 3~5. 回到主线程初始化子控制器与视图
+                if (aliveToken.expired() || requestId != _startRequestId) {
+                    return;
+                }
+
+                bool success = false;
+                if (*gameModel) {
+                    auto modelTime = std::chrono::steady_clock::now();
+                    success = finishStartGame(levelId, levelConfig, *gameModel);
+
+                    // 视图在本帧绘制：帧数为0表示点击所在的帧即显示关卡
+                    auto viewTime = std::chrono::steady_clock::now();
+                    _lastStartDurationMs = std::chrono::duration<double, std::milli>(viewTime - requestTime).count();
+                    _lastStartFrameCount = Director::getInstance()->getTotalFrames() - requestFrame;
+                    CCLOG("GameController::startGameAsync - Level %d ready in %.2f ms, %u frames after request "
+                          "(config %.2f ms, model %.2f ms, views %.2f ms)",
+                          levelId, _lastStartDurationMs, _lastStartFrameCount,
+                          std::chrono::duration<double, std::milli>(configTime - requestTime).count(),
+                          std::chrono::duration<double, std::milli>(modelTime - configTime).count(),
+                          std::chrono::duration<double, std::milli>(viewTime - modelTime).count());
+                } else {
+                    CCLOG("GameController::startGameAsync - Failed to generate game model");
+                }
+
+                if (callback) {
+                    callback(success);
+                }
+            },
+            nullptr,
+            [engineContext, levelConfig, gameModel]() {
+                *gameModel = GameModelFromLevelGenerator::generateGameModel(engineContext, levelConfig);
+            });
+    });
+}
+
+bool GameController::finishStartGame(int levelId, std::shared_ptr<LevelConfig> levelConfig, std::shared_ptr<GameModel> gameModel) {
+    _levelConfig = levelConfig;
+    _gameModel = gameModel;
+    _engineContext = gameModel->getEngineContext();
+    _currentLevelId = levelId;
+
+    // 当前关卡常驻缓存，重开时无需重新解析
+    if (_pinnedLevelId != levelId) {
+        _configLoader->pinLevel(levelId);
+        if (_pinnedLevelId > 0) {
+            _configLoader->unpinLevel(_pinnedLevelId);
+        }
+        _pinnedLevelId = levelId;
+    }
+
     // 3. 初始化各子控制器
     if (!initializeSubControllers()) {
         CCLOG("GameController::startGame - Failed to initialize sub controllers");
@@ -112,6 +236,65 @@ bool GameController::startGame(int levelId) {
         _stackController->initialDealCurrentFromStack();
     }
 
+    // 准备下一关，玩家通关后可直接开局
+    prepareGame(levelId + 1);
+
+    return true;
+}
+
+std::shared_ptr<EngineContext> GameController::createEngineContext(std::shared_ptr<const ConfigSnapshot> snapshot) {
+    // 快照发布后不再修改，生成GameModel的工作线程可以安全读取
+    return std::make_shared<EngineContext>(snapshot ? snapshot->gameRulesConfig : nullptr);
+}
+
+void GameController::prepareGame(int levelId) {
+    int requestId = ++_prepareRequestId;
+    _preparedGame = PreparedGame();
+    std::weak_ptr<bool> aliveToken = _aliveToken;
+
+    _configLoader->prefetchLevelConfig(levelId, [this, aliveToken, requestId, levelId](std::shared_ptr<LevelConfig> levelConfig) {
+        if (aliveToken.expired() || requestId != _prepareRequestId || !levelConfig) {
+            return;
+        }
+
+        // 工作线程只读取这里取得的快照，代数与生成结果一起缓存
+        auto snapshot = ConfigManager::getInstance()->getSnapshot();
+        uint64_t configGeneration = snapshot ? snapshot->generation : 0;
+        auto engineContext = createEngineContext(snapshot);
+        auto gameModel = std::make_shared<std::shared_ptr<GameModel>>();
+        AsyncTaskPool::getInstance()->enqueue(AsyncTaskPool::TaskType::TASK_OTHER,
+            [this, aliveToken, requestId, levelId, configGeneration, levelConfig, gameModel](void*) {
+                if (aliveToken.expired() || requestId != _prepareRequestId || !*gameModel) {
+                    return;
+                }
+                _preparedGame.levelId = levelId;
+                _preparedGame.configGeneration = configGeneration;
+                _preparedGame.levelConfig = levelConfig;
+                _preparedGame.gameModel = *gameModel;
+            },
+            nullptr,
+            [engineContext, levelConfig, gameModel]() {
+                *gameModel = GameModelFromLevelGenerator::generateGameModel(engineContext, levelConfig);
+            });
+    });
+}
+
+bool GameController::takePreparedGame(int levelId, std::shared_ptr<LevelConfig>& levelConfig,
+                                      std::shared_ptr<GameModel>& gameModel) {
+    if (_preparedGame.levelId != levelId || !_preparedGame.gameModel) {
+        return false;
+    }
+
+    // 准备好的一局只能使用一次
+    PreparedGame prepared = _preparedGame;
+    _preparedGame = PreparedGame();
+    if (prepared.configGeneration != ConfigManager::getInstance()->getSnapshotGeneration()) {
+        CCLOG("GameController::takePreparedGame - Config reloaded since level %d was prepared, regenerating", levelId);
+        return false;
+    }
+
+    levelConfig = prepared.levelConfig;
+    gameModel = prepared.gameModel;
     return true;
 }
 
@@ -155,7 +338,7 @@ bool GameController::initializeSubControllers() {
     // 按照README要求初始化各子控制器：
 
     // UndoManager::init(...)
-    if (!_undoManager->init(_gameModel)) {
+    if (!_undoManager->init(_gameModel, _engineContext)) {
         CCLOG("GameController::initializeSubControllers - Failed to init UndoManager");
         return false;
     }
@@ -335,10 +518,10 @@ void GameController::updateCurrentCardDisplay() {
     
     // updating current card
     
-    // 创建新的底牌视图
-    auto newCurrentCardView = CardView::create(currentCard);
+    // 从对象池取出底牌视图
+    auto newCurrentCardView = _gameView->acquireCardView(currentCard);
     if (!newCurrentCardView) {
-        CCLOG("GameController::updateCurrentCardDisplay - Failed to create card view");
+        CCLOG("GameController::updateCurrentCardDisplay - Failed to acquire card view");
         return;
     }
     
@@ -349,17 +532,14 @@ void GameController::updateCurrentCardDisplay() {
         return;
     }
     
-    // 清除旧的底牌视图
-    currentCardArea->removeAllChildren();
-    
-    // 添加新的底牌视图
-    currentCardArea->addChild(newCurrentCardView, 300);
-    newCurrentCardView->setPosition(Vec2(0, 0)); // 居中显示
+    // 添加新的底牌视图（旧底牌视图在本帧视图调和时移除）
+    _gameView->getCardLayer()->placeCard(newCurrentCardView, CardBand::CURRENT, Vec2::ZERO, 300); // 居中显示
     newCurrentCardView->setFlipped(true, false);  // 正面显示，无动画
     newCurrentCardView->setEnabled(false);        // 底牌不可点击
     
     // 更新GameView的引用
     _gameView->setCurrentCardView(newCurrentCardView);
+    _gameView->markCurrentCardDirty();
     
     // 关键修复：同步更新PlayFieldController的引用
     if (_playfieldController) {
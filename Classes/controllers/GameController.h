@@ -9,10 +9,13 @@
 #include "../views/GameView.h"
 #include "../views/CardView.h"
 #include "../managers/UndoManager.h"
+#include "../managers/EngineContext.h"
+#include "../managers/ConfigManager.h"
 #include "PlayFieldController.h"
 #include "StackController.h"
 #include "UndoController.h"
 #include <memory>
+#include <functional>
 
 USING_NS_CC;
 
@@ -24,6 +27,12 @@ USING_NS_CC;
  */
 class GameController {
 public:
+    /**
+     * 异步开始游戏的完成回调（主线程调用）
+     * 参数为是否开始成功
+     */
+    typedef std::function<void(bool)> StartGameCallback;
+
     /**
      * 构造函数
      */
@@ -54,6 +63,16 @@ public:
      */
     bool startGame(int levelId);
     
+    /**
+     * 异步开始游戏
+     * 关卡配置的读取解析与GameModel生成在工作线程完成，
+     * 之后回到主线程执行子控制器与视图的初始化（即startGame的第3~5步）
+     * 重复调用时只有最后一次请求生效；控制器销毁后回调不再执行
+     * @param levelId 关卡ID
+     * @param callback 完成回调
+     */
+    void startGameAsync(int levelId, const StartGameCallback& callback);
+    
     /**
      * 重新开始当前关卡
      * @return 是否重新开始成功
@@ -82,6 +101,19 @@ public:
      */
     int getCurrentLevelId() const;
     
+    /**
+     * 获取上次异步开局从请求到视图建好的耗时（含读取解析、生成与建视图）
+     * @return 耗时（毫秒）
+     */
+    double getLastStartDurationMs() const { return _lastStartDurationMs; }
+    
+    /**
+     * 获取上次异步开局从请求到视图建好之间已完成的帧数
+     * 为0时关卡在请求所在的帧即绘制出来
+     * @return 帧数
+     */
+    unsigned int getLastStartFrameCount() const { return _lastStartFrameCount; }
+    
     /**
      * 获取游戏数据模型
      * @return 游戏数据模型
@@ -125,6 +157,16 @@ public:
     bool performUndo();
 
 protected:
+    /**
+     * 用已就绪的配置与模型完成开局（主线程）
+     * 初始化子控制器与视图、发初始底牌，并准备下一关
+     * @param levelId 关卡ID
+     * @param levelConfig 关卡配置
+     * @param gameModel 生成的游戏模型
+     * @return 是否开始成功
+     */
+    bool finishStartGame(int levelId, std::shared_ptr<LevelConfig> levelConfig, std::shared_ptr<GameModel> gameModel);
+
     /**
      * 初始化各子控制器
      * 按照README要求：PlayFieldController::init, StackController::init, UndoManager::init
@@ -145,6 +187,31 @@ protected:
      */
     bool initializeGameView();
 
+    /**
+     * 创建一局游戏的引擎上下文
+     * 规则取自配置快照，开局之后的热重载不影响进行中的对局
+     * @param snapshot 配置快照，为nullptr（配置尚未加载）时使用默认规则
+     * @return 引擎上下文
+     */
+    static std::shared_ptr<EngineContext> createEngineContext(std::shared_ptr<const ConfigSnapshot> snapshot);
+
+    /**
+     * 预先准备一局：预取关卡配置，并在工作线程按当前配置快照生成GameModel
+     * startGameAsync开始同一关卡时直接使用；只保留最近一次准备的关卡
+     * @param levelId 关卡ID
+     */
+    void prepareGame(int levelId);
+
+    /**
+     * 取出为指定关卡准备好的一局（主线程）
+     * 准备时的快照代数与当前代数不同（规则已热重载）时丢弃，需重新生成
+     * @param levelId 关卡ID
+     * @param levelConfig 输出关卡配置
+     * @param gameModel 输出游戏模型
+     * @return 是否有可用的准备结果
+     */
+    bool takePreparedGame(int levelId, std::shared_ptr<LevelConfig>& levelConfig, std::shared_ptr<GameModel>& gameModel);
+
     /**
      * 处理桌面牌点击事件
      * @param success 操作是否成功
@@ -186,11 +253,24 @@ protected:
     void updateCurrentCardDisplay();
 
 private:
+    /**
+     * 预先生成的一局，按生成时的配置快照代数缓存
+     */
+    struct PreparedGame {
+        int levelId;                                    // 关卡ID，0表示没有
+        uint64_t configGeneration;                      // 生成时的配置快照代数
+        std::shared_ptr<LevelConfig> levelConfig;       // 关卡配置
+        std::shared_ptr<GameModel> gameModel;           // 生成的游戏模型
+
+        PreparedGame() : levelId(0), configGeneration(0) {}
+    };
+
     // 核心组件
     GameView* _gameView;                                // 游戏视图
+    std::shared_ptr<EngineContext> _engineContext;      // 当前对局的引擎上下文（规则配置、卡牌ID、随机数）
     std::shared_ptr<GameModel> _gameModel;              // 游戏数据模型
     std::shared_ptr<LevelConfig> _levelConfig;          // 关卡配置
-    LevelConfigLoader _configLoader;                    // 配置加载器
+    LevelConfigLoader* _configLoader;                   // 配置加载器（ConfigManager持有，跨关卡共享缓存）
 
     // 子控制器（按照README要求）
     PlayFieldController* _playfieldController;          // 桌面牌控制器
@@ -200,7 +280,18 @@ private:
 
     // 游戏状态
     int _currentLevelId;                                // 当前关卡ID
+    int _pinnedLevelId;                                 // 在配置缓存中钉住的关卡ID
     bool _isInitialized;                                // 是否已初始化
+
+    // 异步开局
+    int _startRequestId;                                // 最近一次开局请求序号，过期结果直接丢弃
+    std::shared_ptr<bool> _aliveToken;                  // 存活标记，异步回调据此判断控制器是否已销毁
+    double _lastStartDurationMs;                        // 上次异步开局耗时（毫秒）
+    unsigned int _lastStartFrameCount;                  // 上次异步开局经过的帧数
+
+    // 预先准备的下一局
+    PreparedGame _preparedGame;                         // 准备好的一局
+    int _prepareRequestId;                              // 最近一次准备请求序号，过期结果直接丢弃
 };
 
 #endif // __GAME_CONTROLLER_H__
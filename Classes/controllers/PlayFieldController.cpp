@@ -1,5 +1,6 @@
 #include "PlayFieldController.h"
 #include "../views/GameView.h"
+#include "../services/GameRulesService.h"
 #include <algorithm>
 
 PlayFieldController::PlayFieldController()
@@ -109,7 +110,7 @@ bool PlayFieldController::replaceTrayWithPlayFieldCard(int cardId, const Animati
     }
     
     Vec2 sourcePosition = getWorldPosition(cardView);
-    int sourceZOrder = cardView->getLocalZOrder();
+    int sourceZOrder = CardLayer::getCardZOrder(cardView);
     
     // 获取目标位置 
     Vec2 targetPosition = _configManager->getUILayoutConfig()->getCurrentCardPosition();
@@ -143,7 +144,6 @@ bool PlayFieldController::replaceTrayWithPlayFieldCard(int cardId, const Animati
         if (!this || !_gameModel) {
             if (cardView) {
                 cardView->removeFromParent();
-                cardView->release();
             }
             if (callback) callback(false);
             return;
@@ -152,24 +152,16 @@ bool PlayFieldController::replaceTrayWithPlayFieldCard(int cardId, const Animati
         // 动画结束后，替换底牌显示
         if (success) {
             // 如果有底牌区域，直接替换显示
-            if (_currentCardArea) {
-                // 清除底牌区域中的所有子视图
-                _currentCardArea->removeAllChildren();
-                
-                // 将新卡牌移入底牌区域
-                cardView->retain();
-                cardView->removeFromParent();
-                _currentCardArea->addChild(cardView, 300); // 当前底牌层
-                
+            auto cardLayer = dynamic_cast<CardLayer*>(cardView->getParent());
+            if (_currentCardArea && cardLayer) {
                 // 设置卡牌锚点为中心，然后放在区域中心
                 cardView->setAnchorPoint(Vec2(0.5f, 0.5f));
-                // 由于容器使用默认锚点(0,0)，卡牌使用中心锚点(0.5,0.5)
-                // 卡牌放在(0,0)位置就能在容器中心显示
-                Vec2 centerPos = Vec2(0, 0);
-                cardView->setPosition(centerPos);
+                // 由于区域锚点使用默认锚点(0,0)，卡牌使用中心锚点(0.5,0.5)
+                // 卡牌放在(0,0)位置就能在区域中心显示
+                // 将新卡牌放入底牌z段（旧底牌在本帧视图调和时移除），只修改z序与位置
+                cardLayer->placeCard(cardView, CardBand::CURRENT, Vec2::ZERO, 300); // 当前底牌层
                 
                 cardView->setVisible(true);
-                cardView->release();
                 
                 // 强制设置为正面显示
                 cardView->setFlipped(true, false);
@@ -185,9 +177,10 @@ bool PlayFieldController::replaceTrayWithPlayFieldCard(int cardId, const Animati
             // 更新引用
             _currentCardView = cardView;
             
-            // 同步更新GameView的_currentCardView引用
+            // 同步更新GameView的_currentCardView引用，并标记底牌区域待同步
             if (_gameView) {
                 _gameView->setCurrentCardView(cardView);
+                _gameView->markCurrentCardDirty();
             }
 
             // 从映射和列表中移除该卡视图，避免重复显示
@@ -200,13 +193,10 @@ bool PlayFieldController::replaceTrayWithPlayFieldCard(int cardId, const Animati
             
             // 注意：不调用cardView->updateDisplay()，因为它会重置位置为model中的位置
         } else {
-            // 失败时释放临时引用
+            // 失败时移除卡牌
             cardView->removeFromParent();
         }
 
-        // 释放 retain
-        cardView->release();
-
         if (callback) callback(success);
     });
     
@@ -223,12 +213,9 @@ bool PlayFieldController::canMatchWithCurrentCard(std::shared_ptr<CardModel> car
         return false;
     }
     
-    // 检查点数是否相差1（无花色限制）
-    int currentFace = static_cast<int>(currentCard->getFace());
-    int cardFace = static_cast<int>(cardModel->getFace());
-    
-    int diff = abs(currentFace - cardFace);
-    return (diff == 1) || (diff == 12); // 考虑A和K的循环匹配
+    // 按本局开局时的匹配规则判定（默认点数相差1、A与K循环、无花色限制）
+    return GameRulesService::canMatch(*cardModel, *currentCard,
+                                      _gameModel->getEngineContext()->getGameRulesConfig()->getMatchingRules());
 }
 
 std::vector<std::shared_ptr<CardModel>> PlayFieldController::getMatchableCards() const {
@@ -294,8 +281,10 @@ bool PlayFieldController::checkMoveConditions(std::shared_ptr<CardModel> cardMod
         return false;
     }
     
-    // 检查是否可以与当前底牌匹配
-    return canMatchWithCurrentCard(cardModel);
+    // 卡牌仍在桌面、正面朝上且可以与当前底牌匹配
+    return GameRulesService::checkPlayfieldMove(*_gameModel, cardModel->getCardId(),
+                                                _gameModel->getEngineContext()->getGameRulesConfig()->getMatchingRules())
+           == GameRulesService::MOVE_OK;
 }
 
 void PlayFieldController::onCardClicked(CardView* cardView, std::shared_ptr<CardModel> cardModel) {
@@ -1,5 +1,6 @@
 #include "StackController.h"
 #include "../views/GameView.h"
+#include "../services/GameRulesService.h"
 #include <algorithm>
 
 StackController::StackController()
@@ -98,7 +99,7 @@ bool StackController::replaceCurrentWithTopCard(const AnimationCallback& callbac
     
     // 获取源卡牌位置信息
     Vec2 sourcePosition = getWorldPosition(topCardView);
-    int sourceZOrder = topCardView->getLocalZOrder();
+    int sourceZOrder = CardLayer::getCardZOrder(topCardView);
     
     // 获取目标位置
     auto uiLayoutConfig = _configManager->getUILayoutConfig();
@@ -115,10 +116,8 @@ bool StackController::replaceCurrentWithTopCard(const AnimationCallback& callbac
         return false;
     }
     
-    // 2. 更新model数据 - 先添加到底牌栈（但不从手牌栈移除）
-    _gameModel->pushCurrentCard(topCard);
-    
-    // 栈信息（调试日志已移除）
+    // 2. 更新model数据 - 顶部手牌压入底牌栈并从手牌栈移除
+    GameRulesService::applyStackDraw(*_gameModel);
     
     // 3. 执行动画：顶部手牌移动到配置的底牌位置
     Vec2 targetWorldPosition = targetPosition; // 重用之前计算的目标位置
@@ -126,7 +125,6 @@ bool StackController::replaceCurrentWithTopCard(const AnimationCallback& callbac
     // 注意：与PlayFieldController保持一致，不在动画开始前移除视图引用
     // 先更新模型数据，但保留视图引用直到动画完成
     int topCardId = topCard->getCardId();
-    _gameModel->removeTopStackCard();
 
     // 立即翻开下一张手牌并启用交互（如果存在）
     revealNextCard();
@@ -138,7 +136,6 @@ bool StackController::replaceCurrentWithTopCard(const AnimationCallback& callbac
         if (!this || !_gameModel) {
             if (topCardView) {
                 topCardView->removeFromParent();
-                topCardView->release();
             }
             if (callback) callback(false);
             return;
@@ -147,28 +144,16 @@ bool StackController::replaceCurrentWithTopCard(const AnimationCallback& callbac
         if (success) {
             // 完全仿照PlayFieldController的处理方式
             // 如果有底牌区域，直接替换显示
-            if (_currentCardArea) {
-                // 移除旧的底牌视图
-                if (_currentCardView && _currentCardView != topCardView) {
-                    _currentCardView->removeFromParent();
-                } else {
-                    // 清除底牌区域中的所有子视图
-                    _currentCardArea->removeAllChildren();
-                }
-                
-                // 将新卡牌移入底牌区域
-                topCardView->retain();
-                topCardView->removeFromParent();
-                
-                _currentCardArea->addChild(topCardView, 300); // 底牌层级
-                
+            auto cardLayer = dynamic_cast<CardLayer*>(topCardView->getParent());
+            if (_currentCardArea && cardLayer) {
                 // 设置卡牌锚点为中心，然后放在区域中心
                 topCardView->setAnchorPoint(Vec2(0.5f, 0.5f));
-                topCardView->setPosition(Vec2(0, 0));
+                
+                // 将新卡牌放入底牌z段（旧底牌在本帧视图调和时移除），只修改z序与位置
+                cardLayer->placeCard(topCardView, CardBand::CURRENT, Vec2::ZERO, 300); // 底牌层级
                 
                 topCardView->setEnabled(false); // 底牌不可点击
                 topCardView->setVisible(true);
-                topCardView->release();
                 
                 // 强制设置为正面显示
                 topCardView->setFlipped(true, false);
@@ -186,9 +171,10 @@ bool StackController::replaceCurrentWithTopCard(const AnimationCallback& callbac
             // 更新引用
             _currentCardView = topCardView;
             
-            // 同步更新GameView的_currentCardView引用
+            // 同步更新GameView的_currentCardView引用，并标记底牌区域待同步
             if (_gameView) {
                 _gameView->setCurrentCardView(topCardView);
+                _gameView->markCurrentCardDirty();
             }
             
             // 从映射和列表中移除该卡视图，避免重复显示（与PlayFieldController一致）
@@ -199,13 +185,10 @@ bool StackController::replaceCurrentWithTopCard(const AnimationCallback& callbac
             // 注意：不调用topCardView->updateDisplay()，因为它会重置位置为model中的位置
             
         } else {
-            // 失败时释放临时引用
+            // 失败时移除卡牌
             topCardView->removeFromParent();
         }
 
-        // 释放 retain
-        topCardView->release();
-
         if (callback) callback(success);
     });
     
@@ -219,28 +202,19 @@ bool StackController::revealNextCard() {
         return false;
     }
     
-    const auto& stackCards = _gameModel->getStackCards();
-    if (stackCards.empty()) {
+    // 找到下一张需要翻开的卡牌
+    auto card = GameRulesService::revealNextStackCard(*_gameModel);
+    if (!card) {
         return false;
     }
     
-    // 找到下一张需要翻开的卡牌
-    for (size_t i = 0; i < stackCards.size(); i++) {
-        auto card = stackCards[i];
-        if (!card->isFlipped()) {
-            card->setFlipped(true);
-            
-            // 更新对应的视图
-            auto cardView = _cardViewMap[card->getCardId()];
-            if (cardView) {
-                cardView->setFlipped(true, true); // 带动画翻牌
-            }
-            
-            return true;
-        }
+    // 更新对应的视图
+    auto cardView = _cardViewMap[card->getCardId()];
+    if (cardView) {
+        cardView->setFlipped(true, true); // 带动画翻牌
     }
     
-    return false;
+    return true;
 }
 
 bool StackController::hasAvailableCards() const {
@@ -277,11 +251,9 @@ CardView* StackController::getTopCardView() const {
 }
 
 void StackController::updateStackDisplay() {
-    // 更新所有手牌视图的显示状态
-    for (auto cardView : _stackCardViews) {
-        if (cardView && cardView->getCardModel()) {
-            cardView->updateDisplay();
-        }
+    // 手牌视图的显示状态在本帧视图调和时与模型同步
+    if (_gameView) {
+        _gameView->markStackDirty();
     }
 }
 
@@ -330,6 +302,12 @@ void StackController::updateStackInteractivity() {
         return;
     }
     
+    // 已关联GameView时只做标记，同一帧内的多次调用合并为一次视图调和
+    if (_gameView) {
+        _gameView->markStackDirty();
+        return;
+    }
+    
     // 只有顶部卡牌可以交互
     auto topCard = getTopCard();
     
@@ -391,58 +369,38 @@ bool StackController::initialDealCurrentFromStack() {
         return false;
     }
 
-    // 使用栈结构设置为当前底牌（不记录撤销）
-    _gameModel->pushCurrentCard(topCard);
-    
-    // 从手牌栈中移除这张卡牌
-    _gameModel->removeTopStackCard();
+    // 顶部手牌设为当前底牌并从手牌栈移除（不记录撤销）
+    GameRulesService::dealInitialCard(*_gameModel);
 
     auto uiLayoutConfig = _configManager->getUILayoutConfig();
     Vec2 targetWorldPosition = uiLayoutConfig->getCurrentCardPosition();
 
-    // 计算动画坐标（提升到GameView层） - 重构前的逻辑
-    Node* srcParent = topCardView->getParent();
-    Node* overlayParent = (srcParent && srcParent->getParent()) ? srcParent->getParent() : srcParent;
-
     int topCardId = topCard->getCardId();
 
     // 使用BaseController的通用动画方法
-    moveCardWithAnimation(topCardView, targetWorldPosition, 500, [this, topCardView, topCardId, overlayParent](bool success){
+    moveCardWithAnimation(topCardView, targetWorldPosition, 500, [this, topCardView, topCardId](bool success){
         
         // 动画完成，卡牌已经在正确位置
         if (success) {
-            // 动画完成，卡牌已经在正确位置，需要保存位置并重新添加到父节点
-            topCardView->retain();
-            
-            // 保存当前位置（动画已经移动到的正确位置）
-            Vec2 currentPosition = topCardView->getPosition();
-            
-            topCardView->removeFromParent();
-            
-            // 重新添加到 GameView 的 _currentCardArea
-            // 需要找到 currentCardArea 节点
-            Node* currentCardArea = overlayParent->getChildByName("currentCardArea");
-            if (currentCardArea) {
-                // 转换坐标到 currentCardArea 的本地坐标系
-                Vec2 localPos = currentCardArea->convertToNodeSpace(currentPosition);
-                currentCardArea->addChild(topCardView, 300); // 当前底牌层
-                topCardView->setPosition(localPos);
-            } else {
-                // 备用方案：直接添加到 GameView
-                overlayParent->addChild(topCardView, 300);
-                topCardView->setPosition(currentPosition);
+            // 从覆盖层z段移到底牌z段，保持动画结束时的屏幕位置
+            auto cardLayer = dynamic_cast<CardLayer*>(topCardView->getParent());
+            if (cardLayer) {
+                cardLayer->moveCardToBand(topCardView, CardBand::CURRENT, 300); // 当前底牌层
             }
             
             topCardView->setEnabled(false);
-            topCardView->release();
+            
+            // 记录为当前底牌，视图调和时底牌区域保留该视图
+            _currentCardView = topCardView;
+            if (_gameView) {
+                _gameView->setCurrentCardView(topCardView);
+                _gameView->markCurrentCardDirty();
+            }
             
             // 从映射与列表移除，避免重复显示
             _cardViewMap.erase(topCardId);
             auto it = std::find(_stackCardViews.begin(), _stackCardViews.end(), topCardView);
             if (it != _stackCardViews.end()) _stackCardViews.erase(it);
-            
-            // 立即更新交互状态，让新的栈顶卡牌可点击
-            updateStackInteractivity();
         } else {
             topCardView->removeFromParent();
         }
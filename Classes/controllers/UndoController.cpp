@@ -120,44 +120,42 @@ void UndoController::performPlayfieldCardUndoAnimation(std::shared_ptr<UndoModel
     }
     // debug end
     
-    // 强制确保CardView显示正确的卡牌内容（保持原有逻辑）
+    // 强制确保CardView显示正确的卡牌内容（setCardModel即同步牌面）
     currentCardView->setCardModel(sourceCard);
-    currentCardView->updateDisplay();
     currentCardView->setFlipped(true, false); // 强制设置为正面显示
     // forced update
     
     // 使用记录的世界坐标作为目标位置（保持原有逻辑）
     Vec2 worldTargetPos = undoModel->getSourcePosition(); // 这现在是正确的世界坐标
     
-    // target pos
-    
-    // 使用与现有动画完全相同的坐标转换方式（保持原有逻辑）
-    Node* currentParent = currentCardView->getParent(); // 底牌区域
-    Node* gameViewNode = currentParent->getParent();    // GameView（作为动画层）
-    
-    // 计算动画坐标（完全复制PlayFieldController的逻辑）
-    Vec2 worldStart = currentParent->convertToWorldSpace(currentCardView->getPosition());
-    Vec2 worldTarget = worldTargetPos; // 使用记录的世界坐标
+    // 桌面镜头可能在移牌后平移或缩放过，按卡牌在桌面区域中的位置重新计算世界坐标
+    auto playfieldArea = _gameView->getPlayfieldArea();
+    if (playfieldArea) {
+        worldTargetPos = playfieldArea->convertToWorldSpace(sourceCard->getPosition());
+    }
     
-    Vec2 startInGameView = gameViewNode->convertToNodeSpace(worldStart);
-    Vec2 targetInGameView = gameViewNode->convertToNodeSpace(worldTarget);
+    // target pos
     
-    // pos conversion
+    // 卡牌层中覆盖层z段的原点即卡牌层原点
+    auto cardLayer = _gameView->getCardLayer();
+    Vec2 targetInLayer = cardLayer->convertToBandSpace(CardBand::OVERLAY, worldTargetPos);
     
-    // 提升层级进行动画（与PlayFieldController完全一致）
-    currentCardView->retain();
-    currentCardView->removeFromParent();
-    gameViewNode->addChild(currentCardView, 500); // 动画层
-    currentCardView->setPosition(startInGameView);
+    // 提升到覆盖层z段进行动画，保持屏幕位置（与PlayFieldController一致，不改动节点树）
+    cardLayer->moveCardToBand(currentCardView, CardBand::OVERLAY, 500); // 动画层
     currentCardView->setEnabled(false);
     
+    // 移动途中缩放到桌面镜头的缩放，落回桌面时大小不跳变
+    if (playfieldArea && playfieldArea->getScale() != 1.0f) {
+        currentCardView->playScaleAnimation(playfieldArea->getScale(), 0.5f);
+    }
+    
     // 立即更新底牌显示（在动画开始前，避免视觉冲突）
     this->updateCurrentCardDisplay();
     // updated current card display
     
     // 播放回退动画（保持原有逻辑）
     int originalZOrder = undoModel->getSourceZOrder();
-    _gameView->playCardMoveAnimation(currentCardView, targetInGameView, 0.5f, [this, currentCardView, sourceCard, worldTargetPos, originalZOrder]() {
+    _gameView->playCardMoveAnimation(currentCardView, targetInLayer, 0.5f, [this, currentCardView, sourceCard, worldTargetPos, originalZOrder]() {
         // animation completed
         
         // 动画完成后，恢复卡牌到桌面区域
@@ -179,7 +177,6 @@ void UndoController::restoreCardToPlayfield(CardView* cardView, std::shared_ptr<
     auto playfieldArea = _gameView->getPlayfieldArea();
     if (!playfieldArea) {
         CCLOG("UndoController::restoreCardToPlayfield - Playfield area not found");
-        cardView->release();
         return;
     }
     
@@ -191,16 +188,12 @@ void UndoController::restoreCardToPlayfield(CardView* cardView, std::shared_ptr<
     // 更新卡牌模型位置（保持原有逻辑）
     cardModel->setPosition(relativePos);
     
-    // 将卡牌重新添加到桌面区域（保持原有逻辑）
-    cardView->retain();
-    cardView->removeFromParent();
-    // 使用与初始生成一致的层级（默认0），避免回退后层级过高
-    playfieldArea->addChild(cardView);
-    // 恢复原始本地z序
-    cardView->setLocalZOrder(originalZOrder);
-    // applied local z
-    cardView->setPosition(relativePos);
+    // 将卡牌放回桌面z段，恢复原始区域内z序（只修改z序与位置）
+    _gameView->getCardLayer()->placeCard(cardView, CardBand::PLAYFIELD, relativePos, originalZOrder);
+    cardView->setScale(1.0f); // 镜头缩放已由区域缩放承担
     cardView->setEnabled(true); // 重新启用交互
+    // 撤销已恢复模型的翻开状态，动画期间跳过的牌面在本帧调和时同步
+    _gameView->markCardDirty(cardView);
     
     // 重新注册到GameView（保持原有逻辑）
     auto& playfieldViews = const_cast<std::vector<CardView*>&>(_gameView->getPlayfieldCardViews());
@@ -215,7 +208,6 @@ void UndoController::restoreCardToPlayfield(CardView* cardView, std::shared_ptr<
     }
     
     // restored
-    cardView->release();
 }
 
 void UndoController::updateCurrentCardDisplay() {
@@ -241,10 +233,10 @@ void UndoController::updateCurrentCardDisplay() {
     
     // updating current card
     
-    // 创建新的底牌视图（保持原有逻辑）
-    auto newCurrentCardView = CardView::create(currentCard);
+    // 从对象池取出底牌视图
+    auto newCurrentCardView = _gameView->acquireCardView(currentCard);
     if (!newCurrentCardView) {
-        CCLOG("UndoController::updateCurrentCardDisplay - Failed to create card view");
+        CCLOG("UndoController::updateCurrentCardDisplay - Failed to acquire card view");
         return;
     }
     
@@ -264,17 +256,14 @@ void UndoController::updateCurrentCardDisplay() {
         _stackController->setCurrentCardView(nullptr);
     }
     
-    // 清除旧的底牌视图（保持原有逻辑）
-    currentCardArea->removeAllChildren();
-    
-    // 添加新的底牌视图
-    currentCardArea->addChild(newCurrentCardView, 300);
-    newCurrentCardView->setPosition(Vec2(0, 0)); // 居中显示
+    // 添加新的底牌视图（旧底牌视图在本帧视图调和时移除）
+    _gameView->getCardLayer()->placeCard(newCurrentCardView, CardBand::CURRENT, Vec2::ZERO, 300); // 居中显示
     newCurrentCardView->setFlipped(true, false);  // 正面显示，无动画
     newCurrentCardView->setEnabled(false);        // 底牌不可点击
     
     // 同步更新所有引用
     _gameView->setCurrentCardView(newCurrentCardView);
+    _gameView->markCurrentCardDirty();
     if (_playfieldController) {
         _playfieldController->setCurrentCardView(newCurrentCardView);
     }
@@ -290,10 +279,10 @@ void UndoController::performStackCardUndoAnimation(std::shared_ptr<UndoModel> un
     
     // creating view for card
     
-    // 为要回退的卡牌创建新的视图（因为模型已经更新，当前底牌视图已经是恢复后的底牌）
-    auto cardViewToAnimate = CardView::create(sourceCard);
+    // 为要回退的卡牌取出视图（因为模型已经更新，当前底牌视图已经是恢复后的底牌）
+    auto cardViewToAnimate = _gameView->acquireCardView(sourceCard);
     if (!cardViewToAnimate) {
-        CCLOG("UndoController::performStackCardUndoAnimation - Failed to create card view");
+        CCLOG("UndoController::performStackCardUndoAnimation - Failed to acquire card view");
         return;
     }
     
@@ -309,32 +298,27 @@ void UndoController::performStackCardUndoAnimation(std::shared_ptr<UndoModel> un
         return;
     }
     
-    // 使用与桌面牌回退相同的坐标转换方式（保持原有逻辑）
-    Node* gameViewNode = currentCardArea->getParent();    // GameView（作为动画层）
+    // 使用与桌面牌回退相同的坐标转换方式
+    auto cardLayer = _gameView->getCardLayer();
     
     // 将新创建的卡牌视图放在底牌区域的中心作为动画起点（保持原有逻辑）
     Vec2 worldStart = currentCardArea->convertToWorldSpace(Vec2(0, 0)); // 底牌区域中心
-    Vec2 worldTarget = worldTargetPos; // 使用记录的世界坐标
-    
-    Vec2 startInGameView = gameViewNode->convertToNodeSpace(worldStart);
-    Vec2 targetInGameView = gameViewNode->convertToNodeSpace(worldTarget);
-    
-    // pos conversion
+    Vec2 startInLayer = cardLayer->convertToBandSpace(CardBand::OVERLAY, worldStart);
+    Vec2 targetInLayer = cardLayer->convertToBandSpace(CardBand::OVERLAY, worldTargetPos);
     
     // 设置动画卡牌的初始状态和位置（保持原有逻辑）
     cardViewToAnimate->setFlipped(true, false); // 正面显示
     cardViewToAnimate->setEnabled(false); // 动画期间不可点击
     
-    // 将卡牌添加到动画层（保持原有逻辑）
-    gameViewNode->addChild(cardViewToAnimate, 500); // 动画层
-    cardViewToAnimate->setPosition(startInGameView);
+    // 将卡牌放入覆盖层z段
+    cardLayer->placeCard(cardViewToAnimate, CardBand::OVERLAY, startInLayer, 500); // 动画层
     
     // 立即更新底牌显示（在动画开始前，避免视觉冲突）
     this->updateCurrentCardDisplay();
     // updated current card display
     
     // 播放回退动画（保持原有逻辑）
-    _gameView->playCardMoveAnimation(cardViewToAnimate, targetInGameView, 0.5f, [this, cardViewToAnimate, worldTargetPos, sourceCard]() {
+    _gameView->playCardMoveAnimation(cardViewToAnimate, targetInLayer, 0.5f, [this, cardViewToAnimate, worldTargetPos, sourceCard]() {
         // animation completed
         
         // 动画完成后，将卡牌重新添加到手牌堆
@@ -352,7 +336,6 @@ void UndoController::restoreCardToStack(CardView* cardView, std::shared_ptr<Card
     auto stackArea = _gameView->getStackArea();
     if (!stackArea) {
         CCLOG("UndoController::restoreCardToStack - Stack area not found");
-        cardView->release();
         return;
     }
     
@@ -364,12 +347,10 @@ void UndoController::restoreCardToStack(CardView* cardView, std::shared_ptr<Card
     // 更新卡牌模型位置（保持原有逻辑）
     cardModel->setPosition(relativePos);
     
-    // 将卡牌重新添加到手牌堆区域（保持原有逻辑）
-    cardView->retain();
-    cardView->removeFromParent();
-    stackArea->addChild(cardView, 100);
-    cardView->setPosition(relativePos);
+    // 将卡牌放回手牌堆z段（只修改z序与位置）
+    _gameView->getCardLayer()->placeCard(cardView, CardBand::STACK, relativePos, 100);
     cardView->setEnabled(true); // 重新启用交互（作为栈顶卡牌）
+    _gameView->markCardDirty(cardView);
     
     // 重新注册到GameView（保持原有逻辑）
     auto& stackViews = const_cast<std::vector<CardView*>&>(_gameView->getStackCardViews());
@@ -384,7 +365,6 @@ void UndoController::restoreCardToStack(CardView* cardView, std::shared_ptr<Card
     }
     
     // restored
-    cardView->release();
 }
 
 void UndoController::updateGameDisplay() {
@@ -1,8 +1,17 @@
 #include "ConfigManager.h"
 #include "external/json/document.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+#ifdef CARDGAME_EMBEDDED_CONFIGS
+// 构建期由 tools/bundle_configs.cmake 生成（MODE=header）
+#include "EmbeddedConfigData.h"
+#endif
 
 // 静态成员初始化
-ConfigManager* ConfigManager::s_instance = nullptr;
+std::atomic<ConfigManager*> ConfigManager::s_instance(nullptr);
+std::mutex ConfigManager::s_instanceMutex;
 
 // 配置文件路径常量（相对于Resources目录）
 const std::string ConfigManager::kUILayoutConfigPath = "configs/data/ui/layout_config.json";
@@ -12,26 +21,50 @@ const std::string ConfigManager::kGameRulesConfigPath = "configs/data/game/rules
 const std::string ConfigManager::kCardLayoutConfigPath = "configs/data/game/card_layout_config.json";
 const std::string ConfigManager::kDisplayConfigPath = "configs/data/display/display_config.json";
 
+// 构建期由 tools/bundle_configs.cmake 生成的配置包
+const std::string ConfigManager::kConfigBundlePath = "configs/config_bundle.cfgb";
+
+// 可写目录下的覆盖配置目录，其中的文件优先于内嵌默认配置
+static const char* const kConfigOverrideDirectory = "configs/";
+
+// 配置包格式标识
+static const char* const kBundleMagicLine = "CFGBUNDLE 1";
+static const char* const kBundleEndLine = "END";
+
 ConfigManager* ConfigManager::getInstance() {
-    if (!s_instance) {
-        s_instance = new ConfigManager();
+    // 双重检查：已创建后不再加锁
+    ConfigManager* instance = s_instance.load(std::memory_order_acquire);
+    if (!instance) {
+        std::lock_guard<std::mutex> lock(s_instanceMutex);
+        instance = s_instance.load(std::memory_order_relaxed);
+        if (!instance) {
+            instance = new ConfigManager();
+            s_instance.store(instance, std::memory_order_release);
+        }
     }
-    return s_instance;
+    return instance;
 }
 
 void ConfigManager::destroyInstance() {
-    if (s_instance) {
-        delete s_instance;
-        s_instance = nullptr;
+    std::lock_guard<std::mutex> lock(s_instanceMutex);
+    ConfigManager* instance = s_instance.load(std::memory_order_relaxed);
+    if (instance) {
+        s_instance.store(nullptr, std::memory_order_release);
+        delete instance;
     }
 }
 
 ConfigManager::ConfigManager()
     : _isInitialized(false)
-    , _isLoaded(false) {
+    , _isLoaded(false)
+    , _nextListenerId(1)
+    , _isBundleEnabled(true)
+    , _isLoadedFromBundle(false)
+    , _lastLoadDurationMs(0.0) {
 }
 
 ConfigManager::~ConfigManager() {
+    stopHotReload();
 }
 
 bool ConfigManager::init() {
@@ -61,49 +94,36 @@ bool ConfigManager::loadAllConfigs() {
     
     CCLOG("ConfigManager::loadAllConfigs - Loading all configurations...");
     
-    bool allSuccess = true;
+    auto startTime = std::chrono::steady_clock::now();
     
-    // 加载UI布局配置
-    if (!loadConfigFromFile(kUILayoutConfigPath, _uiLayoutConfig)) {
-        CCLOG("ConfigManager::loadAllConfigs - Failed to load UI layout config, using defaults");
-        _uiLayoutConfig->resetToDefault();
-        allSuccess = false;
-    }
-    
-    // 加载动画配置
-    if (!loadConfigFromFile(kAnimationConfigPath, _animationConfig)) {
-        CCLOG("ConfigManager::loadAllConfigs - Failed to load animation config, using defaults");
-        _animationConfig->resetToDefault();
-        allSuccess = false;
-    }
+    std::vector<ConfigEntry> entries = createConfigEntries();
+    std::vector<char> loaded(entries.size(), 0);
     
-    // 加载字体配置
-    if (!loadConfigFromFile(kFontConfigPath, _fontConfig)) {
-        CCLOG("ConfigManager::loadAllConfigs - Failed to load font config, using defaults");
-        _fontConfig->resetToDefault();
-        allSuccess = false;
-    }
+    // 覆盖文件与内嵌默认配置，不读取资源文件
+    int embeddedCount = loadEmbeddedConfigs(entries, loaded);
     
-    // 加载游戏规则配置
-    if (!loadConfigFromFile(kGameRulesConfigPath, _gameRulesConfig)) {
-        CCLOG("ConfigManager::loadAllConfigs - Failed to load game rules config, using defaults");
-        _gameRulesConfig->resetToDefault();
-        allSuccess = false;
-    }
+    // 其余配置优先从配置包加载
+    _isLoadedFromBundle = _isBundleEnabled && loadConfigBundle(entries, loaded);
     
-    // 加载卡牌布局配置
-    if (!loadConfigFromFile(kCardLayoutConfigPath, _cardLayoutConfig)) {
-        CCLOG("ConfigManager::loadAllConfigs - Failed to load card layout config, using defaults");
-        _cardLayoutConfig->resetToDefault();
-        allSuccess = false;
+    // 配置包缺失、损坏或某段解析失败时，逐文件加载剩余配置
+    bool allSuccess = true;
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (loaded[i]) {
+            continue;
+        }
+        
+        if (!entries[i].loadFile(entries[i].filePath)) {
+            CCLOG("ConfigManager::loadAllConfigs - Failed to load %s config, using defaults",
+                  entries[i].displayName.c_str());
+            entries[i].resetToDefault();
+            allSuccess = false;
+        }
     }
     
-    // 加载显示配置
-    if (!loadConfigFromFile(kDisplayConfigPath, _displayConfig)) {
-        CCLOG("ConfigManager::loadAllConfigs - Failed to load display config, using defaults");
-        _displayConfig->resetToDefault();
-        allSuccess = false;
-    }
+    _lastLoadDurationMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - startTime).count();
+    CCLOG("ConfigManager::loadAllConfigs - Loaded in %.2f ms (embedded: %d, bundle: %s)",
+          _lastLoadDurationMs, embeddedCount, _isLoadedFromBundle ? "yes" : "no");
     
     // 验证所有配置
     if (!validateAllConfigs()) {
@@ -113,6 +133,9 @@ bool ConfigManager::loadAllConfigs() {
     
     _isLoaded = allSuccess;
     
+    // 发布给其它线程读取
+    publishSnapshot();
+    
     if (allSuccess) {
         CCLOG("ConfigManager::loadAllConfigs - All configurations loaded successfully");
         CCLOG("ConfigManager::loadAllConfigs - %s", getConfigSummary().c_str());
@@ -124,9 +147,159 @@ bool ConfigManager::loadAllConfigs() {
 }
 
 bool ConfigManager::reloadAllConfigs() {
+    if (!_isInitialized) {
+        CCLOG("ConfigManager::reloadAllConfigs - Not initialized");
+        return false;
+    }
+    
     CCLOG("ConfigManager::reloadAllConfigs - Reloading all configurations...");
-    _isLoaded = false;
-    return loadAllConfigs();
+    
+    // 逐个重新加载并推送变化，失败的配置保留当前值
+    std::vector<ConfigEntry> entries = createConfigEntries();
+    bool allSuccess = true;
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (!reloadConfigEntry(entries, i, resolveConfigFilePath(entries[i].filePath))) {
+            allSuccess = false;
+        }
+    }
+    
+    _isLoaded = allSuccess && validateAllConfigs();
+    return allSuccess;
+}
+
+int ConfigManager::addConfigChangeListener(const ConfigChangeListener& listener) {
+    if (!listener) {
+        return 0;
+    }
+    
+    int listenerId = _nextListenerId++;
+    _changeListeners[listenerId] = listener;
+    return listenerId;
+}
+
+void ConfigManager::removeConfigChangeListener(int listenerId) {
+    _changeListeners.erase(listenerId);
+}
+
+bool ConfigManager::startHotReload() {
+    if (!_isInitialized) {
+        CCLOG("ConfigManager::startHotReload - Not initialized");
+        return false;
+    }
+    
+    if (_configWatcher.isRunning()) {
+        return true;
+    }
+    
+    std::vector<ConfigEntry> entries = createConfigEntries();
+    std::vector<std::string> filePaths;
+    _watchedConfigFiles.clear();
+    for (size_t i = 0; i < entries.size(); i++) {
+        std::string fullPath = resolveConfigFilePath(entries[i].filePath);
+        if (fullPath.empty()) {
+            CCLOG("ConfigManager::startHotReload - %s not found, not watched", entries[i].filePath.c_str());
+            continue;
+        }
+        _watchedConfigFiles[fullPath] = i;
+        filePaths.push_back(fullPath);
+    }
+    
+    return _configWatcher.start(filePaths, [this](const std::vector<std::string>& changedFiles) {
+        onConfigFilesChanged(changedFiles);
+    });
+}
+
+void ConfigManager::stopHotReload() {
+    _configWatcher.stop();
+    _watchedConfigFiles.clear();
+}
+
+std::string ConfigManager::resolveConfigFilePath(const std::string& filePath) {
+    auto fileUtils = FileUtils::getInstance();
+    
+    // 与加载顺序一致：可写目录下的覆盖文件优先
+    std::string overridePath = fileUtils->getWritablePath() + filePath;
+    if (fileUtils->isFileExist(overridePath)) {
+        return overridePath;
+    }
+    return resolveResourceFilePath(filePath);
+}
+
+std::string ConfigManager::resolveResourceFilePath(const std::string& filePath) {
+    auto fileUtils = FileUtils::getInstance();
+    
+#ifdef CARDGAME_SOURCE_RESOURCE_ROOT
+    // 桌面Debug构建：开发者编辑的是源码目录中的文件，构建输出目录中的只是构建时复制的副本
+    std::string sourcePath = std::string(CARDGAME_SOURCE_RESOURCE_ROOT) + filePath;
+    if (fileUtils->isFileExist(sourcePath)) {
+        return sourcePath;
+    }
+#endif
+    return fileUtils->fullPathForFilename(filePath);
+}
+
+bool ConfigManager::reloadConfigEntry(const std::vector<ConfigEntry>& entries, size_t index, const std::string& filePath) {
+    auto startTime = std::chrono::steady_clock::now();
+    const ConfigEntry& entry = entries[index];
+    
+    ConfigChange change;
+    change.type = static_cast<ConfigType>(index);
+    if (!entry.reloadFile(filePath, change.changedFields)) {
+        CCLOG("ConfigManager::reloadConfigEntry - Failed to reload %s config, keeping current values",
+              entry.displayName.c_str());
+        return false;
+    }
+    
+    if (change.changedFields.empty()) {
+        return true;
+    }
+    
+    // 先发布新快照，订阅者与其它线程看到一致的配置
+    publishSnapshot();
+    
+    // 复制一份，允许回调中增删订阅
+    auto listeners = _changeListeners;
+    for (const auto& pair : listeners) {
+        pair.second(change);
+    }
+    
+    double durationMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - startTime).count();
+    CCLOG("ConfigManager::reloadConfigEntry - %s config: %zu fields changed, applied in %.2f ms",
+          entry.displayName.c_str(), change.changedFields.size(), durationMs);
+    return true;
+}
+
+uint64_t ConfigManager::getSnapshotGeneration() const {
+    auto snapshot = getSnapshot();
+    return snapshot ? snapshot->generation : 0;
+}
+
+void ConfigManager::publishSnapshot() {
+    auto current = _snapshot.load();
+    
+    // 复制当前配置，之后主线程的原地修改不影响已发布的快照
+    auto snapshot = std::make_shared<ConfigSnapshot>();
+    snapshot->generation = current ? current->generation + 1 : 1;
+    snapshot->uiLayoutConfig = std::make_shared<UILayoutConfig>(*_uiLayoutConfig);
+    snapshot->animationConfig = std::make_shared<AnimationConfig>(*_animationConfig);
+    snapshot->fontConfig = std::make_shared<FontConfig>(*_fontConfig);
+    snapshot->gameRulesConfig = std::make_shared<GameRulesConfig>(*_gameRulesConfig);
+    snapshot->cardLayoutConfig = std::make_shared<CardLayoutConfig>(*_cardLayoutConfig);
+    snapshot->displayConfig = std::make_shared<DisplayConfig>(*_displayConfig);
+    
+    // 旧快照仍被其它线程持有时，由最后一个持有者释放
+    _snapshot.publish(snapshot);
+}
+
+void ConfigManager::onConfigFilesChanged(const std::vector<std::string>& changedFiles) {
+    std::vector<ConfigEntry> entries = createConfigEntries();
+    for (const auto& filePath : changedFiles) {
+        auto it = _watchedConfigFiles.find(filePath);
+        if (it != _watchedConfigFiles.end()) {
+            reloadConfigEntry(entries, it->second, filePath);
+        }
+    }
 }
 
 std::string ConfigManager::getConfigSummary() const {
@@ -168,6 +341,281 @@ bool ConfigManager::validateAllConfigs() const {
            _displayConfig && _displayConfig->isValid();
 }
 
+std::vector<ConfigManager::ConfigEntry> ConfigManager::createConfigEntries() {
+    std::vector<ConfigEntry> entries(6);
+    
+    // UI布局配置
+    entries[0].displayName = "UI layout";
+    entries[0].sectionName = "ui_layout";
+    entries[0].filePath = kUILayoutConfigPath;
+    entries[0].parseBuffer = [this](char* buffer) { return loadConfigFromBuffer(buffer, _uiLayoutConfig); };
+    entries[0].loadFile = [this](const std::string& path) { return loadConfigFromFile(path, _uiLayoutConfig); };
+    entries[0].resetToDefault = [this]() { _uiLayoutConfig->resetToDefault(); };
+    entries[0].reloadFile = [this](const std::string& path, std::vector<std::string>& changedFields) {
+        return reloadConfigFromFile(path, _uiLayoutConfig, changedFields);
+    };
+    
+    // 动画配置
+    entries[1].displayName = "animation";
+    entries[1].sectionName = "animation";
+    entries[1].filePath = kAnimationConfigPath;
+    entries[1].parseBuffer = [this](char* buffer) { return loadConfigFromBuffer(buffer, _animationConfig); };
+    entries[1].loadFile = [this](const std::string& path) { return loadConfigFromFile(path, _animationConfig); };
+    entries[1].resetToDefault = [this]() { _animationConfig->resetToDefault(); };
+    entries[1].reloadFile = [this](const std::string& path, std::vector<std::string>& changedFields) {
+        return reloadConfigFromFile(path, _animationConfig, changedFields);
+    };
+    
+    // 字体配置
+    entries[2].displayName = "font";
+    entries[2].sectionName = "font";
+    entries[2].filePath = kFontConfigPath;
+    entries[2].parseBuffer = [this](char* buffer) { return loadConfigFromBuffer(buffer, _fontConfig); };
+    entries[2].loadFile = [this](const std::string& path) { return loadConfigFromFile(path, _fontConfig); };
+    entries[2].resetToDefault = [this]() { _fontConfig->resetToDefault(); };
+    entries[2].reloadFile = [this](const std::string& path, std::vector<std::string>& changedFields) {
+        return reloadConfigFromFile(path, _fontConfig, changedFields);
+    };
+    
+    // 游戏规则配置
+    entries[3].displayName = "game rules";
+    entries[3].sectionName = "game_rules";
+    entries[3].filePath = kGameRulesConfigPath;
+    entries[3].parseBuffer = [this](char* buffer) { return loadConfigFromBuffer(buffer, _gameRulesConfig); };
+    entries[3].loadFile = [this](const std::string& path) { return loadConfigFromFile(path, _gameRulesConfig); };
+    entries[3].resetToDefault = [this]() { _gameRulesConfig->resetToDefault(); };
+    entries[3].reloadFile = [this](const std::string& path, std::vector<std::string>& changedFields) {
+        return reloadConfigFromFile(path, _gameRulesConfig, changedFields);
+    };
+    
+    // 卡牌布局配置
+    entries[4].displayName = "card layout";
+    entries[4].sectionName = "card_layout";
+    entries[4].filePath = kCardLayoutConfigPath;
+    entries[4].parseBuffer = [this](char* buffer) { return loadConfigFromBuffer(buffer, _cardLayoutConfig); };
+    entries[4].loadFile = [this](const std::string& path) { return loadConfigFromFile(path, _cardLayoutConfig); };
+    entries[4].resetToDefault = [this]() { _cardLayoutConfig->resetToDefault(); };
+    entries[4].reloadFile = [this](const std::string& path, std::vector<std::string>& changedFields) {
+        return reloadConfigFromFile(path, _cardLayoutConfig, changedFields);
+    };
+    
+    // 显示配置
+    entries[5].displayName = "display";
+    entries[5].sectionName = "display";
+    entries[5].filePath = kDisplayConfigPath;
+    entries[5].parseBuffer = [this](char* buffer) { return loadConfigFromBuffer(buffer, _displayConfig); };
+    entries[5].loadFile = [this](const std::string& path) { return loadConfigFromFile(path, _displayConfig); };
+    entries[5].resetToDefault = [this]() { _displayConfig->resetToDefault(); };
+    entries[5].reloadFile = [this](const std::string& path, std::vector<std::string>& changedFields) {
+        return reloadConfigFromFile(path, _displayConfig, changedFields);
+    };
+    
+    return entries;
+}
+
+#ifdef CARDGAME_EMBEDDED_CONFIGS
+/**
+ * 查找内嵌配置段
+ * @param name 段名
+ * @return 配置段，未找到返回nullptr
+ */
+static const EmbeddedConfigSection* findEmbeddedSection(const std::string& name) {
+    for (size_t i = 0; i < kEmbeddedConfigSectionCount; i++) {
+        if (name == kEmbeddedConfigSections[i].name) {
+            return &kEmbeddedConfigSections[i];
+        }
+    }
+    return nullptr;
+}
+#endif
+
+#if defined(CARDGAME_EMBEDDED_CONFIGS) && defined(CARDGAME_SOURCE_RESOURCE_ROOT)
+/**
+ * 读取内容与内嵌数据不同的资源文件（仅桌面Debug构建，发布构建不读取资源中的配置文件）
+ * 按内容而不是修改时间比较：构建时复制到输出目录的资源文件总比源文件新，修改时间不能说明内容是否变化
+ * @param fullPath 资源文件完整路径
+ * @param section 内嵌配置段
+ * @param content 输出的文件内容
+ * @return 文件存在且内容与内嵌数据不同
+ */
+static bool readChangedResourceFile(const std::string& fullPath, const EmbeddedConfigSection& section,
+                                    std::string& content) {
+    if (fullPath.empty() || FileUtils::getInstance()->getContents(fullPath, &content) != FileUtils::Status::OK) {
+        return false;
+    }
+    return content.size() != section.length || content.compare(0, section.length, section.json, section.length) != 0;
+}
+#endif
+
+int ConfigManager::loadEmbeddedConfigs(const std::vector<ConfigEntry>& entries, std::vector<char>& loaded) {
+#ifdef CARDGAME_EMBEDDED_CONFIGS
+    auto fileUtils = FileUtils::getInstance();
+    
+    // 覆盖目录存在时才逐个检查覆盖文件，正常启动只有这一次文件系统访问
+    std::string writablePath = fileUtils->getWritablePath();
+    bool hasOverrides = fileUtils->isDirectoryExist(writablePath + kConfigOverrideDirectory);
+    
+    int embeddedCount = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+        const ConfigEntry& entry = entries[i];
+        const EmbeddedConfigSection* section = findEmbeddedSection(entry.sectionName);
+        if (!section) {
+            continue;
+        }
+        
+        // 覆盖文件优先
+        if (hasOverrides) {
+            std::string overridePath = writablePath + entry.filePath;
+            if (fileUtils->isFileExist(overridePath)) {
+                if (entry.loadFile(overridePath)) {
+                    CCLOG("ConfigManager::loadEmbeddedConfigs - Loaded override %s", overridePath.c_str());
+                    loaded[i] = 1;
+                    continue;
+                }
+                CCLOG("ConfigManager::loadEmbeddedConfigs - Invalid override %s, using embedded defaults",
+                      overridePath.c_str());
+                entry.resetToDefault();
+            }
+        }
+        
+#ifdef CARDGAME_SOURCE_RESOURCE_ROOT
+        // 开发时资源文件在构建之后被修改过，内嵌数据已过期，直接解析读到的文件内容
+        std::string fileContent;
+        std::string resourcePath = resolveResourceFilePath(entry.filePath);
+        if (readChangedResourceFile(resourcePath, *section, fileContent)) {
+            if (entry.parseBuffer(&fileContent[0])) {
+                CCLOG("ConfigManager::loadEmbeddedConfigs - %s differs from embedded data", resourcePath.c_str());
+                loaded[i] = 1;
+                continue;
+            }
+            entry.resetToDefault();
+        }
+#endif
+        
+        // 就地解析会改写缓冲区，复制一份内嵌数据
+        std::string buffer(section->json, section->length);
+        if (entry.parseBuffer(&buffer[0])) {
+            loaded[i] = 1;
+            embeddedCount++;
+        } else {
+            CCLOG("ConfigManager::loadEmbeddedConfigs - Failed to parse embedded %s config",
+                  entry.displayName.c_str());
+            entry.resetToDefault();
+        }
+    }
+    
+    return embeddedCount;
+#else
+    return 0;
+#endif
+}
+
+bool ConfigManager::loadConfigBundle(const std::vector<ConfigEntry>& entries, std::vector<char>& loaded) {
+    // 全部配置已加载时不读取配置包
+    if (std::find(loaded.begin(), loaded.end(), 0) == loaded.end()) {
+        return false;
+    }
+    
+    auto fileUtils = FileUtils::getInstance();
+    if (!fileUtils->isFileExist(kConfigBundlePath)) {
+        CCLOG("ConfigManager::loadConfigBundle - Bundle not found, falling back to config files");
+        return false;
+    }
+    
+    // 一次I/O读入整个配置包
+    std::string bundle = fileUtils->getStringFromFile(kConfigBundlePath);
+    
+    std::vector<BundleSection> sections;
+    if (!parseBundleHeader(bundle, sections)) {
+        CCLOG("ConfigManager::loadConfigBundle - Corrupted bundle header, falling back to config files");
+        return false;
+    }
+    
+    // 为每个配置项定位段数据，段后的换行符改写为'\0'后可直接就地解析
+    std::vector<char*> buffers(entries.size(), nullptr);
+    for (const auto& section : sections) {
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (entries[i].sectionName == section.name && !buffers[i] && !loaded[i]) {
+                bundle[section.offset + section.length] = '\0';
+                buffers[i] = &bundle[section.offset];
+                break;
+            }
+        }
+    }
+    
+    // 各段只有几百字节，逐段解析；启动线程的开销远大于解析本身
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (loaded[i]) {
+            continue;
+        }
+        if (!buffers[i]) {
+            CCLOG("ConfigManager::loadConfigBundle - Section %s missing from bundle", entries[i].sectionName.c_str());
+            continue;
+        }
+        if (entries[i].parseBuffer(buffers[i])) {
+            loaded[i] = 1;
+        } else {
+            CCLOG("ConfigManager::loadConfigBundle - Failed to parse section %s", entries[i].sectionName.c_str());
+        }
+    }
+    
+    return true;
+}
+
+bool ConfigManager::parseBundleHeader(const std::string& bundle, std::vector<BundleSection>& sections) {
+    sections.clear();
+    
+    size_t position = 0;
+    auto readLine = [&bundle, &position](std::string& line) {
+        size_t lineEnd = bundle.find('\n', position);
+        if (lineEnd == std::string::npos) {
+            return false;
+        }
+        line = bundle.substr(position, lineEnd - position);
+        position = lineEnd + 1;
+        return true;
+    };
+    
+    std::string line;
+    if (!readLine(line) || line != kBundleMagicLine) {
+        return false;
+    }
+    
+    // 段表：每行"<段名> <字节数>"，以END结束
+    while (true) {
+        if (!readLine(line)) {
+            return false;
+        }
+        if (line == kBundleEndLine) {
+            break;
+        }
+        
+        size_t separator = line.find(' ');
+        if (separator == std::string::npos || separator == 0) {
+            return false;
+        }
+        
+        BundleSection section;
+        section.name = line.substr(0, separator);
+        section.offset = 0;
+        section.length = static_cast<size_t>(strtoul(line.c_str() + separator + 1, nullptr, 10));
+        sections.push_back(section);
+    }
+    
+    // 计算各段偏移，并校验每段后都有分隔换行符
+    size_t offset = position;
+    for (auto& section : sections) {
+        section.offset = offset;
+        offset += section.length;
+        if (offset >= bundle.size() || bundle[offset] != '\n') {
+            return false;
+        }
+        offset++;
+    }
+    
+    return !sections.empty();
+}
+
 template<typename T>
 bool ConfigManager::loadConfigFromFile(const std::string& filePath, std::shared_ptr<T> config) {
     if (!config) {
@@ -182,18 +630,57 @@ bool ConfigManager::loadConfigFromFile(const std::string& filePath, std::shared_
         return false;
     }
     
-    return loadConfigFromJsonString(jsonString, config);
+    // 文件内容直接作为就地解析的缓冲区
+    return loadConfigFromBuffer(&jsonString[0], config);
+}
+
+template<typename T>
+bool ConfigManager::reloadConfigFromFile(const std::string& filePath, std::shared_ptr<T> config,
+                                         std::vector<std::string>& changedFields) {
+    changedFields.clear();
+    
+    // 新配置从默认值开始加载，与启动时的加载结果一致
+    auto newConfig = std::make_shared<T>();
+    if (!config || !loadConfigFromFile(filePath, newConfig)) {
+        return false;
+    }
+    
+    // 比较新旧配置的序列化结果，按顶层字段找出变化
+    rapidjson::Document document;
+    auto& allocator = document.GetAllocator();
+    rapidjson::Value oldJson = config->toJson(allocator);
+    rapidjson::Value newJson = newConfig->toJson(allocator);
+    
+    for (auto it = newJson.MemberBegin(); it != newJson.MemberEnd(); ++it) {
+        auto oldMember = oldJson.FindMember(it->name);
+        if (oldMember == oldJson.MemberEnd() || oldMember->value != it->value) {
+            changedFields.push_back(it->name.GetString());
+        }
+    }
+    
+    // 原地更新，持有配置对象的模块无需重新获取
+    if (!changedFields.empty()) {
+        *config = *newConfig;
+    }
+    return true;
 }
 
 template<typename T>
 bool ConfigManager::loadConfigFromJsonString(const std::string& jsonString, std::shared_ptr<T> config) {
+    // 就地解析会改写缓冲区，这里复制一份
+    std::string buffer(jsonString);
+    return loadConfigFromBuffer(&buffer[0], config);
+}
+
+template<typename T>
+bool ConfigManager::loadConfigFromBuffer(char* buffer, std::shared_ptr<T> config) {
     if (!config) {
         return false;
     }
     
-    // 解析JSON
+    // 解析JSON（就地解析，字符串不再复制）
     rapidjson::Document document;
-    document.Parse(jsonString.c_str());
+    document.ParseInsitu(buffer);
     
     if (document.HasParseError()) {
         CCLOG("ConfigManager::loadConfigFromJsonString - JSON parse error: %d", document.GetParseError());
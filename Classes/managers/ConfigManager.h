@@ -9,14 +9,73 @@
 #include "../configs/models/CardLayoutConfig.h"
 #include "../configs/models/DisplayConfig.h"
 #include "../configs/loaders/LevelConfigLoader.h"
+#include "../utils/FileWatcher.h"
+#include "../utils/SnapshotPublisher.h"
 #include <memory>
+#include <functional>
+#include <vector>
+#include <map>
+#include <atomic>
+#include <mutex>
+#include <cstdint>
 
 USING_NS_CC;
 
+/**
+ * 配置类型
+ */
+enum class ConfigType {
+    UI_LAYOUT,          // UI布局配置
+    ANIMATION,          // 动画配置
+    FONT,               // 字体配置
+    GAME_RULES,         // 游戏规则配置
+    CARD_LAYOUT,        // 卡牌布局配置
+    DISPLAY             // 显示配置
+};
+
+/**
+ * 配置变化信息
+ * 配置对象原地更新，订阅者按变化字段增量应用
+ */
+struct ConfigChange {
+    ConfigType type;                            // 配置类型
+    std::vector<std::string> changedFields;     // 发生变化的顶层字段（JSON键名）
+    
+    /**
+     * 检查字段是否变化
+     * @param field 字段名
+     * @return 是否变化
+     */
+    bool hasChanged(const std::string& field) const {
+        for (const auto& changedField : changedFields) {
+            if (changedField == field) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+/**
+ * 配置快照
+ * 发布后不再修改，任意线程可读取
+ * 取得的快照可长期持有，被新快照替换后在最后一个持有者释放时销毁
+ */
+struct ConfigSnapshot {
+    uint64_t generation;                                    // 快照代数，每次发布递增
+    std::shared_ptr<const UILayoutConfig> uiLayoutConfig;   // UI布局配置
+    std::shared_ptr<const AnimationConfig> animationConfig; // 动画配置
+    std::shared_ptr<const FontConfig> fontConfig;           // 字体配置
+    std::shared_ptr<const GameRulesConfig> gameRulesConfig; // 游戏规则配置
+    std::shared_ptr<const CardLayoutConfig> cardLayoutConfig;   // 卡牌布局配置
+    std::shared_ptr<const DisplayConfig> displayConfig;     // 显示配置
+};
+
 /**
  * 配置管理器
  * 负责统一管理所有配置的加载、缓存和访问
  * 提供单一入口访问所有配置信息
+ * get*Config 返回的可变配置对象只应在主线程使用；其它线程通过 getSnapshot 读取不可变快照
  */
 class ConfigManager {
 public:
@@ -43,13 +102,77 @@ public:
      */
     bool loadAllConfigs();
     
+    /**
+     * 设置是否优先从配置包加载
+     * 开发时可关闭，直接读取各配置文件
+     * @param enabled 是否启用配置包
+     */
+    void setConfigBundleEnabled(bool enabled) { _isBundleEnabled = enabled; }
+    
+    /**
+     * 获取上次加载所有配置的耗时
+     * @return 耗时（毫秒）
+     */
+    double getLastLoadDurationMs() const { return _lastLoadDurationMs; }
+    
+    /**
+     * 上次加载是否使用了配置包
+     * @return 是否使用了配置包
+     */
+    bool isLoadedFromBundle() const { return _isLoadedFromBundle; }
+    
     /**
      * 重新加载所有配置
+     * 配置对象原地更新，并向订阅者推送发生变化的字段
      * @return 是否重新加载成功
      */
     bool reloadAllConfigs();
     
-    // 配置访问接口
+    /**
+     * 配置变化回调（主线程）
+     */
+    typedef std::function<void(const ConfigChange& change)> ConfigChangeListener;
+    
+    /**
+     * 订阅配置变化
+     * @param listener 变化回调
+     * @return 订阅ID，用于取消订阅
+     */
+    int addConfigChangeListener(const ConfigChangeListener& listener);
+    
+    /**
+     * 取消订阅配置变化
+     * @param listenerId 订阅ID
+     */
+    void removeConfigChangeListener(int listenerId);
+    
+    /**
+     * 开始监视配置文件，文件变化时自动增量重载（开发用）
+     * 监视的是resolveConfigFilePath得到的文件：覆盖文件，或桌面Debug构建中源码Resources目录下的文件
+     * @return 是否启动成功
+     */
+    bool startHotReload();
+    
+    /**
+     * 停止监视配置文件
+     */
+    void stopHotReload();
+    
+    /**
+     * 获取当前配置快照（任意线程，无锁）
+     * 加载或重载后替换发布，已取得的快照内容不会变化
+     * @return 配置快照，尚未加载时返回nullptr
+     */
+    std::shared_ptr<const ConfigSnapshot> getSnapshot() const { return _snapshot.load(); }
+    
+    /**
+     * 获取当前快照代数（任意线程）
+     * 缓存记录生成时的代数，代数变化即说明配置已更新
+     * @return 快照代数，尚未加载时返回0
+     */
+    uint64_t getSnapshotGeneration() const;
+    
+    // 配置访问接口（主线程）
     std::shared_ptr<UILayoutConfig> getUILayoutConfig() const { return _uiLayoutConfig; }
     std::shared_ptr<AnimationConfig> getAnimationConfig() const { return _animationConfig; }
     std::shared_ptr<FontConfig> getFontConfig() const { return _fontConfig; }
@@ -103,9 +226,123 @@ protected:
      */
     template<typename T>
     bool loadConfigFromJsonString(const std::string& jsonString, std::shared_ptr<T> config);
+    
+    /**
+     * 从可写缓冲区就地解析并加载配置
+     * @param buffer 以'\0'结尾的JSON缓冲区，内容会被改写
+     * @param config 配置对象
+     * @return 是否加载成功
+     */
+    template<typename T>
+    bool loadConfigFromBuffer(char* buffer, std::shared_ptr<T> config);
+    
+    /**
+     * 从文件重新加载配置并与当前值比较
+     * 新配置有效时原地更新配置对象，保持对象身份不变
+     * @param filePath 配置文件路径
+     * @param config 配置对象
+     * @param changedFields 输出发生变化的顶层字段
+     * @return 是否加载成功
+     */
+    template<typename T>
+    bool reloadConfigFromFile(const std::string& filePath, std::shared_ptr<T> config,
+                              std::vector<std::string>& changedFields);
 
 private:
-    static ConfigManager* s_instance;               // 单例实例
+    /**
+     * 配置项描述，统一配置包与逐文件两种加载路径
+     */
+    struct ConfigEntry {
+        std::string displayName;                    // 日志中的名称
+        std::string sectionName;                    // 配置包中的段名
+        std::function<bool(char*)> parseBuffer;     // 从缓冲区就地解析
+        std::string filePath;                       // 独立配置文件路径
+        std::function<bool(const std::string&)> loadFile;  // 从指定配置文件加载
+        std::function<void()> resetToDefault;       // 重置为默认值
+        std::function<bool(const std::string&, std::vector<std::string>&)> reloadFile;  // 重新加载并比较
+    };
+    
+    /**
+     * 配置包中的一段
+     */
+    struct BundleSection {
+        std::string name;                           // 段名
+        size_t offset;                              // 数据偏移
+        size_t length;                              // 数据字节数
+    };
+    
+    /**
+     * 创建所有配置项描述
+     * @return 配置项列表
+     */
+    std::vector<ConfigEntry> createConfigEntries();
+    
+    /**
+     * 从覆盖文件或内嵌默认配置加载
+     * 可写目录下存在覆盖文件时加载覆盖文件；桌面Debug构建中资源文件内容与内嵌数据不同时加载该文件；
+     * 其余直接解析编译进程序的默认配置，发布构建除检查覆盖目录外不访问文件系统
+     * @param entries 配置项列表
+     * @param loaded 输出每个配置项是否加载成功
+     * @return 使用内嵌数据加载的配置数
+     */
+    int loadEmbeddedConfigs(const std::vector<ConfigEntry>& entries, std::vector<char>& loaded);
+    
+    /**
+     * 从配置包加载配置：一次读入，逐段就地解析
+     * 已加载的配置项会被跳过，全部已加载时不读取配置包。
+     * 内嵌配置覆盖全部配置段，因此只在关闭CARDGAME_EMBED_CONFIGS的构建中生成和读取配置包
+     * @param entries 配置项列表
+     * @param loaded 输出每个配置项是否加载成功
+     * @return 是否读取到有效的配置包
+     */
+    bool loadConfigBundle(const std::vector<ConfigEntry>& entries, std::vector<char>& loaded);
+    
+    /**
+     * 解析配置包头部
+     * @param bundle 配置包内容
+     * @param sections 输出的段列表
+     * @return 头部是否有效
+     */
+    static bool parseBundleHeader(const std::string& bundle, std::vector<BundleSection>& sections);
+    
+    /**
+     * 获取配置实际使用的文件完整路径（存在覆盖文件时为覆盖文件，否则同resolveResourceFilePath）
+     * @param filePath 配置文件路径
+     * @return 完整路径
+     */
+    static std::string resolveConfigFilePath(const std::string& filePath);
+    
+    /**
+     * 获取资源中配置文件的完整路径
+     * 桌面Debug构建定义了CARDGAME_SOURCE_RESOURCE_ROOT（源码Resources目录）且其中存在该文件时返回源码中的文件，
+     * 热重载因此监视开发者实际编辑的文件，而不是构建输出目录中的副本；否则按FileUtils搜索路径查找
+     * @param filePath 配置文件路径（相对于Resources目录）
+     * @return 完整路径，未找到返回空字符串
+     */
+    static std::string resolveResourceFilePath(const std::string& filePath);
+    
+    /**
+     * 重新加载单个配置并通知订阅者
+     * @param entries 配置项列表
+     * @param index 配置项下标（与ConfigType一致）
+     * @param filePath 配置文件路径
+     * @return 是否加载成功
+     */
+    bool reloadConfigEntry(const std::vector<ConfigEntry>& entries, size_t index, const std::string& filePath);
+    
+    /**
+     * 以当前配置的副本发布新快照（主线程）
+     */
+    void publishSnapshot();
+    
+    /**
+     * 配置文件变化（主线程）
+     * @param changedFiles 发生变化的文件完整路径
+     */
+    void onConfigFilesChanged(const std::vector<std::string>& changedFiles);
+    
+    static std::atomic<ConfigManager*> s_instance;  // 单例实例
+    static std::mutex s_instanceMutex;              // 保护单例的创建与销毁
     
     // 配置对象
     std::shared_ptr<UILayoutConfig> _uiLayoutConfig;        // UI布局配置
@@ -118,9 +355,23 @@ private:
     // 关卡配置加载器
     LevelConfigLoader _levelConfigLoader;
     
+    // 配置快照：读者可以长期持有快照指针，被替换的旧快照在最后一个持有者释放时销毁
+    SnapshotPublisher<ConfigSnapshot> _snapshot;    // 当前快照（读者无锁）
+    
+    // 配置变化订阅
+    std::map<int, ConfigChangeListener> _changeListeners;   // 订阅ID -> 回调
+    int _nextListenerId;                                    // 下一个订阅ID
+    
+    // 热重载
+    FileWatcher _configWatcher;                             // 配置文件监视器
+    std::map<std::string, size_t> _watchedConfigFiles;      // 文件完整路径 -> 配置项下标
+    
     // 状态标志
     bool _isInitialized;                            // 是否已初始化
     bool _isLoaded;                                 // 是否已加载
+    bool _isBundleEnabled;                          // 是否优先从配置包加载
+    bool _isLoadedFromBundle;                       // 上次加载是否使用了配置包
+    double _lastLoadDurationMs;                     // 上次加载耗时（毫秒）
     
     // 配置文件路径常量
     static const std::string kUILayoutConfigPath;
@@ -129,6 +380,7 @@ private:
     static const std::string kGameRulesConfigPath;
     static const std::string kCardLayoutConfigPath;
     static const std::string kDisplayConfigPath;
+    static const std::string kConfigBundlePath;
 };
 
 #endif // __CONFIG_MANAGER_H__
@@ -0,0 +1,27 @@
+#include "EngineContext.h"
+
+EngineContext::EngineContext(std::shared_ptr<const GameRulesConfig> gameRulesConfig)
+    : EngineContext(gameRulesConfig, std::random_device()()) {
+}
+
+EngineContext::EngineContext(std::shared_ptr<const GameRulesConfig> gameRulesConfig, result_type seed)
+    : _gameRulesConfig(gameRulesConfig ? gameRulesConfig : std::make_shared<GameRulesConfig>())
+    , _nextCardId(_gameRulesConfig->getStartingCardId())
+    , _randomEngine(seed) {
+}
+
+void EngineContext::reserveCardId(int cardId) {
+    int nextId = _nextCardId.load();
+    while (cardId >= nextId && !_nextCardId.compare_exchange_weak(nextId, cardId + 1)) {
+    }
+}
+
+void EngineContext::seed(result_type seed) {
+    std::lock_guard<std::mutex> lock(_randomMutex);
+    _randomEngine.seed(seed);
+}
+
+EngineContext::result_type EngineContext::operator()() {
+    std::lock_guard<std::mutex> lock(_randomMutex);
+    return _randomEngine();
+}
@@ -0,0 +1,89 @@
+#ifndef __ENGINE_CONTEXT_H__
+#define __ENGINE_CONTEXT_H__
+
+#include "../utils/PlatformShim.h"
+#include "../configs/models/GameRulesConfig.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+
+USING_NS_CC;
+
+/**
+ * 引擎上下文
+ * 持有规则核心原先的进程级可变状态：游戏规则配置、卡牌ID分配与随机数引擎。
+ * GameModel、UndoManager与GameModelFromLevelGenerator都从传入的上下文取用这些状态，
+ * 同一进程中可以为每个租户（对局、锦标赛分组、机器人）各建一个上下文，互不影响。
+ *
+ * 线程安全：卡牌ID分配为原子操作，随机数加锁，同一上下文可在多个线程同时使用；
+ * 规则配置只读共享，不能在创建后修改（游戏中取自ConfigManager的不可变快照，每局开局时创建）。
+ * 本类满足UniformRandomBitGenerator，可直接传给std::shuffle
+ */
+class EngineContext {
+public:
+    typedef uint32_t result_type;
+
+    /**
+     * 构造函数，随机数种子取自std::random_device
+     * @param gameRulesConfig 游戏规则配置，为nullptr时使用默认配置
+     */
+    explicit EngineContext(std::shared_ptr<const GameRulesConfig> gameRulesConfig = nullptr);
+
+    /**
+     * 构造函数（固定随机数种子，用于可复现的模拟与回放）
+     * @param gameRulesConfig 游戏规则配置，为nullptr时使用默认配置
+     * @param seed 随机数种子
+     */
+    EngineContext(std::shared_ptr<const GameRulesConfig> gameRulesConfig, result_type seed);
+
+    /**
+     * 获取游戏规则配置
+     * @return 游戏规则配置，不为nullptr
+     */
+    std::shared_ptr<const GameRulesConfig> getGameRulesConfig() const { return _gameRulesConfig; }
+
+    /**
+     * 分配一个新的卡牌ID，从规则配置的起始ID开始递增
+     * @return 卡牌ID
+     */
+    int allocateCardId() { return _nextCardId++; }
+
+    /**
+     * 保留已使用的卡牌ID（反序列化时调用），之后分配的ID都大于它
+     * @param cardId 已使用的卡牌ID
+     */
+    void reserveCardId(int cardId);
+
+    /**
+     * 获取下一个将分配的卡牌ID
+     */
+    int getNextCardId() const { return _nextCardId.load(); }
+
+    /**
+     * 重新设置随机数种子
+     * @param seed 随机数种子
+     */
+    void seed(result_type seed);
+
+    /**
+     * 生成一个随机数
+     * @return 随机数
+     */
+    result_type operator()();
+
+    static constexpr result_type min() { return std::mt19937::min(); }
+    static constexpr result_type max() { return std::mt19937::max(); }
+
+private:
+    EngineContext(const EngineContext&) = delete;
+    EngineContext& operator=(const EngineContext&) = delete;
+
+    std::shared_ptr<const GameRulesConfig> _gameRulesConfig;    // 游戏规则配置
+    std::atomic<int> _nextCardId;                               // 下一个卡牌ID
+    std::mutex _randomMutex;                                    // 保护随机数引擎
+    std::mt19937 _randomEngine;                                 // 随机数引擎
+};
+
+#endif // __ENGINE_CONTEXT_H__
@@ -0,0 +1,212 @@
+#include "FrameRateGovernor.h"
+#include "TweenManager.h"
+
+FrameRateGovernor* FrameRateGovernor::s_instance = nullptr;
+const float FrameRateGovernor::kCpuStatsPeriod = 60.0f;
+
+FrameRateGovernor* FrameRateGovernor::getInstance() {
+    if (!s_instance) {
+        s_instance = new (std::nothrow) FrameRateGovernor();
+    }
+    return s_instance;
+}
+
+void FrameRateGovernor::destroyInstance() {
+    CC_SAFE_DELETE(s_instance);
+}
+
+void FrameRateGovernor::notifyActivity() {
+    if (s_instance && s_instance->_isIdle) {
+        s_instance->wake();
+    }
+}
+
+FrameRateGovernor::FrameRateGovernor()
+    : _scheduler(nullptr)
+    , _eventDispatcher(nullptr)
+    , _touchListener(nullptr)
+    , _mouseListener(nullptr)
+    , _keyboardListener(nullptr)
+    , _configListenerId(0)
+    , _activeInterval(1.0f / 60)
+    , _idleInterval(1.0f / 60)
+    , _idleTimeout(0.0f)
+    , _idleTime(0.0f)
+    , _isIdle(false)
+    , _idleEnterCount(0)
+    , _statsCpuStart(0)
+    , _statsTime(0.0f)
+    , _statsIdleTime(0.0f)
+    , _lastCpuMsPerMinute(0.0)
+    , _lastIdleRatio(0.0f) {
+}
+
+FrameRateGovernor::~FrameRateGovernor() {
+    // 退出时Director可能已销毁，只注销回调与监听，不再设置帧率
+    unregister();
+}
+
+void FrameRateGovernor::start() {
+    if (_scheduler) {
+        return;
+    }
+
+    auto director = Director::getInstance();
+    _scheduler = director->getScheduler();
+    _scheduler->retain();
+    _scheduler->scheduleUpdate(this, 0, false);
+
+    // 固定优先级且不吞没事件，只用来感知输入，不影响场景中的监听器
+    _eventDispatcher = director->getEventDispatcher();
+    _eventDispatcher->retain();
+    auto onInput = [this]() { wake(); };
+
+    // 单点触摸监听先于全部多点触摸监听分发，被CardArea等吞没的触摸不会再交给多点监听，因此用单点监听；
+    // 认领触摸才能收到后续的移动与抬起（拖动列表时保持正常帧率），但不吞没，场景中的监听器照常收到
+    _touchListener = EventListenerTouchOneByOne::create();
+    _touchListener->setSwallowTouches(false);
+    _touchListener->onTouchBegan = [onInput](Touch*, Event*) {
+        onInput();
+        return true;
+    };
+    _touchListener->onTouchMoved = [onInput](Touch*, Event*) { onInput(); };
+    _touchListener->onTouchEnded = [onInput](Touch*, Event*) { onInput(); };
+    _touchListener->onTouchCancelled = [onInput](Touch*, Event*) { onInput(); };
+    _touchListener->retain();
+    _eventDispatcher->addEventListenerWithFixedPriority(_touchListener, -1);
+
+    _mouseListener = EventListenerMouse::create();
+    _mouseListener->onMouseDown = [onInput](EventMouse*) { onInput(); };
+    _mouseListener->onMouseMove = [onInput](EventMouse*) { onInput(); };
+    _mouseListener->onMouseScroll = [onInput](EventMouse*) { onInput(); };
+    _mouseListener->retain();
+    _eventDispatcher->addEventListenerWithFixedPriority(_mouseListener, -1);
+
+    _keyboardListener = EventListenerKeyboard::create();
+    _keyboardListener->onKeyPressed = [onInput](EventKeyboard::KeyCode, Event*) { onInput(); };
+    _keyboardListener->retain();
+    _eventDispatcher->addEventListenerWithFixedPriority(_keyboardListener, -1);
+
+    _configListenerId = ConfigManager::getInstance()->addConfigChangeListener([this](const ConfigChange& change) {
+        onConfigChanged(change);
+    });
+
+    _isIdle = false;
+    _idleTime = 0.0f;
+    _statsCpuStart = std::clock();
+    _statsTime = 0.0f;
+    _statsIdleTime = 0.0f;
+    applyConfig();
+}
+
+void FrameRateGovernor::stop() {
+    if (!_scheduler) {
+        return;
+    }
+
+    unregister();
+    _isIdle = false;
+    Director::getInstance()->setAnimationInterval(_activeInterval);
+}
+
+void FrameRateGovernor::wake() {
+    _idleTime = 0.0f;
+    if (_isIdle) {
+        _isIdle = false;
+        Director::getInstance()->setAnimationInterval(_activeInterval);
+    }
+}
+
+void FrameRateGovernor::update(float dt) {
+    updateCpuStats(dt);
+
+    if (hasRunningAnimations()) {
+        wake();
+        return;
+    }
+
+    if (_isIdle || _idleInterval <= _activeInterval) {
+        return;
+    }
+
+    _idleTime += dt;
+    if (_idleTime >= _idleTimeout) {
+        _isIdle = true;
+        _idleEnterCount++;
+        Director::getInstance()->setAnimationInterval(_idleInterval);
+    }
+}
+
+void FrameRateGovernor::updateCpuStats(float dt) {
+    // 本帧间隔按帧开始时的状态计入空闲时长
+    _statsTime += dt;
+    if (_isIdle) {
+        _statsIdleTime += dt;
+    }
+    if (_statsTime < kCpuStatsPeriod) {
+        return;
+    }
+
+    std::clock_t cpuNow = std::clock();
+    double cpuMs = static_cast<double>(cpuNow - _statsCpuStart) * 1000.0 / CLOCKS_PER_SEC;
+    _lastCpuMsPerMinute = cpuMs * 60.0 / _statsTime;
+    _lastIdleRatio = _statsIdleTime / _statsTime;
+    CCLOG("FrameRateGovernor::updateCpuStats - CPU %.0f ms per minute, idle %.0f%% of the time",
+          _lastCpuMsPerMinute, _lastIdleRatio * 100.0f);
+
+    _statsCpuStart = cpuNow;
+    _statsTime = 0.0f;
+    _statsIdleTime = 0.0f;
+}
+
+void FrameRateGovernor::unregister() {
+    if (!_scheduler) {
+        return;
+    }
+
+    _scheduler->unscheduleUpdate(this);
+    CC_SAFE_RELEASE_NULL(_scheduler);
+
+    // 调度器与事件分发器都已持有，Director销毁后仍可安全注销
+    _eventDispatcher->removeEventListener(_touchListener);
+    _eventDispatcher->removeEventListener(_mouseListener);
+    _eventDispatcher->removeEventListener(_keyboardListener);
+    CC_SAFE_RELEASE_NULL(_touchListener);
+    CC_SAFE_RELEASE_NULL(_mouseListener);
+    CC_SAFE_RELEASE_NULL(_keyboardListener);
+    CC_SAFE_RELEASE_NULL(_eventDispatcher);
+
+    ConfigManager::getInstance()->removeConfigChangeListener(_configListenerId);
+    _configListenerId = 0;
+}
+
+bool FrameRateGovernor::hasRunningAnimations() const {
+    if (TweenManager::getInstance()->getActiveCount() > 0) {
+        return true;
+    }
+    return Director::getInstance()->getActionManager()->getNumberOfRunningActions() > 0;
+}
+
+void FrameRateGovernor::applyConfig() {
+    auto displayConfig = ConfigManager::getInstance()->getDisplayConfig();
+    if (!displayConfig || !displayConfig->isValid()) {
+        CCLOG("FrameRateGovernor::applyConfig - Invalid display config, keeping current frame rates");
+        return;
+    }
+
+    _activeInterval = 1.0f / displayConfig->getFrameRate();
+    _idleInterval = 1.0f / displayConfig->getIdleFrameRate();
+    _idleTimeout = displayConfig->getIdleTimeout();
+
+    Director::getInstance()->setAnimationInterval(_isIdle ? _idleInterval : _activeInterval);
+}
+
+void FrameRateGovernor::onConfigChanged(const ConfigChange& change) {
+    if (change.type != ConfigType::DISPLAY) {
+        return;
+    }
+
+    // 修改配置本身也算一次活动，按新配置从正常帧率重新计时
+    applyConfig();
+    wake();
+}
@@ -0,0 +1,136 @@
+#ifndef __FRAME_RATE_GOVERNOR_H__
+#define __FRAME_RATE_GOVERNOR_H__
+
+#include "cocos2d.h"
+#include "ConfigManager.h"
+#include <ctime>
+
+USING_NS_CC;
+
+/**
+ * 帧率调节器
+ * 棋盘静止时没有必要保持60帧渲染：每帧检查是否有进行中的补间或Action，
+ * 连续IdleTimeout秒都没有且没有输入时，把Director的帧间隔降到空闲帧率；
+ * 触摸、鼠标、键盘输入或开始新的补间时立即恢复正常帧率。
+ * 空闲时输入要等到下一次主循环才被处理，首个响应最多延迟一个空闲帧间隔。
+ * 帧率取自DisplayConfig，热重载后立即生效。
+ * 每分钟统计一次进程CPU时间（std::clock，Windows上为墙钟时间）与其中处于空闲帧率的比例，用于比较空闲时的开销。
+ * 仅在主线程使用
+ */
+class FrameRateGovernor {
+public:
+    /**
+     * 获取单例实例
+     * @return 帧率调节器实例
+     */
+    static FrameRateGovernor* getInstance();
+
+    /**
+     * 销毁单例实例
+     */
+    static void destroyInstance();
+
+    /**
+     * 通知有新的活动（如开始补间），空闲时恢复正常帧率
+     * 实例不存在时不做任何事，调用方无需关心调节器是否已启动
+     */
+    static void notifyActivity();
+
+    /**
+     * 开始调节：按配置设置帧率，注册每帧回调与输入监听（需在Director创建之后调用）
+     */
+    void start();
+
+    /**
+     * 停止调节：注销回调与监听，恢复正常帧率
+     */
+    void stop();
+
+    /**
+     * 恢复正常帧率并重新计时
+     */
+    void wake();
+
+    /**
+     * 每帧更新：检查动画状态并在空闲超时后降低帧率
+     * @param dt 帧间隔
+     */
+    void update(float dt);
+
+    /**
+     * 是否处于空闲帧率
+     */
+    bool isIdle() const { return _isIdle; }
+
+    /**
+     * 获取进入空闲的次数（用于性能分析）
+     */
+    unsigned int getIdleEnterCount() const { return _idleEnterCount; }
+
+    /**
+     * 获取上一个统计周期的进程CPU时间，折算为每分钟（用于性能分析）
+     * @return 每分钟CPU毫秒数，尚未完成一个周期时为0
+     */
+    double getLastCpuMsPerMinute() const { return _lastCpuMsPerMinute; }
+
+    /**
+     * 获取上一个统计周期中处于空闲帧率的时间比例
+     * @return 0~1
+     */
+    float getLastIdleRatio() const { return _lastIdleRatio; }
+
+private:
+    FrameRateGovernor();
+    ~FrameRateGovernor();
+
+    /**
+     * 注销每帧回调、输入监听与配置订阅
+     */
+    void unregister();
+
+    /**
+     * 是否有进行中的补间或Action
+     */
+    bool hasRunningAnimations() const;
+
+    /**
+     * 累计统计周期内的时长，周期结束时计算CPU时间并开始下一个周期
+     * @param dt 帧间隔
+     */
+    void updateCpuStats(float dt);
+
+    /**
+     * 从显示配置读取帧率并应用当前状态对应的帧间隔
+     */
+    void applyConfig();
+
+    /**
+     * 配置变化时重新读取帧率
+     */
+    void onConfigChanged(const ConfigChange& change);
+
+    static FrameRateGovernor* s_instance;
+    static const float kCpuStatsPeriod;             // CPU时间统计周期（秒）
+
+    Scheduler* _scheduler;                          // 调度器（持有）
+    EventDispatcher* _eventDispatcher;              // 事件分发器（持有）
+    EventListenerTouchOneByOne* _touchListener;     // 触摸监听器（持有）
+    EventListenerMouse* _mouseListener;             // 鼠标监听器（持有）
+    EventListenerKeyboard* _keyboardListener;       // 键盘监听器（持有）
+    int _configListenerId;                          // 配置变化订阅ID，未订阅时为0
+
+    float _activeInterval;                          // 正常帧间隔（秒）
+    float _idleInterval;                            // 空闲帧间隔（秒）
+    float _idleTimeout;                             // 进入空闲前的静止时长（秒）
+    float _idleTime;                                // 已静止的时长（秒）
+    bool _isIdle;                                   // 是否处于空闲帧率
+    unsigned int _idleEnterCount;                   // 进入空闲的次数
+
+    std::clock_t _statsCpuStart;                    // 统计周期开始时的进程CPU时间
+    float _statsTime;                               // 统计周期已经过的时长（秒）
+    float _statsIdleTime;                           // 统计周期内处于空闲帧率的时长（秒）
+    double _lastCpuMsPerMinute;                     // 上一周期每分钟CPU毫秒数
+    float _lastIdleRatio;                           // 上一周期空闲时间比例
+};
+
+#endif // __FRAME_RATE_GOVERNOR_H__
@@ -0,0 +1,119 @@
+#include "TexturePreloader.h"
+
+const size_t TexturePreloader::kMaxInFlightRequests = 4;
+
+TexturePreloader* TexturePreloader::s_instance = nullptr;
+
+TexturePreloader* TexturePreloader::getInstance() {
+    if (!s_instance) {
+        s_instance = new (std::nothrow) TexturePreloader();
+    }
+    return s_instance;
+}
+
+void TexturePreloader::destroyInstance() {
+    CC_SAFE_DELETE(s_instance);
+}
+
+TexturePreloader::TexturePreloader()
+    : _textureCache(nullptr)
+    , _nextIndex(0)
+    , _inFlightCount(0)
+    , _loadedCount(0)
+    , _failedCount(0) {
+}
+
+TexturePreloader::~TexturePreloader() {
+    // 纹理缓存已持有，退出时Director销毁后仍可安全解除回调
+    cancel();
+}
+
+bool TexturePreloader::preload(const std::vector<std::string>& imagePaths,
+                               const ProgressCallback& progressCallback,
+                               const CompleteCallback& completeCallback) {
+    if (_textureCache) {
+        CCLOG("TexturePreloader::preload - Preload already in progress");
+        return false;
+    }
+
+    _textureCache = Director::getInstance()->getTextureCache();
+    _textureCache->retain();
+    _imagePaths = imagePaths;
+    _nextIndex = 0;
+    _inFlightCount = 0;
+    _loadedCount = 0;
+    _failedCount = 0;
+    _progressCallback = progressCallback;
+    _completeCallback = completeCallback;
+
+    requestNext();
+    return true;
+}
+
+void TexturePreloader::cancel() {
+    if (!_textureCache) {
+        return;
+    }
+
+    // 按路径解除已提交请求的回调；已完成或来自缓存的路径不在队列中，解除时直接跳过
+    for (size_t i = 0; i < _nextIndex; i++) {
+        _textureCache->unbindImageAsync(_imagePaths[i]);
+    }
+    CC_SAFE_RELEASE_NULL(_textureCache);
+
+    _inFlightCount = 0;
+    _progressCallback = nullptr;
+    _completeCallback = nullptr;
+}
+
+void TexturePreloader::requestNext() {
+    while (_textureCache && _inFlightCount < kMaxInFlightRequests && _nextIndex < _imagePaths.size()) {
+        const std::string& imagePath = _imagePaths[_nextIndex++];
+
+        // 已在缓存中（如其它场景加载过）直接计为完成
+        if (_textureCache->getTextureForKey(imagePath)) {
+            _loadedCount++;
+            if (_progressCallback) {
+                _progressCallback(_loadedCount, _imagePaths.size());
+            }
+            continue;
+        }
+
+        _inFlightCount++;
+        std::string path = imagePath;
+        _textureCache->addImageAsync(path, [this, path](Texture2D* texture) {
+            onTextureLoaded(texture, path);
+        });
+    }
+
+    // 进度回调中可能已取消
+    if (_textureCache && _inFlightCount == 0 && _nextIndex >= _imagePaths.size()) {
+        finish();
+    }
+}
+
+void TexturePreloader::onTextureLoaded(Texture2D* texture, const std::string& imagePath) {
+    _inFlightCount--;
+    _loadedCount++;
+    if (!texture) {
+        _failedCount++;
+        CCLOG("TexturePreloader::onTextureLoaded - Failed to load %s", imagePath.c_str());
+    }
+
+    if (_progressCallback) {
+        _progressCallback(_loadedCount, _imagePaths.size());
+    }
+    requestNext();
+}
+
+void TexturePreloader::finish() {
+    CC_SAFE_RELEASE_NULL(_textureCache);
+
+    // 先取出回调再调用，回调中可以开始新的预加载
+    CompleteCallback completeCallback;
+    completeCallback.swap(_completeCallback);
+    _progressCallback = nullptr;
+    if (completeCallback) {
+        completeCallback(_failedCount);
+    }
+}
@@ -0,0 +1,109 @@
+#ifndef __TEXTURE_PRELOADER_H__
+#define __TEXTURE_PRELOADER_H__
+
+#include "cocos2d.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+USING_NS_CC;
+
+/**
+ * 纹理预加载器
+ * 把一组图片交给TextureCache::addImageAsync：PNG在纹理缓存的加载线程中解码，
+ * 主线程只在每帧的回调中上传已解码的图片。同时在途的请求数有上限，
+ * 每帧上传的纹理数随之受限，加载期间界面保持流畅并可显示进度。
+ * 已在缓存中的图片直接计为完成；加载完成后各图片均已在TextureCache中，
+ * 之后按同一路径addImage只是查表，不再在主线程解码。仅在主线程使用
+ */
+class TexturePreloader {
+public:
+    /**
+     * 进度回调
+     * @param loadedCount 已完成数量（含失败）
+     * @param totalCount 总数量
+     */
+    using ProgressCallback = std::function<void(size_t loadedCount, size_t totalCount)>;
+
+    /**
+     * 完成回调
+     * @param failedCount 加载失败的数量
+     */
+    using CompleteCallback = std::function<void(size_t failedCount)>;
+
+    /**
+     * 获取单例实例
+     * @return 纹理预加载器实例
+     */
+    static TexturePreloader* getInstance();
+
+    /**
+     * 销毁单例实例
+     */
+    static void destroyInstance();
+
+    /**
+     * 开始异步预加载（需在Director创建之后调用）
+     * 全部图片已在缓存中时在本调用内完成
+     * @param imagePaths 图片路径列表
+     * @param progressCallback 每完成一张图片时调用，可为nullptr
+     * @param completeCallback 全部完成时调用，可为nullptr
+     * @return 是否开始加载，已有加载进行中时返回false
+     */
+    bool preload(const std::vector<std::string>& imagePaths,
+                 const ProgressCallback& progressCallback,
+                 const CompleteCallback& completeCallback);
+
+    /**
+     * 取消预加载，不再调用回调（回调的持有者销毁前调用）
+     * 已提交的图片仍会在加载线程中完成并进入缓存
+     */
+    void cancel();
+
+    /**
+     * 是否正在加载
+     */
+    bool isLoading() const { return _textureCache != nullptr; }
+
+    /**
+     * 获取已完成数量与总数量
+     */
+    size_t getLoadedCount() const { return _loadedCount; }
+    size_t getTotalCount() const { return _imagePaths.size(); }
+
+private:
+    TexturePreloader();
+    ~TexturePreloader();
+
+    /**
+     * 补足在途请求，全部完成时结束加载
+     */
+    void requestNext();
+
+    /**
+     * 单张图片加载完成（纹理缓存在主线程回调）
+     * @param texture 纹理，加载失败时为nullptr
+     * @param imagePath 图片路径
+     */
+    void onTextureLoaded(Texture2D* texture, const std::string& imagePath);
+
+    /**
+     * 结束加载并调用完成回调
+     */
+    void finish();
+
+    static const size_t kMaxInFlightRequests;       // 同时在途的请求数上限
+
+    static TexturePreloader* s_instance;            // 单例实例
+
+    TextureCache* _textureCache;                    // 纹理缓存（加载期间持有）
+    std::vector<std::string> _imagePaths;           // 待加载的图片
+    size_t _nextIndex;                              // 下一张待提交的图片下标
+    size_t _inFlightCount;                          // 在途的请求数
+    size_t _loadedCount;                            // 已完成数量（含失败）
+    size_t _failedCount;                            // 失败数量
+    ProgressCallback _progressCallback;             // 进度回调
+    CompleteCallback _completeCallback;             // 完成回调
+};
+
+#endif // __TEXTURE_PRELOADER_H__
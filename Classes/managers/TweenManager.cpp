@@ -0,0 +1,196 @@
+#include "TweenManager.h"
+#include "FrameRateGovernor.h"
+#include <algorithm>
+#include <cmath>
+
+const size_t TweenManager::kInitialCapacity = 128;
+
+static const float kPi = 3.14159265f;
+
+TweenManager* TweenManager::s_instance = nullptr;
+
+TweenManager* TweenManager::getInstance() {
+    if (!s_instance) {
+        s_instance = new (std::nothrow) TweenManager();
+    }
+    return s_instance;
+}
+
+void TweenManager::destroyInstance() {
+    CC_SAFE_DELETE(s_instance);
+}
+
+TweenManager::TweenManager()
+    : _scheduler(nullptr) {
+    // 预分配，同时播放的补间不超过该数量时不再分配内存
+    _tweens.reserve(kInitialCapacity);
+    _callbacks.reserve(kInitialCapacity);
+    _finished.reserve(kInitialCapacity);
+}
+
+TweenManager::~TweenManager() {
+    if (_scheduler) {
+        _scheduler->unscheduleUpdate(this);
+        CC_SAFE_RELEASE_NULL(_scheduler);
+    }
+    for (auto& tween : _tweens) {
+        tween.target->release();
+    }
+    _tweens.clear();
+    _callbacks.clear();
+}
+
+void TweenManager::moveTo(Node* target, const Vec2& position, float duration, EasingType easing,
+                          float delay, const TweenCallback& callback) {
+    addTween(target, TP_POSITION, position, duration, easing, delay, callback);
+}
+
+void TweenManager::scaleTo(Node* target, float scaleX, float scaleY, float duration, EasingType easing,
+                           float delay, const TweenCallback& callback) {
+    addTween(target, TP_SCALE, Vec2(scaleX, scaleY), duration, easing, delay, callback);
+}
+
+void TweenManager::addTween(Node* target, TweenProperty property, const Vec2& to, float duration,
+                            EasingType easing, float delay, const TweenCallback& callback) {
+    if (!target) {
+        CCLOG("TweenManager::addTween - Invalid target");
+        return;
+    }
+
+    // 首次使用时注册每帧回调（需在Director创建之后）
+    if (!_scheduler) {
+        _scheduler = Director::getInstance()->getScheduler();
+        _scheduler->retain();
+        _scheduler->scheduleUpdate(this, 0, false);
+    }
+
+    Tween tween;
+    tween.target = target;
+    tween.property = property;
+    tween.easing = easing;
+    tween.started = false;
+    tween.delay = delay;
+    tween.elapsed = 0.0f;
+    tween.duration = duration;
+    tween.to = to;
+
+    target->retain();
+    _tweens.push_back(tween);
+    _callbacks.push_back(callback);
+
+    // 空闲降帧时立即恢复正常帧率，动画从第一帧起就是流畅的
+    FrameRateGovernor::notifyActivity();
+}
+
+void TweenManager::stopTweens(Node* target) {
+    size_t i = 0;
+    while (i < _tweens.size()) {
+        if (_tweens[i].target == target) {
+            _tweens[i].target->release();
+            removeTweenAt(i);
+        } else {
+            i++;
+        }
+    }
+}
+
+bool TweenManager::isTweening(const Node* target) const {
+    for (const auto& tween : _tweens) {
+        if (tween.target == target) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TweenManager::update(float dt) {
+    size_t i = 0;
+    while (i < _tweens.size()) {
+        Tween& tween = _tweens[i];
+        if (!tween.started) {
+            tween.delay -= dt;
+            if (tween.delay > 0.0f) {
+                i++;
+                continue;
+            }
+            // 延迟结束：超出的时间计入播放时长，起始值取目标当前值
+            tween.started = true;
+            tween.elapsed = -tween.delay;
+            tween.from = getValue(tween.target, tween.property);
+        } else {
+            tween.elapsed += dt;
+        }
+
+        float t = tween.duration > 0.0f ? std::min(tween.elapsed / tween.duration, 1.0f) : 1.0f;
+        float progress = applyEasing(tween.easing, t);
+        setValue(tween.target, tween.property, tween.from + (tween.to - tween.from) * progress);
+
+        if (t < 1.0f) {
+            i++;
+            continue;
+        }
+
+        // 完成：回调留到所有补间推进之后调用，避免回调中增删补间打乱遍历
+        FinishedTween finished;
+        finished.target = tween.target;
+        finished.callback = std::move(_callbacks[i]);
+        _finished.push_back(std::move(finished));
+        removeTweenAt(i);
+    }
+
+    for (size_t j = 0; j < _finished.size(); j++) {
+        if (_finished[j].callback) {
+            _finished[j].callback();
+        }
+        _finished[j].target->release();
+    }
+    _finished.clear();
+}
+
+void TweenManager::removeTweenAt(size_t index) {
+    size_t last = _tweens.size() - 1;
+    if (index != last) {
+        _tweens[index] = _tweens[last];
+        _callbacks[index] = std::move(_callbacks[last]);
+    }
+    _tweens.pop_back();
+    _callbacks.pop_back();
+}
+
+Vec2 TweenManager::getValue(const Node* target, TweenProperty property) {
+    switch (property) {
+        case TP_SCALE: return Vec2(target->getScaleX(), target->getScaleY());
+        default:       return target->getPosition();
+    }
+}
+
+void TweenManager::setValue(Node* target, TweenProperty property, const Vec2& value) {
+    switch (property) {
+        case TP_SCALE:
+            target->setScale(value.x, value.y);
+            break;
+        default:
+            target->setPosition(value);
+            break;
+    }
+}
+
+float TweenManager::applyEasing(EasingType easing, float t) {
+    switch (easing) {
+        case EasingType::SINE_IN_OUT:
+            return -0.5f * (std::cos(kPi * t) - 1.0f);
+        case EasingType::QUAD_OUT:
+            return t * (2.0f - t);
+        case EasingType::CUBIC_OUT: {
+            float f = t - 1.0f;
+            return f * f * f + 1.0f;
+        }
+        case EasingType::BACK_OUT: {
+            const float overshoot = 1.70158f;
+            float f = t - 1.0f;
+            return f * f * ((overshoot + 1.0f) * f + overshoot) + 1.0f;
+        }
+        default:
+            return t;
+    }
+}
@@ -0,0 +1,156 @@
+#ifndef __TWEEN_MANAGER_H__
+#define __TWEEN_MANAGER_H__
+
+#include "cocos2d.h"
+#include "../configs/models/AnimationConfig.h"
+#include <vector>
+#include <functional>
+
+USING_NS_CC;
+
+/**
+ * 补间动画管理器
+ * 替代卡牌动画中的MoveTo/ScaleTo/Sequence/CallFunc：所有进行中的补间存放在一个预分配的连续数组中，
+ * 由一个调度器回调统一推进，播放动画不再创建Action对象。
+ * 连续动画用延迟表示（如翻牌的后半段延迟半个时长开始），起始值在延迟结束时取目标的当前值，与Sequence一致。
+ * 补间期间持有目标节点；完成回调在本帧所有补间推进之后依次调用，回调中可以再开始或停止补间。
+ * 仅在主线程使用
+ */
+class TweenManager {
+public:
+    /**
+     * 完成回调
+     */
+    using TweenCallback = std::function<void()>;
+
+    /**
+     * 获取单例实例
+     * @return 补间动画管理器实例
+     */
+    static TweenManager* getInstance();
+
+    /**
+     * 销毁单例实例
+     * 未完成的补间直接丢弃，不调用完成回调
+     */
+    static void destroyInstance();
+
+    /**
+     * 移动到目标位置
+     * @param target 目标节点
+     * @param position 目标位置
+     * @param duration 时长（秒）
+     * @param easing 缓动类型
+     * @param delay 延迟（秒）
+     * @param callback 完成回调
+     */
+    void moveTo(Node* target, const Vec2& position, float duration, EasingType easing,
+                float delay = 0.0f, const TweenCallback& callback = nullptr);
+
+    /**
+     * 缩放到目标值
+     * @param target 目标节点
+     * @param scaleX 目标X缩放
+     * @param scaleY 目标Y缩放
+     * @param duration 时长（秒）
+     * @param easing 缓动类型
+     * @param delay 延迟（秒）
+     * @param callback 完成回调
+     */
+    void scaleTo(Node* target, float scaleX, float scaleY, float duration, EasingType easing,
+                 float delay = 0.0f, const TweenCallback& callback = nullptr);
+
+    /**
+     * 停止目标节点的所有补间（不调用完成回调，同stopAllActions）
+     * @param target 目标节点
+     */
+    void stopTweens(Node* target);
+
+    /**
+     * 目标节点是否有进行中的补间
+     * @param target 目标节点
+     */
+    bool isTweening(const Node* target) const;
+
+    /**
+     * 获取进行中的补间数量
+     */
+    size_t getActiveCount() const { return _tweens.size(); }
+
+    /**
+     * 每帧推进所有补间（由调度器调用）
+     * @param dt 帧间隔（秒）
+     */
+    void update(float dt);
+
+    /**
+     * 按缓动类型变换进度
+     * @param easing 缓动类型
+     * @param t 线性进度，0~1
+     * @return 缓动后的进度
+     */
+    static float applyEasing(EasingType easing, float t);
+
+private:
+    TweenManager();
+    ~TweenManager();
+
+    /**
+     * 补间属性
+     */
+    enum TweenProperty {
+        TP_POSITION,                            // 位置
+        TP_SCALE                                // 缩放（X、Y）
+    };
+
+    /**
+     * 单个补间（只含每帧推进所需的数据，回调另存）
+     */
+    struct Tween {
+        Node* target;                           // 目标节点（持有）
+        TweenProperty property;                 // 补间属性
+        EasingType easing;                      // 缓动类型
+        bool started;                           // 延迟是否已结束（起始值已取得）
+        float delay;                            // 剩余延迟
+        float elapsed;                          // 已播放时长
+        float duration;                         // 总时长
+        Vec2 from;                              // 起始值
+        Vec2 to;                                // 目标值
+    };
+
+    /**
+     * 已完成、等待调用回调的补间
+     */
+    struct FinishedTween {
+        Node* target;                           // 目标节点（持有，回调后释放）
+        TweenCallback callback;                 // 完成回调
+    };
+
+    /**
+     * 加入补间
+     */
+    void addTween(Node* target, TweenProperty property, const Vec2& to, float duration,
+                  EasingType easing, float delay, const TweenCallback& callback);
+
+    /**
+     * 以末尾元素填补的方式移除补间
+     */
+    void removeTweenAt(size_t index);
+
+    /**
+     * 读取/写入节点的补间属性
+     */
+    static Vec2 getValue(const Node* target, TweenProperty property);
+    static void setValue(Node* target, TweenProperty property, const Vec2& value);
+
+    static const size_t kInitialCapacity;       // 预分配的补间数量
+
+    static TweenManager* s_instance;            // 单例实例
+
+    std::vector<Tween> _tweens;                 // 进行中的补间（连续存放）
+    std::vector<TweenCallback> _callbacks;      // 完成回调，与_tweens下标一一对应
+    std::vector<FinishedTween> _finished;       // 本帧完成的补间（复用，避免每帧分配）
+    Scheduler* _scheduler;                      // 已注册回调的调度器（持有），未注册时为nullptr
+};
+
+#endif // __TWEEN_MANAGER_H__
@@ -2,7 +2,6 @@
 
 UndoManager::UndoManager()
     : _gameModel(nullptr)
-    , _configManager(nullptr)
     , _maxUndoSteps(10)  // 默认值，将从配置中读取
     , _isInitialized(false) {
 }
@@ -11,23 +10,20 @@ UndoManager::~UndoManager() {
     clearUndoHistory();
 }
 
-bool UndoManager::init(std::shared_ptr<GameModel> gameModel) {
-    if (!gameModel) {
-        CCLOG("UndoManager::init - Invalid game model");
+bool UndoManager::init(std::shared_ptr<GameModel> gameModel, std::shared_ptr<EngineContext> engineContext) {
+    if (!gameModel || !engineContext) {
+        CCLOG("UndoManager::init - Invalid game model or engine context");
         return false;
     }
 
     _gameModel = gameModel;
 
-    // 获取配置管理器并读取撤销设置
-    _configManager = ConfigManager::getInstance();
-    if (_configManager) {
-        auto gameRulesConfig = _configManager->getGameRulesConfig();
-        if (gameRulesConfig->isUndoEnabled()) {
-            _maxUndoSteps = gameRulesConfig->getMaxUndoSteps();
-        } else {
-            _maxUndoSteps = 0; // 禁用撤销
-        }
+    // 读取撤销设置
+    auto gameRulesConfig = engineContext->getGameRulesConfig();
+    if (gameRulesConfig->isUndoEnabled()) {
+        _maxUndoSteps = gameRulesConfig->getMaxUndoSteps();
+    } else {
+        _maxUndoSteps = 0; // 禁用撤销
     }
 
     _isInitialized = true;
@@ -1,10 +1,10 @@
 #ifndef __UNDO_MANAGER_H__
 #define __UNDO_MANAGER_H__
 
-#include "cocos2d.h"
+#include "../utils/PlatformShim.h"
 #include "../models/UndoModel.h"
 #include "../models/GameModel.h"
-#include "ConfigManager.h"
+#include "EngineContext.h"
 #include <memory>
 #include <vector>
 #include <functional>
@@ -39,9 +39,10 @@ public:
     /**
      * 初始化撤销管理器
      * @param gameModel 游戏数据模型
+     * @param engineContext 引擎上下文，从其规则配置读取撤销设置
      * @return 是否初始化成功
      */
-    bool init(std::shared_ptr<GameModel> gameModel);
+    bool init(std::shared_ptr<GameModel> gameModel, std::shared_ptr<EngineContext> engineContext);
     
     /**
      * 记录一个撤销操作
@@ -121,7 +122,6 @@ protected:
 private:
     std::shared_ptr<GameModel> _gameModel;              // 游戏数据模型
     std::vector<std::shared_ptr<UndoModel>> _undoStack; // 撤销操作栈
-    ConfigManager* _configManager;                      // 配置管理器
     int _maxUndoSteps;                                  // 最大撤销步数
     bool _isInitialized;                                // 是否已初始化
 };
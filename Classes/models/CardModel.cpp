@@ -1,13 +1,10 @@
 #include "CardModel.h"
 
-// 静态成员初始化
-int CardModel::s_nextCardId = 1;
-
 CardModel::CardModel(CardFaceType face, CardSuitType suit, const Vec2& position)
     : _face(face)
     , _suit(suit)
     , _position(position)
-    , _cardId(generateCardId())
+    , _cardId(kInvalidCardId)
     , _isFlipped(true) {
 }
 
@@ -15,7 +12,7 @@ CardModel::CardModel()
     : _face(CFT_ACE)
     , _suit(CST_CLUBS)
     , _position(Vec2::ZERO)
-    , _cardId(generateCardId())
+    , _cardId(kInvalidCardId)
     , _isFlipped(true) {
 }
 
@@ -74,10 +71,6 @@ void CardModel::fromJson(const rapidjson::Value& json) {
     
     if (json.HasMember("CardId") && json["CardId"].IsInt()) {
         _cardId = json["CardId"].GetInt();
-        // 更新静态ID计数器
-        if (_cardId >= s_nextCardId) {
-            s_nextCardId = _cardId + 1;
-        }
     }
     
     if (json.HasMember("IsFlipped") && json["IsFlipped"].IsBool()) {
@@ -85,10 +78,6 @@ void CardModel::fromJson(const rapidjson::Value& json) {
     }
 }
 
-int CardModel::generateCardId() {
-    return s_nextCardId++;
-}
-
 std::string CardModel::getSuitSymbol(CardSuitType suit) const {
     switch (suit) {
         case CST_CLUBS:    return "♣";
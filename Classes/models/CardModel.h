@@ -1,7 +1,7 @@
 #ifndef __CARD_MODEL_H__
 #define __CARD_MODEL_H__
 
-#include "cocos2d.h"
+#include "../utils/PlatformShim.h"
 #include "external/json/rapidjson.h"
 #include "external/json/document.h"
 
@@ -50,8 +50,11 @@ using CardFaceType_Legacy = CardFaceType;
  */
 class CardModel {
 public:
+    static const int kInvalidCardId = -1;   // 未分配的卡牌ID
+
     /**
      * 构造函数
+     * 卡牌ID初始为kInvalidCardId，由创建方通过EngineContext::allocateCardId分配
      * @param face 牌面类型
      * @param suit 花色类型
      * @param position 卡牌位置
@@ -120,14 +123,6 @@ private:
     int _cardId;                // 卡牌唯一ID
     bool _isFlipped;            // 是否翻开
     
-    static int s_nextCardId;    // 下一个卡牌ID
-    
-    /**
-     * 生成下一个卡牌ID
-     * @return 新的卡牌ID
-     */
-    int generateCardId();
-    
     /**
      * 获取花色符号
      * @param suit 花色类型
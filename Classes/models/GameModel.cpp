@@ -1,8 +1,10 @@
 #include "GameModel.h"
 #include "UndoModel.h"
+#include <algorithm>
 
-GameModel::GameModel()
-    : _gameState(GameState::INITIALIZING)
+GameModel::GameModel(std::shared_ptr<EngineContext> engineContext)
+    : _engineContext(engineContext)
+    , _gameState(GameState::INITIALIZING)
     , _currentCard(nullptr)
     , _score(0)
     , _moveCount(0)
@@ -200,6 +202,7 @@ void GameModel::fromJson(const rapidjson::Value& json) {
     if (json.HasMember("CurrentCard") && json["CurrentCard"].IsObject()) {
         _currentCard = std::make_shared<CardModel>();
         _currentCard->fromJson(json["CurrentCard"]);
+        _engineContext->reserveCardId(_currentCard->getCardId());
     }
 }
 
@@ -227,6 +230,7 @@ std::vector<std::shared_ptr<CardModel>> GameModel::deserializeCards(const rapidj
         if (jsonArray[i].IsObject()) {
             auto card = std::make_shared<CardModel>();
             card->fromJson(jsonArray[i]);
+            _engineContext->reserveCardId(card->getCardId());
             cards.push_back(card);
         }
     }
@@ -1,8 +1,9 @@
 #ifndef __GAME_MODEL_H__
 #define __GAME_MODEL_H__
 
-#include "cocos2d.h"
+#include "../utils/PlatformShim.h"
 #include "CardModel.h"
+#include "../managers/EngineContext.h"
 #include "external/json/rapidjson.h"
 #include "external/json/document.h"
 #include <vector>
@@ -24,19 +25,24 @@ enum class GameState {
 /**
  * 游戏数据模型
  * 负责管理游戏的整体状态，包括所有卡牌、游戏区域、分数等
+ * 卡牌ID等跨对局状态来自所属的引擎上下文，不使用进程级静态状态
  */
 class GameModel {
 public:
     /**
      * 构造函数
+     * @param engineContext 引擎上下文，不能为nullptr
      */
-    GameModel();
+    explicit GameModel(std::shared_ptr<EngineContext> engineContext);
     
     /**
      * 析构函数
      */
     virtual ~GameModel();
     
+    // 引擎上下文
+    std::shared_ptr<EngineContext> getEngineContext() const { return _engineContext; }
+    
     // 游戏状态管理
     GameState getGameState() const { return _gameState; }
     void setGameState(GameState state) { _gameState = state; }
@@ -133,12 +139,13 @@ public:
     rapidjson::Value toJson(rapidjson::Document::AllocatorType& allocator) const;
     
     /**
-     * 从JSON反序列化
+     * 从JSON反序列化，读到的卡牌ID在引擎上下文中保留，之后分配的ID不会重复
      * @param json JSON对象
      */
     void fromJson(const rapidjson::Value& json);
 
 private:
+    std::shared_ptr<EngineContext> _engineContext;                 // 引擎上下文
     GameState _gameState;                                           // 游戏状态
     std::vector<std::shared_ptr<CardModel>> _playfieldCards;       // 桌面牌区卡牌
     std::vector<std::shared_ptr<CardModel>> _stackCards;           // 手牌堆卡牌
@@ -1,7 +1,7 @@
 #ifndef __UNDO_MODEL_H__
 #define __UNDO_MODEL_H__
 
-#include "cocos2d.h"
+#include "../utils/PlatformShim.h"
 #include "CardModel.h"
 #include "external/json/rapidjson.h"
 #include "external/json/document.h"
@@ -1,16 +1,20 @@
 #include "GameModelFromLevelGenerator.h"
 #include <algorithm>
-#include <random>
 
-int GameModelFromLevelGenerator::s_nextCardId = 1000; // 默认值，将从配置中读取
-
-std::shared_ptr<GameModel> GameModelFromLevelGenerator::generateGameModel(std::shared_ptr<LevelConfig> levelConfig) {
-    return generateGameModel(levelConfig, false, false);
+std::shared_ptr<GameModel> GameModelFromLevelGenerator::generateGameModel(std::shared_ptr<EngineContext> engineContext,
+                                                                         std::shared_ptr<LevelConfig> levelConfig) {
+    return generateGameModel(engineContext, levelConfig, false, false);
 }
 
-std::shared_ptr<GameModel> GameModelFromLevelGenerator::generateGameModel(std::shared_ptr<LevelConfig> levelConfig,
+std::shared_ptr<GameModel> GameModelFromLevelGenerator::generateGameModel(std::shared_ptr<EngineContext> engineContext,
+                                                                         std::shared_ptr<LevelConfig> levelConfig,
                                                                          bool shufflePlayfield,
                                                                          bool shuffleStack) {
+    if (!engineContext) {
+        CCLOG("GameModelFromLevelGenerator::generateGameModel - Invalid engine context");
+        return nullptr;
+    }
+
     if (!validateLevelConfig(levelConfig)) {
     CCLOG("GameModelFromLevelGenerator::generateGameModel - Invalid level config");
         return nullptr;
@@ -19,7 +23,7 @@ std::shared_ptr<GameModel> GameModelFromLevelGenerator::generateGameModel(std::s
     // generating game model
     
     // 创建游戏模型
-    auto gameModel = std::make_shared<GameModel>();
+    auto gameModel = std::make_shared<GameModel>(engineContext);
     
     // 生成桌面牌
     if (!generatePlayfieldCards(levelConfig, gameModel, shufflePlayfield)) {
@@ -86,7 +90,7 @@ bool GameModelFromLevelGenerator::generatePlayfieldCards(std::shared_ptr<LevelCo
     // 从配置创建桌面牌
     std::vector<std::shared_ptr<CardModel>> playfieldCards;
     for (const auto& configData : levelConfig->getPlayfieldCards()) {
-        auto cardModel = createCardFromConfig(configData);
+        auto cardModel = createCardFromConfig(configData, *gameModel->getEngineContext());
         if (cardModel) {
             setupCardGameProperties(cardModel, true);
             playfieldCards.push_back(cardModel);
@@ -95,7 +99,7 @@ bool GameModelFromLevelGenerator::generatePlayfieldCards(std::shared_ptr<LevelCo
     
     // 如果需要打乱
     if (shuffle) {
-        shuffleCards(playfieldCards);
+        shuffleCards(playfieldCards, *gameModel->getEngineContext());
     }
     
     // 添加到游戏模型
@@ -120,7 +124,7 @@ bool GameModelFromLevelGenerator::generateStackCards(std::shared_ptr<LevelConfig
     // 从配置创建手牌堆
     std::vector<std::shared_ptr<CardModel>> stackCards;
     for (const auto& configData : levelConfig->getStackCards()) {
-        auto cardModel = createCardFromConfig(configData);
+        auto cardModel = createCardFromConfig(configData, *gameModel->getEngineContext());
         if (cardModel) {
             setupCardGameProperties(cardModel, false);
             stackCards.push_back(cardModel);
@@ -129,7 +133,7 @@ bool GameModelFromLevelGenerator::generateStackCards(std::shared_ptr<LevelConfig
     
     // 如果需要打乱
     if (shuffle) {
-        shuffleCards(stackCards);
+        shuffleCards(stackCards, *gameModel->getEngineContext());
     }
     
     // 添加到游戏模型
@@ -158,7 +162,7 @@ bool GameModelFromLevelGenerator::setInitialCurrentCard(std::shared_ptr<GameMode
     auto currentCard = std::make_shared<CardModel>(firstStackCard->getFace(), 
                                                   firstStackCard->getSuit(), 
                                                   Vec2::ZERO);
-    currentCard->setCardId(generateUniqueCardId());
+    currentCard->setCardId(gameModel->getEngineContext()->allocateCardId());
     currentCard->setFlipped(true); // 底牌始终正面朝上
     
     gameModel->setCurrentCard(currentCard);
@@ -168,15 +172,13 @@ bool GameModelFromLevelGenerator::setInitialCurrentCard(std::shared_ptr<GameMode
     return true;
 }
 
-void GameModelFromLevelGenerator::shuffleCards(std::vector<std::shared_ptr<CardModel>>& cards) {
-    std::random_device rd;
-    std::mt19937 g(rd());
-    std::shuffle(cards.begin(), cards.end(), g);
+void GameModelFromLevelGenerator::shuffleCards(std::vector<std::shared_ptr<CardModel>>& cards, EngineContext& engineContext) {
+    std::shuffle(cards.begin(), cards.end(), engineContext);
 }
 
-std::shared_ptr<CardModel> GameModelFromLevelGenerator::createCardFromConfig(const CardConfigData& configData) {
+std::shared_ptr<CardModel> GameModelFromLevelGenerator::createCardFromConfig(const CardConfigData& configData, EngineContext& engineContext) {
     auto cardModel = std::make_shared<CardModel>(configData.cardFace, configData.cardSuit, configData.position);
-    cardModel->setCardId(generateUniqueCardId());
+    cardModel->setCardId(engineContext.allocateCardId());
     return cardModel;
 }
 
@@ -195,25 +197,6 @@ std::string GameModelFromLevelGenerator::getGenerationSummary(std::shared_ptr<Ga
     return std::string(buffer);
 }
 
-int GameModelFromLevelGenerator::generateUniqueCardId() {
-    // 首次调用时从配置中初始化起始ID
-    static bool initialized = false;
-    if (!initialized) {
-        auto configManager = getConfigManager();
-        if (configManager) {
-            auto gameRulesConfig = configManager->getGameRulesConfig();
-            s_nextCardId = gameRulesConfig->getStartingCardId();
-        }
-        initialized = true;
-    }
-
-    return s_nextCardId++;
-}
-
-ConfigManager* GameModelFromLevelGenerator::getConfigManager() {
-    return ConfigManager::getInstance();
-}
-
 bool GameModelFromLevelGenerator::validateCardConfigData(const CardConfigData& configData) {
     // 检查牌面类型
     if (static_cast<int>(configData.cardFace) < 0 || 
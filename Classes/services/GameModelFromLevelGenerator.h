@@ -1,10 +1,10 @@
 #ifndef __GAME_MODEL_FROM_LEVEL_GENERATOR_H__
 #define __GAME_MODEL_FROM_LEVEL_GENERATOR_H__
 
-#include "cocos2d.h"
+#include "../utils/PlatformShim.h"
 #include "../models/GameModel.h"
 #include "../configs/models/LevelConfig.h"
-#include "../managers/ConfigManager.h"
+#include "../managers/EngineContext.h"
 #include <memory>
 
 USING_NS_CC;
@@ -13,6 +13,7 @@ USING_NS_CC;
  * 游戏模型生成服务
  * 将静态配置（LevelConfig）转换为动态运行时数据（GameModel）
  * 处理卡牌随机生成策略等业务逻辑
+ * 卡牌ID与随机数取自传入的引擎上下文，不同上下文的生成互不影响
  * 
  * 服务层特点：
  * - 提供无状态的服务，不管理数据生命周期
@@ -24,19 +25,23 @@ class GameModelFromLevelGenerator {
 public:
     /**
      * 从关卡配置生成游戏模型
+     * @param engineContext 引擎上下文
      * @param levelConfig 关卡配置
      * @return 生成的游戏模型，失败返回nullptr
      */
-    static std::shared_ptr<GameModel> generateGameModel(std::shared_ptr<LevelConfig> levelConfig);
+    static std::shared_ptr<GameModel> generateGameModel(std::shared_ptr<EngineContext> engineContext,
+                                                       std::shared_ptr<LevelConfig> levelConfig);
     
     /**
      * 从关卡配置生成游戏模型（带自定义参数）
+     * @param engineContext 引擎上下文
      * @param levelConfig 关卡配置
      * @param shufflePlayfield 是否打乱桌面牌
      * @param shuffleStack 是否打乱手牌堆
      * @return 生成的游戏模型，失败返回nullptr
      */
-    static std::shared_ptr<GameModel> generateGameModel(std::shared_ptr<LevelConfig> levelConfig,
+    static std::shared_ptr<GameModel> generateGameModel(std::shared_ptr<EngineContext> engineContext,
+                                                       std::shared_ptr<LevelConfig> levelConfig,
                                                        bool shufflePlayfield,
                                                        bool shuffleStack);
     
@@ -79,15 +84,17 @@ public:
     /**
      * 打乱卡牌数组
      * @param cards 卡牌数组
+     * @param engineContext 引擎上下文（提供随机数）
      */
-    static void shuffleCards(std::vector<std::shared_ptr<CardModel>>& cards);
+    static void shuffleCards(std::vector<std::shared_ptr<CardModel>>& cards, EngineContext& engineContext);
     
     /**
      * 从配置数据创建卡牌模型
      * @param configData 配置数据
+     * @param engineContext 引擎上下文（分配卡牌ID）
      * @return 卡牌模型
      */
-    static std::shared_ptr<CardModel> createCardFromConfig(const CardConfigData& configData);
+    static std::shared_ptr<CardModel> createCardFromConfig(const CardConfigData& configData, EngineContext& engineContext);
     
     /**
      * 获取生成统计信息
@@ -102,12 +109,6 @@ private:
      */
     GameModelFromLevelGenerator() = delete;
     
-    /**
-     * 生成唯一的卡牌ID
-     * @return 卡牌ID
-     */
-    static int generateUniqueCardId();
-    
     /**
      * 验证卡牌配置数据
      * @param configData 配置数据
@@ -121,15 +122,6 @@ private:
      * @param isPlayfieldCard 是否为桌面牌
      */
     static void setupCardGameProperties(std::shared_ptr<CardModel> cardModel, bool isPlayfieldCard);
-    
-    // 静态计数器
-    static int s_nextCardId;
-
-    /**
-     * 获取配置管理器
-     * @return 配置管理器实例
-     */
-    static ConfigManager* getConfigManager();
 };
 
 #endif // __GAME_MODEL_FROM_LEVEL_GENERATOR_H__
@@ -0,0 +1,94 @@
+#include "GameRulesService.h"
+#include <cstdlib>
+
+bool GameRulesService::canMatch(const CardModel& card, const CardModel& currentCard,
+                                const GameRulesConfig::MatchingRules& rules) {
+    if (!rules.ignoreSuit && card.getSuit() != currentCard.getSuit()) {
+        return false;
+    }
+
+    int diff = abs(static_cast<int>(card.getFace()) - static_cast<int>(currentCard.getFace()));
+    if (diff == rules.matchDifference) {
+        return true;
+    }
+
+    // 循环匹配：点数首尾相接（差值为1时即A与K）
+    return rules.allowCyclicMatching && diff == CFT_NUM_CARD_FACE_TYPES - rules.matchDifference;
+}
+
+GameRulesService::MoveResult GameRulesService::checkPlayfieldMove(const GameModel& gameModel, int cardId,
+                                                                  const GameRulesConfig::MatchingRules& rules) {
+    auto currentCard = gameModel.getCurrentCard();
+    if (!currentCard) {
+        return MOVE_NO_CURRENT_CARD;
+    }
+
+    auto card = gameModel.getPlayfieldCard(cardId);
+    if (!card) {
+        return MOVE_CARD_NOT_IN_PLAYFIELD;
+    }
+    if (!card->isFlipped()) {
+        return MOVE_CARD_FACE_DOWN;
+    }
+    if (!canMatch(*card, *currentCard, rules)) {
+        return MOVE_NOT_MATCHABLE;
+    }
+    return MOVE_OK;
+}
+
+GameRulesService::MoveResult GameRulesService::applyPlayfieldMove(GameModel& gameModel, int cardId,
+                                                                  const GameRulesConfig::MatchingRules& rules) {
+    MoveResult result = checkPlayfieldMove(gameModel, cardId, rules);
+    if (result != MOVE_OK) {
+        return result;
+    }
+
+    gameModel.pushCurrentCard(gameModel.getPlayfieldCard(cardId));
+    gameModel.removePlayfieldCard(cardId);
+    return MOVE_OK;
+}
+
+GameRulesService::MoveResult GameRulesService::checkStackDraw(const GameModel& gameModel) {
+    return gameModel.isStackEmpty() ? MOVE_STACK_EMPTY : MOVE_OK;
+}
+
+GameRulesService::MoveResult GameRulesService::applyStackDraw(GameModel& gameModel) {
+    MoveResult result = checkStackDraw(gameModel);
+    if (result != MOVE_OK) {
+        return result;
+    }
+
+    gameModel.pushCurrentCard(gameModel.removeTopStackCard());
+    return MOVE_OK;
+}
+
+std::shared_ptr<CardModel> GameRulesService::revealNextStackCard(GameModel& gameModel) {
+    for (const auto& card : gameModel.getStackCards()) {
+        if (!card->isFlipped()) {
+            card->setFlipped(true);
+            return card;
+        }
+    }
+    return nullptr;
+}
+
+bool GameRulesService::dealInitialCard(GameModel& gameModel) {
+    if (!gameModel.isCurrentCardStackEmpty() || gameModel.isStackEmpty()) {
+        return false;
+    }
+
+    gameModel.pushCurrentCard(gameModel.removeTopStackCard());
+    return true;
+}
+
+const char* GameRulesService::getMoveResultName(MoveResult result) {
+    switch (result) {
+        case MOVE_OK:                       return "ok";
+        case MOVE_NO_CURRENT_CARD:          return "no-current-card";
+        case MOVE_CARD_NOT_IN_PLAYFIELD:    return "card-not-in-playfield";
+        case MOVE_CARD_FACE_DOWN:           return "card-face-down";
+        case MOVE_NOT_MATCHABLE:            return "not-matchable";
+        case MOVE_STACK_EMPTY:              return "stack-empty";
+        default:                            return "unknown";
+    }
+}
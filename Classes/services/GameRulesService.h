@@ -0,0 +1,105 @@
+#ifndef __GAME_RULES_SERVICE_H__
+#define __GAME_RULES_SERVICE_H__
+
+#include "../utils/PlatformShim.h"
+#include "../models/GameModel.h"
+#include "../configs/models/GameRulesConfig.h"
+#include <memory>
+
+USING_NS_CC;
+
+/**
+ * 游戏规则服务
+ * 出牌规则的唯一实现：桌面牌能否与底牌匹配、翻手牌、开局发底牌。
+ * 只读写GameModel，不涉及视图、动画与撤销记录：
+ * 控制器在记录撤销、播放动画的同时调用本服务判定与更新模型，
+ * 回放校验等无界面场景直接调用本服务按同一规则重放。
+ *
+ * 无状态、不访问引擎对象，可在任意线程并行调用（各线程操作各自的GameModel）
+ */
+class GameRulesService {
+public:
+    /**
+     * 出牌判定结果
+     */
+    enum MoveResult {
+        MOVE_OK,                    // 合法
+        MOVE_NO_CURRENT_CARD,       // 还没有底牌
+        MOVE_CARD_NOT_IN_PLAYFIELD, // 卡牌不在桌面（不存在或已移走）
+        MOVE_CARD_FACE_DOWN,        // 卡牌背面朝上
+        MOVE_NOT_MATCHABLE,         // 与底牌不匹配
+        MOVE_STACK_EMPTY            // 手牌堆已空
+    };
+
+    /**
+     * 检查卡牌能否与底牌匹配
+     * 点数相差matchDifference即可匹配；允许循环匹配时A与K视为相邻；不忽略花色时还需花色相同
+     * @param card 待出的卡牌
+     * @param currentCard 当前底牌
+     * @param rules 匹配规则
+     * @return 是否可以匹配
+     */
+    static bool canMatch(const CardModel& card, const CardModel& currentCard,
+                         const GameRulesConfig::MatchingRules& rules);
+
+    /**
+     * 检查桌面牌能否打到底牌上
+     * @param gameModel 游戏模型
+     * @param cardId 桌面牌ID
+     * @param rules 匹配规则
+     * @return 判定结果
+     */
+    static MoveResult checkPlayfieldMove(const GameModel& gameModel, int cardId,
+                                         const GameRulesConfig::MatchingRules& rules);
+
+    /**
+     * 把桌面牌打到底牌上：判定合法后压入底牌栈并从桌面移除
+     * @param gameModel 游戏模型
+     * @param cardId 桌面牌ID
+     * @param rules 匹配规则
+     * @return 判定结果，不合法时模型不变
+     */
+    static MoveResult applyPlayfieldMove(GameModel& gameModel, int cardId,
+                                         const GameRulesConfig::MatchingRules& rules);
+
+    /**
+     * 检查能否翻手牌
+     * @param gameModel 游戏模型
+     * @return 判定结果
+     */
+    static MoveResult checkStackDraw(const GameModel& gameModel);
+
+    /**
+     * 翻手牌：手牌堆顶的牌压入底牌栈并从手牌堆移除
+     * 之后应调用revealNextStackCard翻开下一张手牌
+     * @param gameModel 游戏模型
+     * @return 判定结果，不合法时模型不变
+     */
+    static MoveResult applyStackDraw(GameModel& gameModel);
+
+    /**
+     * 翻开手牌堆中下一张背面朝上的牌
+     * @param gameModel 游戏模型
+     * @return 翻开的卡牌，没有需要翻开的牌时返回nullptr
+     */
+    static std::shared_ptr<CardModel> revealNextStackCard(GameModel& gameModel);
+
+    /**
+     * 开局发底牌：底牌栈为空时把手牌堆顶的牌设为底牌（不计为一步）
+     * @param gameModel 游戏模型
+     * @return 是否发牌，已有底牌或手牌堆为空时返回false
+     */
+    static bool dealInitialCard(GameModel& gameModel);
+
+    /**
+     * 获取判定结果名称（用于日志与校验输出）
+     * @param result 判定结果
+     * @return 名称，如"not-matchable"
+     */
+    static const char* getMoveResultName(MoveResult result);
+
+private:
+    GameRulesService() = delete;
+};
+
+#endif // __GAME_RULES_SERVICE_H__
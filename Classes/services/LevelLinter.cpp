@@ -0,0 +1,144 @@
+#include "LevelLinter.h"
+
+std::vector<LevelLinter::Issue> LevelLinter::lint(const LevelConfig& config, const Options& options) {
+    std::vector<Issue> issues;
+    const auto& playfieldCards = config.getPlayfieldCards();
+    const auto& stackCards = config.getStackCards();
+    Size playfieldSize = config.getPlayfieldSize();
+
+    // 每张牌出现的次数及首次出现的位置
+    int cardCounts[CFT_NUM_CARD_FACE_TYPES][CST_NUM_CARD_SUIT_TYPES] = {};
+    std::string firstLocations[CFT_NUM_CARD_FACE_TYPES][CST_NUM_CARD_SUIT_TYPES];
+
+    auto countCard = [&](const CardConfigData& card, const std::string& location) {
+        int& count = cardCounts[card.cardFace][card.cardSuit];
+        std::string& firstLocation = firstLocations[card.cardFace][card.cardSuit];
+        count++;
+        if (count == 1) {
+            firstLocation = location;
+        } else if (count > options.maxDecks) {
+            Issue issue;
+            issue.severity = SEVERITY_ERROR;
+            issue.rule = "duplicate-card";
+            issue.location = location;
+            issue.message = StringUtils::format("%s appears %d times (first at %s), limit is %d",
+                                                formatCard(card).c_str(), count,
+                                                firstLocation.c_str(), options.maxDecks);
+            issues.push_back(issue);
+        }
+    };
+
+    for (size_t i = 0; i < playfieldCards.size(); i++) {
+        const CardConfigData& card = playfieldCards[i];
+        std::string location = formatLocation("Playfield", i);
+
+        if (!isValidCard(card)) {
+            Issue issue;
+            issue.severity = SEVERITY_ERROR;
+            issue.rule = "invalid-card";
+            issue.location = location;
+            issue.message = StringUtils::format("Invalid face/suit %d/%d",
+                                                static_cast<int>(card.cardFace), static_cast<int>(card.cardSuit));
+            issues.push_back(issue);
+            continue;
+        }
+        countCard(card, location);
+
+        // 卡牌位置为中心点，相对桌面区域
+        const Vec2& position = card.position;
+        if (position.x < 0 || position.y < 0 ||
+            position.x > playfieldSize.width || position.y > playfieldSize.height) {
+            Issue issue;
+            issue.severity = SEVERITY_ERROR;
+            issue.rule = "out-of-bounds";
+            issue.location = location;
+            issue.message = StringUtils::format("Position (%.1f, %.1f) is outside PlayfieldSize %.0fx%.0f",
+                                                position.x, position.y,
+                                                playfieldSize.width, playfieldSize.height);
+            issues.push_back(issue);
+        }
+
+        for (size_t j = 0; j < i; j++) {
+            if (position.distance(playfieldCards[j].position) <= options.overlapTolerance) {
+                Issue issue;
+                issue.severity = SEVERITY_ERROR;
+                issue.rule = "overlapping-position";
+                issue.location = location;
+                issue.message = StringUtils::format("Same position (%.1f, %.1f) as %s",
+                                                    position.x, position.y,
+                                                    formatLocation("Playfield", j).c_str());
+                issues.push_back(issue);
+                break;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < stackCards.size(); i++) {
+        const CardConfigData& card = stackCards[i];
+        std::string location = formatLocation("Stack", i);
+
+        if (!isValidCard(card)) {
+            Issue issue;
+            issue.severity = SEVERITY_ERROR;
+            issue.rule = "invalid-card";
+            issue.location = location;
+            issue.message = StringUtils::format("Invalid face/suit %d/%d",
+                                                static_cast<int>(card.cardFace), static_cast<int>(card.cardSuit));
+            issues.push_back(issue);
+            continue;
+        }
+        countCard(card, location);
+    }
+
+    if (playfieldCards.empty()) {
+        Issue issue;
+        issue.severity = SEVERITY_ERROR;
+        issue.rule = "empty-area";
+        issue.message = "No playfield cards";
+        issues.push_back(issue);
+    }
+
+    if (stackCards.empty()) {
+        Issue issue;
+        issue.severity = SEVERITY_WARNING;
+        issue.rule = "empty-area";
+        issue.message = "No stack cards";
+        issues.push_back(issue);
+    }
+
+    return issues;
+}
+
+bool LevelLinter::hasErrors(const std::vector<Issue>& issues) {
+    for (const auto& issue : issues) {
+        if (issue.severity == SEVERITY_ERROR) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* LevelLinter::getSeverityName(Severity severity) {
+    return severity == SEVERITY_ERROR ? "error" : "warning";
+}
+
+bool LevelLinter::isValidCard(const CardConfigData& card) {
+    return static_cast<int>(card.cardFace) >= 0 &&
+           static_cast<int>(card.cardFace) < CFT_NUM_CARD_FACE_TYPES &&
+           static_cast<int>(card.cardSuit) >= 0 &&
+           static_cast<int>(card.cardSuit) < CST_NUM_CARD_SUIT_TYPES;
+}
+
+std::string LevelLinter::formatLocation(const char* area, size_t index) {
+    return StringUtils::format("%s[%zu]", area, index);
+}
+
+std::string LevelLinter::formatCard(const CardConfigData& card) {
+    static const char* const kFaceNames[] = {
+        "A", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K"
+    };
+    static const char* const kSuitNames[] = {
+        "Clubs", "Diamonds", "Hearts", "Spades"
+    };
+    return StringUtils::format("%s of %s", kFaceNames[card.cardFace], kSuitNames[card.cardSuit]);
+}
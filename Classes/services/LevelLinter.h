@@ -0,0 +1,91 @@
+#ifndef __LEVEL_LINTER_H__
+#define __LEVEL_LINTER_H__
+
+#include "../utils/PlatformShim.h"
+#include "../configs/models/LevelConfig.h"
+#include <string>
+#include <vector>
+
+USING_NS_CC;
+
+/**
+ * 关卡内容检查服务
+ * 在格式校验之外检查关卡内容是否合理：
+ * - invalid-card：牌面或花色超出取值范围（含NONE等不可能的组合）
+ * - out-of-bounds：桌面牌位置超出PlayfieldSize
+ * - overlapping-position：两张桌面牌位置重合
+ * - duplicate-card：同一张牌出现次数超过允许的副数
+ * - empty-area：桌面无牌（错误）或备用牌堆无牌（警告）
+ *
+ * 无状态、不访问引擎对象，可在任意线程并行调用
+ */
+class LevelLinter {
+public:
+    /**
+     * 问题严重程度
+     */
+    enum Severity {
+        SEVERITY_WARNING,
+        SEVERITY_ERROR
+    };
+
+    /**
+     * 检查出的问题
+     */
+    struct Issue {
+        Severity severity;          // 严重程度
+        std::string rule;           // 规则名
+        std::string location;       // 位置，如"Playfield[3]"，关卡级问题为空
+        std::string message;        // 描述
+    };
+
+    /**
+     * 检查选项
+     */
+    struct Options {
+        int maxDecks;               // 允许的牌副数，同一张牌最多出现的次数
+        float overlapTolerance;     // 位置重合判定距离
+
+        Options() : maxDecks(1), overlapTolerance(1.0f) {}
+    };
+
+    /**
+     * 检查关卡
+     * @param config 关卡配置
+     * @param options 检查选项
+     * @return 问题列表，无问题时为空
+     */
+    static std::vector<Issue> lint(const LevelConfig& config, const Options& options = Options());
+
+    /**
+     * 问题列表中是否包含错误
+     * @param issues 问题列表
+     * @return 是否包含错误
+     */
+    static bool hasErrors(const std::vector<Issue>& issues);
+
+    /**
+     * 获取严重程度名称
+     * @param severity 严重程度
+     * @return "error"或"warning"
+     */
+    static const char* getSeverityName(Severity severity);
+
+private:
+    /**
+     * 检查牌面与花色取值
+     */
+    static bool isValidCard(const CardConfigData& card);
+
+    /**
+     * 格式化卡牌位置描述
+     */
+    static std::string formatLocation(const char* area, size_t index);
+
+    /**
+     * 格式化牌面描述，如"K of Spades"
+     */
+    static std::string formatCard(const CardConfigData& card);
+};
+
+#endif // __LEVEL_LINTER_H__
@@ -0,0 +1,102 @@
+#include "ReplayValidator.h"
+#include "GameModelFromLevelGenerator.h"
+#include <climits>
+
+bool ReplayValidator::parseMoves(const std::string& text, std::vector<Move>& moves, std::string& errorMessage) {
+    moves.clear();
+    moves.reserve(text.size() / 2);
+
+    size_t i = 0;
+    while (i < text.size()) {
+        Move move;
+        char type = text[i++];
+        if (type == 's') {
+            move.type = Move::STACK;
+            move.playfieldIndex = -1;
+            moves.push_back(move);
+            continue;
+        }
+
+        if (type != 'p') {
+            errorMessage = StringUtils::format("Unexpected '%c' at offset %zu", type, i - 1);
+            return false;
+        }
+
+        // 'p'后必须跟至少一位十进制下标
+        size_t digitsStart = i;
+        long index = 0;
+        while (i < text.size() && text[i] >= '0' && text[i] <= '9') {
+            index = index * 10 + (text[i] - '0');
+            if (index > INT_MAX) {
+                errorMessage = StringUtils::format("Card index too large at offset %zu", digitsStart);
+                return false;
+            }
+            i++;
+        }
+        if (i == digitsStart) {
+            errorMessage = StringUtils::format("Missing card index at offset %zu", digitsStart);
+            return false;
+        }
+
+        move.type = Move::PLAYFIELD;
+        move.playfieldIndex = static_cast<int>(index);
+        moves.push_back(move);
+    }
+
+    return true;
+}
+
+ReplayValidator::Result ReplayValidator::validate(std::shared_ptr<EngineContext> engineContext,
+                                                  std::shared_ptr<LevelConfig> levelConfig,
+                                                  const std::vector<Move>& moves) {
+    // 不打乱，桌面牌顺序与关卡Playfield数组一致
+    auto gameModel = GameModelFromLevelGenerator::generateGameModel(engineContext, levelConfig, false, false);
+    if (!gameModel || !GameRulesService::dealInitialCard(*gameModel)) {
+        return reject(-1, "invalid-level");
+    }
+
+    // 关卡下标到卡牌ID（卡牌打出后桌面列表会变化，先记下）
+    std::vector<int> playfieldCardIds;
+    playfieldCardIds.reserve(gameModel->getPlayfieldCards().size());
+    for (const auto& card : gameModel->getPlayfieldCards()) {
+        playfieldCardIds.push_back(card->getCardId());
+    }
+
+    GameRulesConfig::MatchingRules rules = engineContext->getGameRulesConfig()->getMatchingRules();
+    for (size_t i = 0; i < moves.size(); i++) {
+        const Move& move = moves[i];
+        GameRulesService::MoveResult moveResult;
+        if (move.type == Move::STACK) {
+            moveResult = GameRulesService::applyStackDraw(*gameModel);
+            if (moveResult == GameRulesService::MOVE_OK) {
+                GameRulesService::revealNextStackCard(*gameModel);
+            }
+        } else {
+            if (move.playfieldIndex < 0 || move.playfieldIndex >= static_cast<int>(playfieldCardIds.size())) {
+                return reject(static_cast<int>(i), "card-index-out-of-range");
+            }
+            moveResult = GameRulesService::applyPlayfieldMove(*gameModel, playfieldCardIds[move.playfieldIndex], rules);
+        }
+
+        if (moveResult != GameRulesService::MOVE_OK) {
+            return reject(static_cast<int>(i), GameRulesService::getMoveResultName(moveResult));
+        }
+    }
+
+    if (!gameModel->isGameWon()) {
+        return reject(static_cast<int>(moves.size()), "level-not-cleared");
+    }
+
+    Result result;
+    result.isAccepted = true;
+    result.failedMoveIndex = -1;
+    return result;
+}
+
+ReplayValidator::Result ReplayValidator::reject(int failedMoveIndex, const std::string& reason) {
+    Result result;
+    result.isAccepted = false;
+    result.failedMoveIndex = failedMoveIndex;
+    result.reason = reason;
+    return result;
+}
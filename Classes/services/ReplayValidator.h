@@ -0,0 +1,81 @@
+#ifndef __REPLAY_VALIDATOR_H__
+#define __REPLAY_VALIDATOR_H__
+
+#include "../utils/PlatformShim.h"
+#include "../configs/models/LevelConfig.h"
+#include "../managers/EngineContext.h"
+#include "GameRulesService.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+USING_NS_CC;
+
+/**
+ * 回放校验服务
+ * 按关卡生成游戏模型、发开局底牌后，用GameRulesService逐步重放提交的出牌序列，
+ * 全部合法且桌面清空时通过，否则给出第一个失败的步骤。用于排行榜等服务端校验。
+ *
+ * 紧凑出牌序列：每步为"p<下标>"（打出关卡Playfield数组中该下标的桌面牌）或"s"（翻手牌），
+ * 依次连写，如"p3p7sp0"。桌面牌按关卡中的下标而不是运行时卡牌ID引用，与卡牌ID的分配无关。
+ * 暂不支持撤销步骤。
+ *
+ * 无状态，可在任意线程并行调用（关卡配置只读共享）；卡牌ID与匹配规则取自传入的引擎上下文，
+ * 并行校验时每个线程使用各自的上下文可避免争用
+ */
+class ReplayValidator {
+public:
+    /**
+     * 单步出牌
+     */
+    struct Move {
+        enum Type {
+            PLAYFIELD,              // 打出桌面牌
+            STACK                   // 翻手牌
+        };
+
+        Type type;                  // 类型
+        int playfieldIndex;         // 桌面牌在关卡Playfield数组中的下标（仅PLAYFIELD）
+    };
+
+    /**
+     * 校验结果
+     */
+    struct Result {
+        bool isAccepted;            // 是否通过
+        int failedMoveIndex;        // 第一个失败步骤的下标；全部合法但未清空桌面时为步数；关卡无效时为-1
+        std::string reason;         // 失败原因，如"not-matchable"、"level-not-cleared"，通过时为空
+
+        Result() : isAccepted(false), failedMoveIndex(-1) {}
+    };
+
+    /**
+     * 解析紧凑出牌序列
+     * @param text 出牌序列，如"p3p7sp0"
+     * @param moves 输出的出牌列表
+     * @param errorMessage 输出的错误信息
+     * @return 是否解析成功
+     */
+    static bool parseMoves(const std::string& text, std::vector<Move>& moves, std::string& errorMessage);
+
+    /**
+     * 重放并校验出牌序列
+     * @param engineContext 引擎上下文（提供匹配规则与卡牌ID）
+     * @param levelConfig 关卡配置（只读）
+     * @param moves 出牌列表
+     * @return 校验结果
+     */
+    static Result validate(std::shared_ptr<EngineContext> engineContext,
+                           std::shared_ptr<LevelConfig> levelConfig,
+                           const std::vector<Move>& moves);
+
+private:
+    ReplayValidator() = delete;
+
+    /**
+     * 生成拒绝结果
+     */
+    static Result reject(int failedMoveIndex, const std::string& reason);
+};
+
+#endif // __REPLAY_VALIDATOR_H__
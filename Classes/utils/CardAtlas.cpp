@@ -0,0 +1,65 @@
+#include "CardAtlas.h"
+
+const char* const CardAtlas::kAtlasPlistPath = "res/card_atlas.plist";
+const char* const CardAtlas::kAtlasImagePath = "res/card_atlas.png";
+
+bool CardAtlas::s_isLoaded = false;
+bool CardAtlas::s_hasTriedLoad = false;
+
+bool CardAtlas::load() {
+    if (s_hasTriedLoad) {
+        return s_isLoaded;
+    }
+    s_hasTriedLoad = true;
+
+    if (!FileUtils::getInstance()->isFileExist(kAtlasPlistPath)) {
+        CCLOG("CardAtlas::load - %s not found, using loose card images", kAtlasPlistPath);
+        return false;
+    }
+
+    SpriteFrameCache::getInstance()->addSpriteFramesWithFile(kAtlasPlistPath);
+    s_isLoaded = SpriteFrameCache::getInstance()->isSpriteFramesWithFileLoaded(kAtlasPlistPath);
+    if (!s_isLoaded) {
+        CCLOG("CardAtlas::load - Failed to load %s, using loose card images", kAtlasPlistPath);
+    }
+    return s_isLoaded;
+}
+
+SpriteFrame* CardAtlas::getSpriteFrame(const std::string& imagePath) {
+    load();
+
+    auto spriteFrameCache = SpriteFrameCache::getInstance();
+    SpriteFrame* spriteFrame = spriteFrameCache->getSpriteFrameByName(imagePath);
+    if (spriteFrame) {
+        return spriteFrame;
+    }
+
+    // 图集缺失或未包含该图片：回退到散图，以同名缓存避免重复创建
+    auto texture = Director::getInstance()->getTextureCache()->addImage(imagePath);
+    if (!texture) {
+        CCLOG("CardAtlas::getSpriteFrame - Failed to load %s", imagePath.c_str());
+        return nullptr;
+    }
+
+    Rect rect(Vec2::ZERO, texture->getContentSize());
+    spriteFrame = SpriteFrame::createWithTexture(texture, rect);
+    spriteFrameCache->addSpriteFrame(spriteFrame, imagePath);
+    return spriteFrame;
+}
+
+Sprite* CardAtlas::createSprite(const std::string& imagePath) {
+    SpriteFrame* spriteFrame = getSpriteFrame(imagePath);
+    return spriteFrame ? Sprite::createWithSpriteFrame(spriteFrame) : nullptr;
+}
+
+void CardAtlas::getTexturePaths(const std::vector<std::string>& imagePaths, std::vector<std::string>& texturePaths) {
+    texturePaths.clear();
+
+    // 图集帧索引加载时按同一路径从纹理缓存取纹理，预加载图集纹理即可
+    auto fileUtils = FileUtils::getInstance();
+    if (fileUtils->isFileExist(kAtlasPlistPath) && fileUtils->isFileExist(kAtlasImagePath)) {
+        texturePaths.push_back(kAtlasImagePath);
+        return;
+    }
+    texturePaths = imagePaths;
+}
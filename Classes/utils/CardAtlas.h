@@ -0,0 +1,61 @@
+#ifndef __CARD_ATLAS_H__
+#define __CARD_ATLAS_H__
+
+#include "cocos2d.h"
+#include <string>
+#include <vector>
+
+USING_NS_CC;
+
+/**
+ * 卡牌图集
+ * 构建期由 tools/pack_card_atlas.py 把卡牌散图打包为 res/card_atlas.png/.plist，
+ * 帧名即散图路径（如"res/number/big_black_A.png"）。
+ * 所有卡牌精灵共用一张纹理，引擎可自动合批，一屏卡牌只需少量绘制调用。
+ * 图集缺失时按同一路径回退到散图，调用方无需区分
+ */
+class CardAtlas {
+public:
+    /**
+     * 加载图集到SpriteFrameCache（只加载一次）
+     * @return 图集是否可用
+     */
+    static bool load();
+
+    /**
+     * 图集是否已加载
+     */
+    static bool isLoaded() { return s_isLoaded; }
+
+    /**
+     * 获取卡牌图片对应的精灵帧
+     * 优先取图集中的帧，缺失时加载散图并以同名缓存
+     * @param imagePath 图片路径（相对Resources目录）
+     * @return 精灵帧，图片不存在时返回nullptr
+     */
+    static SpriteFrame* getSpriteFrame(const std::string& imagePath);
+
+    /**
+     * 创建使用卡牌图片的精灵
+     * @param imagePath 图片路径（相对Resources目录）
+     * @return 精灵，图片不存在时返回nullptr
+     */
+    static Sprite* createSprite(const std::string& imagePath);
+
+    /**
+     * 获取显示指定卡牌图片实际需要加载的纹理文件（用于预加载）
+     * 图集存在时只需图集纹理，否则为各散图本身
+     * @param imagePaths 卡牌图片路径
+     * @param texturePaths 输出纹理文件路径（先清空）
+     */
+    static void getTexturePaths(const std::vector<std::string>& imagePaths, std::vector<std::string>& texturePaths);
+
+private:
+    static const char* const kAtlasPlistPath;   // 图集帧索引路径
+    static const char* const kAtlasImagePath;   // 图集纹理路径
+
+    static bool s_isLoaded;                     // 图集是否已加载
+    static bool s_hasTriedLoad;                 // 是否已尝试加载
+};
+
+#endif // __CARD_ATLAS_H__
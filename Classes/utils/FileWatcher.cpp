@@ -0,0 +1,217 @@
+#include "FileWatcher.h"
+#include <sys/stat.h>
+#include <chrono>
+
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_LINUX)
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+const int FileWatcher::kDefaultPollIntervalMs = 250;
+
+// inotify模式下检查停止标记的间隔（毫秒）
+static const int kInotifyWaitTimeoutMs = 100;
+
+FileWatcher::FileWatcher()
+    : _scheduler(nullptr)
+    , _isRunning(false)
+    , _pollIntervalMs(kDefaultPollIntervalMs) {
+}
+
+FileWatcher::~FileWatcher() {
+    stop();
+}
+
+bool FileWatcher::start(const std::vector<std::string>& filePaths, const ChangeCallback& callback) {
+    if (_isRunning) {
+        CCLOG("FileWatcher::start - Already running");
+        return false;
+    }
+
+    if (filePaths.empty() || !callback) {
+        CCLOG("FileWatcher::start - Nothing to watch");
+        return false;
+    }
+
+    _filePaths = filePaths;
+    _callback = callback;
+    _scheduler = Director::getInstance()->getScheduler();
+    _aliveToken = std::make_shared<bool>(true);
+
+    _watchedFiles.clear();
+    for (const auto& filePath : _filePaths) {
+        size_t separator = filePath.find_last_of('/');
+        if (separator == std::string::npos) {
+            continue;
+        }
+        _watchedFiles[filePath.substr(0, separator)].insert(filePath.substr(separator + 1));
+    }
+
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_LINUX)
+    // 监视文件所在目录，编辑器以重命名方式保存时也能收到事件
+    int inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd >= 0) {
+        std::map<int, std::string> watchDirectories;
+        for (const auto& pair : _watchedFiles) {
+            int watchId = inotify_add_watch(inotifyFd, pair.first.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+            if (watchId >= 0) {
+                watchDirectories[watchId] = pair.first;
+            } else {
+                CCLOG("FileWatcher::start - Failed to watch %s", pair.first.c_str());
+            }
+        }
+
+        if (!watchDirectories.empty()) {
+            _isRunning = true;
+            _thread = std::thread(&FileWatcher::inotifyLoop, this, inotifyFd, watchDirectories);
+            CCLOG("FileWatcher::start - Watching %zu directories with inotify", watchDirectories.size());
+            return true;
+        }
+        close(inotifyFd);
+    }
+    CCLOG("FileWatcher::start - inotify unavailable, falling back to polling");
+#endif
+
+    _isRunning = true;
+    _thread = std::thread(&FileWatcher::pollLoop, this);
+    CCLOG("FileWatcher::start - Polling %zu files every %d ms", _filePaths.size(), _pollIntervalMs);
+    return true;
+}
+
+void FileWatcher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_isRunning) {
+            return;
+        }
+        _isRunning = false;
+    }
+    _stopCondition.notify_all();
+
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+
+    // 已投递但尚未执行的回调不再生效
+    _aliveToken.reset();
+}
+
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_LINUX)
+void FileWatcher::inotifyLoop(int inotifyFd, const std::map<int, std::string>& watchDirectories) {
+    // 按inotify_event对齐的读缓冲区
+    alignas(struct inotify_event) char buffer[4096];
+
+    struct pollfd pollFd;
+    pollFd.fd = inotifyFd;
+    pollFd.events = POLLIN;
+
+    while (_isRunning) {
+        pollFd.revents = 0;
+        int ready = poll(&pollFd, 1, kInotifyWaitTimeoutMs);
+        if (ready <= 0) {
+            continue;
+        }
+
+        // 一次读出当前所有事件，同一文件的多次写入合并为一次变化
+        std::set<std::string> changedFiles;
+        while (true) {
+            ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+            if (length <= 0) {
+                break;
+            }
+
+            for (char* ptr = buffer; ptr < buffer + length; ) {
+                const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(ptr);
+                ptr += sizeof(struct inotify_event) + event->len;
+
+                if (event->len == 0) {
+                    continue;
+                }
+
+                auto directory = watchDirectories.find(event->wd);
+                if (directory == watchDirectories.end()) {
+                    continue;
+                }
+
+                auto files = _watchedFiles.find(directory->second);
+                if (files != _watchedFiles.end() && files->second.count(event->name) > 0) {
+                    changedFiles.insert(directory->second + "/" + event->name);
+                }
+            }
+        }
+
+        if (!changedFiles.empty()) {
+            dispatchChanges(std::vector<std::string>(changedFiles.begin(), changedFiles.end()));
+        }
+    }
+
+    close(inotifyFd);
+}
+#endif
+
+void FileWatcher::pollLoop() {
+    std::map<std::string, long long> modificationTimes;
+    for (const auto& filePath : _filePaths) {
+        modificationTimes[filePath] = getModificationTime(filePath);
+    }
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _stopCondition.wait_for(lock, std::chrono::milliseconds(_pollIntervalMs), [this]() {
+                return !_isRunning;
+            });
+            if (!_isRunning) {
+                return;
+            }
+        }
+
+        std::vector<std::string> changedFiles;
+        for (auto& pair : modificationTimes) {
+            long long modificationTime = getModificationTime(pair.first);
+            if (modificationTime != pair.second) {
+                pair.second = modificationTime;
+                // 文件被删除时不上报，等待重新写入
+                if (modificationTime != 0) {
+                    changedFiles.push_back(pair.first);
+                }
+            }
+        }
+
+        if (!changedFiles.empty()) {
+            dispatchChanges(changedFiles);
+        }
+    }
+}
+
+void FileWatcher::dispatchChanges(const std::vector<std::string>& changedFiles) {
+    // 与stop互斥：stop返回后不会再投递
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_isRunning) {
+        return;
+    }
+
+    std::weak_ptr<bool> aliveToken = _aliveToken;
+    ChangeCallback callback = _callback;
+    _scheduler->performFunctionInCocosThread([aliveToken, callback, changedFiles]() {
+        if (aliveToken.expired()) {
+            return;
+        }
+        callback(changedFiles);
+    });
+}
+
+long long FileWatcher::getModificationTime(const std::string& filePath) {
+    struct stat fileStat;
+    if (stat(filePath.c_str(), &fileStat) != 0) {
+        return 0;
+    }
+
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_LINUX)
+    // 使用纳秒精度，避免同一秒内的多次保存被漏掉
+    return static_cast<long long>(fileStat.st_mtim.tv_sec) * 1000000000LL + fileStat.st_mtim.tv_nsec;
+#else
+    return static_cast<long long>(fileStat.st_mtime);
+#endif
+}
@@ -0,0 +1,114 @@
+#ifndef __FILE_WATCHER_H__
+#define __FILE_WATCHER_H__
+
+#include "cocos2d.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+USING_NS_CC;
+
+/**
+ * 文件变化监视器
+ * 在后台线程监视一组文件，Linux下使用inotify，其它平台按固定间隔轮询修改时间
+ * 同一批变化合并为一次回调，回调在主线程执行
+ */
+class FileWatcher {
+public:
+    /**
+     * 文件变化回调（主线程）
+     * @param changedFiles 发生变化的文件完整路径
+     */
+    typedef std::function<void(const std::vector<std::string>& changedFiles)> ChangeCallback;
+
+    /**
+     * 默认轮询间隔（毫秒，仅轮询模式）
+     */
+    static const int kDefaultPollIntervalMs;
+
+    /**
+     * 构造函数
+     */
+    FileWatcher();
+
+    /**
+     * 析构函数，停止监视并等待后台线程退出
+     */
+    ~FileWatcher();
+
+    /**
+     * 开始监视（需在主线程调用）
+     * @param filePaths 文件完整路径列表
+     * @param callback 变化回调
+     * @return 是否启动成功
+     */
+    bool start(const std::vector<std::string>& filePaths, const ChangeCallback& callback);
+
+    /**
+     * 停止监视，返回后不会再有新的回调被投递
+     */
+    void stop();
+
+    /**
+     * 是否正在监视
+     * @return 是否正在监视
+     */
+    bool isRunning() const { return _isRunning; }
+
+    /**
+     * 设置轮询间隔（需在start之前调用）
+     * @param intervalMs 间隔毫秒数
+     */
+    void setPollInterval(int intervalMs) { _pollIntervalMs = intervalMs; }
+
+private:
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_LINUX)
+    /**
+     * inotify监视循环（后台线程）
+     * @param inotifyFd inotify描述符
+     * @param watchDirectories 监视描述符到目录的映射
+     */
+    void inotifyLoop(int inotifyFd, const std::map<int, std::string>& watchDirectories);
+#endif
+
+    /**
+     * 轮询监视循环（后台线程）
+     */
+    void pollLoop();
+
+    /**
+     * 把变化投递到主线程
+     * @param changedFiles 发生变化的文件
+     */
+    void dispatchChanges(const std::vector<std::string>& changedFiles);
+
+    /**
+     * 获取文件修改时间
+     * @param filePath 文件路径
+     * @return 修改时间，文件不存在返回0
+     */
+    static long long getModificationTime(const std::string& filePath);
+
+    std::map<std::string, std::set<std::string>> _watchedFiles;  // 目录 -> 文件名
+    std::vector<std::string> _filePaths;        // 监视的文件
+    ChangeCallback _callback;                   // 变化回调
+    Scheduler* _scheduler;                      // 主线程调度器
+    std::thread _thread;                        // 后台线程
+    std::atomic<bool> _isRunning;               // 是否正在监视
+    int _pollIntervalMs;                        // 轮询间隔
+    std::mutex _mutex;                          // 保护停止与投递
+    std::condition_variable _stopCondition;     // 轮询等待中被停止唤醒
+    std::shared_ptr<bool> _aliveToken;          // 已投递回调的存活标记
+};
+
+#endif // __FILE_WATCHER_H__
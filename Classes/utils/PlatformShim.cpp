@@ -0,0 +1,168 @@
+#include "PlatformShim.h"
+
+// 正常构建使用cocos2d的实现，本文件为空
+#ifdef CARDGAME_HEADLESS
+
+#include <cstdarg>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+NS_CC_BEGIN
+
+const Vec2 Vec2::ZERO(0.0f, 0.0f);
+const Size Size::ZERO(0.0f, 0.0f);
+
+void log(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    fputc('\n', stderr);
+}
+
+namespace StringUtils {
+
+std::string format(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    int length = vsnprintf(nullptr, 0, format, argsCopy);
+    va_end(argsCopy);
+
+    std::string result;
+    if (length > 0) {
+        std::vector<char> buffer(length + 1);
+        vsnprintf(buffer.data(), buffer.size(), format, args);
+        result.assign(buffer.data(), length);
+    }
+    va_end(args);
+    return result;
+}
+
+} // namespace StringUtils
+
+FileUtils* FileUtils::getInstance() {
+    // 无状态，静态实例即可
+    static FileUtils s_instance;
+    return &s_instance;
+}
+
+std::string FileUtils::fullPathForFilename(const std::string& filename) const {
+    return isFileExist(filename) ? filename : std::string();
+}
+
+bool FileUtils::isFileExist(const std::string& filename) const {
+#ifdef _WIN32
+    DWORD attributes = GetFileAttributesA(filename.c_str());
+    return attributes != INVALID_FILE_ATTRIBUTES && !(attributes & FILE_ATTRIBUTE_DIRECTORY);
+#else
+    struct stat pathStat;
+    return stat(filename.c_str(), &pathStat) == 0 && S_ISREG(pathStat.st_mode);
+#endif
+}
+
+bool FileUtils::isDirectoryExist(const std::string& dirPath) const {
+#ifdef _WIN32
+    DWORD attributes = GetFileAttributesA(dirPath.c_str());
+    return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY);
+#else
+    struct stat pathStat;
+    return stat(dirPath.c_str(), &pathStat) == 0 && S_ISDIR(pathStat.st_mode);
+#endif
+}
+
+std::string FileUtils::getStringFromFile(const std::string& filename) const {
+    std::string content;
+    if (getContents(filename, &content) != Status::OK) {
+        content.clear();
+    }
+    return content;
+}
+
+FileUtils::Status FileUtils::getContents(const std::string& filename, std::string* buffer) const {
+    if (!buffer) {
+        return Status::NotInitialized;
+    }
+    if (filename.empty() || !isFileExist(filename)) {
+        return Status::NotExists;
+    }
+
+    FILE* file = fopen(filename.c_str(), "rb");
+    if (!file) {
+        return Status::OpenFailed;
+    }
+
+    long size = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        size = ftell(file);
+    }
+    if (size < 0 || fseek(file, 0, SEEK_SET) != 0) {
+        fclose(file);
+        return Status::ObtainSizeFailed;
+    }
+
+    buffer->resize(static_cast<size_t>(size));
+    size_t readSize = size > 0 ? fread(&(*buffer)[0], 1, buffer->size(), file) : 0;
+    bool hasError = ferror(file) != 0;
+    fclose(file);
+
+    if (hasError || readSize != buffer->size()) {
+        buffer->clear();
+        return Status::ReadFailed;
+    }
+    return Status::OK;
+}
+
+std::vector<std::string> FileUtils::listFiles(const std::string& dirPath) const {
+    std::vector<std::string> files;
+    if (!isDirectoryExist(dirPath)) {
+        return files;
+    }
+
+    std::string directory = dirPath;
+    if (directory[directory.size() - 1] != '/') {
+        directory += "/";
+    }
+
+#ifdef _WIN32
+    WIN32_FIND_DATAA findData;
+    HANDLE handle = FindFirstFileA((directory + "*").c_str(), &findData);
+    if (handle != INVALID_HANDLE_VALUE) {
+        do {
+            std::string name = findData.cFileName;
+            if (name == "." || name == "..") {
+                continue;
+            }
+            bool isDirectory = (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+            files.push_back(directory + name + (isDirectory ? "/" : ""));
+        } while (FindNextFileA(handle, &findData));
+        FindClose(handle);
+    }
+#else
+    DIR* dir = opendir(directory.c_str());
+    if (dir) {
+        while (struct dirent* entry = readdir(dir)) {
+            std::string name = entry->d_name;
+            if (name == "." || name == "..") {
+                continue;
+            }
+            std::string path = directory + name;
+            files.push_back(isDirectoryExist(path) ? path + "/" : path);
+        }
+        closedir(dir);
+    }
+#endif
+
+    return files;
+}
+
+NS_CC_END
+
+#endif // CARDGAME_HEADLESS
@@ -0,0 +1,169 @@
+#ifndef __PLATFORM_SHIM_H__
+#define __PLATFORM_SHIM_H__
+
+/**
+ * 规则核心的平台适配
+ * 规则核心（卡牌/游戏/撤销模型、撤销管理、关卡配置的解析与检查、游戏模型生成）
+ * 只用到cocos2d的Vec2、Size、CCLOG、StringUtils::format与FileUtils的文件读取/列举，统一经本头文件引入：
+ * - 正常构建时直接包含cocos2d.h，类型与引擎完全相同；
+ * - 定义CARDGAME_HEADLESS时提供同名的最小实现，规则核心可脱离cocos2d编译，
+ *   用于服务器、命令行工具与单元测试。此时CCLOG输出到stderr，stdout留给调用方
+ */
+#ifndef CARDGAME_HEADLESS
+
+#include "cocos2d.h"
+
+#else
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#define NS_CC_BEGIN namespace cocos2d {
+#define NS_CC_END }
+#define USING_NS_CC using namespace cocos2d
+
+// 与cocos2d一致：仅在COCOS2D_DEBUG大于0时输出
+#if !defined(COCOS2D_DEBUG) || COCOS2D_DEBUG == 0
+#define CCLOG(...) do {} while (0)
+#else
+#define CCLOG(format, ...) cocos2d::log(format, ##__VA_ARGS__)
+#endif
+
+NS_CC_BEGIN
+
+/**
+ * 输出一行日志到stderr
+ * @param format printf格式
+ */
+void log(const char* format, ...);
+
+/**
+ * 二维向量（cocos2d::Vec2的子集）
+ */
+class Vec2 {
+public:
+    float x;
+    float y;
+
+    Vec2() : x(0.0f), y(0.0f) {}
+    Vec2(float xx, float yy) : x(xx), y(yy) {}
+
+    Vec2 operator+(const Vec2& v) const { return Vec2(x + v.x, y + v.y); }
+    Vec2 operator-(const Vec2& v) const { return Vec2(x - v.x, y - v.y); }
+    Vec2 operator*(float s) const { return Vec2(x * s, y * s); }
+    Vec2 operator/(float s) const { return Vec2(x / s, y / s); }
+    Vec2& operator+=(const Vec2& v) { x += v.x; y += v.y; return *this; }
+    bool operator==(const Vec2& v) const { return x == v.x && y == v.y; }
+    bool operator!=(const Vec2& v) const { return !(*this == v); }
+
+    float distance(const Vec2& v) const { return std::sqrt(distanceSquared(v)); }
+    float distanceSquared(const Vec2& v) const { return (x - v.x) * (x - v.x) + (y - v.y) * (y - v.y); }
+
+    static const Vec2 ZERO;
+};
+
+/**
+ * 尺寸（cocos2d::Size的子集）
+ */
+class Size {
+public:
+    float width;
+    float height;
+
+    Size() : width(0.0f), height(0.0f) {}
+    Size(float w, float h) : width(w), height(h) {}
+
+    bool equals(const Size& target) const { return width == target.width && height == target.height; }
+    bool operator==(const Size& s) const { return equals(s); }
+    bool operator!=(const Size& s) const { return !equals(s); }
+
+    static const Size ZERO;
+};
+
+namespace StringUtils {
+
+/**
+ * 按printf格式生成字符串
+ * @param format printf格式
+ * @return 格式化后的字符串
+ */
+std::string format(const char* format, ...);
+
+} // namespace StringUtils
+
+/**
+ * 文件工具（cocos2d::FileUtils的子集）
+ * 没有搜索路径，路径按原样访问；与引擎一致，listFiles返回完整路径且目录以'/'结尾
+ */
+class FileUtils {
+public:
+    /**
+     * 读取结果（与cocos2d::FileUtils::Status取值一致）
+     */
+    enum class Status {
+        OK = 0,
+        NotExists = 1,
+        OpenFailed = 2,
+        ReadFailed = 3,
+        NotInitialized = 4,
+        TooLarge = 5,
+        ObtainSizeFailed = 6
+    };
+
+    /**
+     * 获取单例实例
+     * @return 文件工具实例
+     */
+    static FileUtils* getInstance();
+
+    /**
+     * 获取完整路径
+     * @param filename 文件路径
+     * @return 文件存在时返回原路径，否则返回空字符串
+     */
+    std::string fullPathForFilename(const std::string& filename) const;
+
+    /**
+     * 检查文件是否存在（目录返回false）
+     * @param filename 文件路径
+     * @return 是否存在
+     */
+    bool isFileExist(const std::string& filename) const;
+
+    /**
+     * 检查目录是否存在
+     * @param dirPath 目录路径
+     * @return 是否存在
+     */
+    bool isDirectoryExist(const std::string& dirPath) const;
+
+    /**
+     * 读取文件全部内容
+     * @param filename 文件路径
+     * @return 文件内容，失败时为空字符串
+     */
+    std::string getStringFromFile(const std::string& filename) const;
+
+    /**
+     * 读取文件全部内容，并给出失败原因
+     * @param filename 文件路径
+     * @param buffer 输出的文件内容
+     * @return 读取结果
+     */
+    Status getContents(const std::string& filename, std::string* buffer) const;
+
+    /**
+     * 列出目录中的文件与子目录（不含"."与".."，不保证顺序）
+     * @param dirPath 目录路径
+     * @return 完整路径列表，目录不存在时为空
+     */
+    std::vector<std::string> listFiles(const std::string& dirPath) const;
+};
+
+NS_CC_END
+
+#endif // CARDGAME_HEADLESS
+
+#endif // __PLATFORM_SHIM_H__
@@ -0,0 +1,72 @@
+#include "PlayfieldViewport.h"
+#include <algorithm>
+
+PlayfieldViewport::PlayfieldViewport()
+    : _zoom(1.0f)
+    , _maxZoom(1.0f) {
+}
+
+void PlayfieldViewport::reset(const Vec2& origin, const Size& size, const Size& worldSize) {
+    _origin = origin;
+    _size = size;
+    _worldSize = worldSize;
+    _zoom = getMinZoom();
+    _pan = Vec2::ZERO;
+    clamp();
+}
+
+void PlayfieldViewport::setViewport(const Vec2& origin, const Size& size) {
+    _origin = origin;
+    _size = size;
+    clamp();
+}
+
+void PlayfieldViewport::setMaxZoom(float maxZoom) {
+    _maxZoom = std::max(1.0f, maxZoom);
+    if (_zoom > _maxZoom) {
+        zoomAt(_maxZoom, _origin + Vec2(_size.width * 0.5f, _size.height * 0.5f));
+    }
+}
+
+void PlayfieldViewport::zoomAt(float zoom, const Vec2& focus) {
+    // 缩放前后缩放中心下的内容坐标不变
+    Vec2 focusInContent = toContentSpace(focus);
+    _zoom = limitZoom(zoom);
+    _pan = focus - _origin - focusInContent * _zoom;
+    clamp();
+}
+
+void PlayfieldViewport::panBy(const Vec2& delta) {
+    _pan += delta;
+    clamp();
+}
+
+bool PlayfieldViewport::isInteractive() const {
+    return _worldSize.width > _size.width || _worldSize.height > _size.height;
+}
+
+float PlayfieldViewport::getMinZoom() const {
+    if (_worldSize.width <= 0 || _worldSize.height <= 0) {
+        return 1.0f;
+    }
+    return std::min(1.0f, std::min(_size.width / _worldSize.width, _size.height / _worldSize.height));
+}
+
+float PlayfieldViewport::limitZoom(float zoom) const {
+    float minZoom = getMinZoom();
+    float maxZoom = isInteractive() ? _maxZoom : minZoom;
+    return std::min(std::max(zoom, minZoom), maxZoom);
+}
+
+void PlayfieldViewport::clamp() {
+    _zoom = limitZoom(_zoom);
+    _pan.x = clampPan(_pan.x, _worldSize.width * _zoom, _size.width);
+    _pan.y = clampPan(_pan.y, _worldSize.height * _zoom, _size.height);
+}
+
+float PlayfieldViewport::clampPan(float pan, float content, float view) const {
+    if (content <= view) {
+        return isInteractive() ? (view - content) * 0.5f : 0.0f;
+    }
+    return std::min(0.0f, std::max(view - content, pan));
+}
@@ -0,0 +1,112 @@
+#ifndef __PLAYFIELD_VIEWPORT_H__
+#define __PLAYFIELD_VIEWPORT_H__
+
+#include "PlatformShim.h"
+
+USING_NS_CC;
+
+/**
+ * 桌面视口的平移与缩放
+ * 保存视口、内容尺寸（关卡桌面尺寸）与当前缩放、平移，每次修改后限制在有效范围内：
+ * - 缩放不小于能看到全部内容的缩放（不超过1），不大于最大缩放；内容不超过视口时固定为1；
+ * - 内容超出视口的方向上不露出边缘，不超出的方向上居中（内容完全在视口内时贴齐视口原点）。
+ * PlayfieldCamera用它计算桌面区域锚点的位置与缩放；不依赖节点树，可在规则核心中测试
+ */
+class PlayfieldViewport {
+public:
+    PlayfieldViewport();
+
+    /**
+     * 设置视口与内容尺寸并重置：缩放到能看到全部内容，平移归零后限制
+     * @param origin 视口原点
+     * @param size 视口尺寸
+     * @param worldSize 内容尺寸
+     */
+    void reset(const Vec2& origin, const Size& size, const Size& worldSize);
+
+    /**
+     * 设置视口，保持当前缩放与平移（仍需满足限制）
+     * @param origin 视口原点
+     * @param size 视口尺寸
+     */
+    void setViewport(const Vec2& origin, const Size& size);
+
+    /**
+     * 设置最大缩放，当前缩放超过时以视口中心缩小
+     * @param maxZoom 最大缩放，小于1时按1处理
+     */
+    void setMaxZoom(float maxZoom);
+
+    /**
+     * 以指定点为中心缩放，该点下的内容保持不动（平移限制生效时除外）
+     * @param zoom 目标缩放（限制在最小与最大缩放之间）
+     * @param focus 缩放中心（与视口相同的坐标系）
+     */
+    void zoomAt(float zoom, const Vec2& focus);
+
+    /**
+     * 平移（限制在内容范围内）
+     * @param delta 平移量
+     */
+    void panBy(const Vec2& delta);
+
+    /**
+     * 内容是否超出视口（超出时才允许平移与缩放）
+     */
+    bool isInteractive() const;
+
+    /**
+     * 能看到全部内容的缩放（不超过1）
+     */
+    float getMinZoom() const;
+
+    /**
+     * 获取当前缩放
+     */
+    float getZoom() const { return _zoom; }
+
+    /**
+     * 获取最大缩放
+     */
+    float getMaxZoom() const { return _maxZoom; }
+
+    /**
+     * 内容原点的位置（即区域锚点位置）
+     */
+    Vec2 getContentOrigin() const { return _origin + _pan; }
+
+    /**
+     * 视口坐标转换为内容坐标
+     * @param point 视口坐标系中的点
+     * @return 内容坐标
+     */
+    Vec2 toContentSpace(const Vec2& point) const { return (point - getContentOrigin()) / _zoom; }
+
+private:
+    /**
+     * 把缩放限制在最小与最大缩放之间（内容不超过视口时为最小缩放）
+     */
+    float limitZoom(float zoom) const;
+
+    /**
+     * 把缩放与平移限制在有效范围内
+     */
+    void clamp();
+
+    /**
+     * 单个方向上的平移限制
+     * @param pan 平移
+     * @param content 缩放后的内容长度
+     * @param view 视口长度
+     */
+    float clampPan(float pan, float content, float view) const;
+
+    Vec2 _origin;           // 视口原点
+    Size _size;             // 视口尺寸
+    Size _worldSize;        // 内容尺寸
+    float _zoom;            // 当前缩放
+    float _maxZoom;         // 最大缩放
+    Vec2 _pan;              // 内容原点相对视口原点的偏移
+};
+
+#endif // __PLAYFIELD_VIEWPORT_H__
@@ -0,0 +1,130 @@
+#ifndef __SNAPSHOT_PUBLISHER_H__
+#define __SNAPSHOT_PUBLISHER_H__
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * 不可变快照的发布点（RCU方式）
+ * 写线程发布新快照，任意线程取得当前快照后可长期持有，内容不会再变化。
+ *
+ * 读者不加锁：当前快照挂在原子指针指向的节点上，读者先在一个空闲的危险指针槽位中登记该节点（一次CAS），
+ * 确认节点仍是当前节点后复制其中的shared_ptr（一次原子引用计数），再撤销登记。
+ * 不使用std::atomic_load/std::atomic_store读写shared_ptr：libstdc++与libc++用全局互斥锁池实现它们。
+ *
+ * 写者之间加锁串行；替换节点后等待仍登记着旧节点的读者复制完成再释放旧节点，
+ * 读者登记的时间只有一次引用计数复制，等待很短。
+ * 旧快照本身在最后一个持有者释放时自动销毁，反复发布（如配置热重载）不会累积内存
+ */
+template <typename T>
+class SnapshotPublisher {
+public:
+    SnapshotPublisher() : _current(nullptr) {
+        for (auto& slot : _hazardSlots) {
+            slot.node.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * 析构函数，调用时不能再有读者或写者
+     */
+    ~SnapshotPublisher() {
+        delete _current.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 取得当前快照（任意线程，无锁）
+     * @return 当前快照，尚未发布时返回nullptr
+     */
+    std::shared_ptr<const T> load() const {
+        size_t index = getSlotHint();
+        size_t attemptCount = 0;
+        while (true) {
+            Node* node = _current.load();
+            if (!node) {
+                return nullptr;
+            }
+
+            // 占用空闲槽位并登记节点，槽位被其它读者占用时换下一个
+            Node* expected = nullptr;
+            std::atomic<Node*>& slot = _hazardSlots[index].node;
+            if (!slot.compare_exchange_strong(expected, node)) {
+                index = (index + 1) % kHazardSlotCount;
+                // 所有槽位都被占用（读者多于槽位数）时让出CPU，让占用槽位的读者完成
+                if (++attemptCount % kHazardSlotCount == 0) {
+                    std::this_thread::yield();
+                }
+                continue;
+            }
+
+            // 登记后节点仍是当前节点：写者替换它之后必然看到登记，撤销登记前不会释放
+            if (_current.load() == node) {
+                std::shared_ptr<const T> snapshot = node->snapshot;
+                slot.store(nullptr, std::memory_order_release);
+                return snapshot;
+            }
+            slot.store(nullptr, std::memory_order_release);
+        }
+    }
+
+    /**
+     * 发布新快照（任意线程），替换后的旧快照由仍持有它的读者负责释放
+     * @param snapshot 新快照，发布后不应再修改
+     */
+    void publish(std::shared_ptr<const T> snapshot) {
+        std::lock_guard<std::mutex> lock(_publishMutex);
+        Node* oldNode = _current.exchange(new Node(std::move(snapshot)));
+        if (!oldNode) {
+            return;
+        }
+
+        // 等待正在复制旧节点的读者
+        for (const auto& slot : _hazardSlots) {
+            while (slot.node.load() == oldNode) {
+                std::this_thread::yield();
+            }
+        }
+        delete oldNode;
+    }
+
+private:
+    SnapshotPublisher(const SnapshotPublisher&) = delete;
+    SnapshotPublisher& operator=(const SnapshotPublisher&) = delete;
+
+    /**
+     * 持有一代快照的节点，发布后不再修改
+     */
+    struct Node {
+        explicit Node(std::shared_ptr<const T> value) : snapshot(std::move(value)) {}
+
+        const std::shared_ptr<const T> snapshot;
+    };
+
+    /**
+     * 危险指针槽位，按缓存行大小填充，避免不同读者的槽位互相干扰
+     */
+    struct HazardSlot {
+        std::atomic<Node*> node;
+        char padding[64 - sizeof(std::atomic<Node*>)];
+    };
+
+    static const size_t kHazardSlotCount = 32;     // 槽位数，超过该数量的并发读者轮流等待空闲槽位
+
+    /**
+     * 获取当前线程首选的槽位，各线程分散到不同槽位
+     */
+    static size_t getSlotHint() {
+        static std::atomic<size_t> s_nextHint(0);
+        static thread_local size_t s_hint = s_nextHint++ % kHazardSlotCount;
+        return s_hint;
+    }
+
+    std::atomic<Node*> _current;                    // 当前节点
+    mutable HazardSlot _hazardSlots[kHazardSlotCount];  // 读者正在复制的节点
+    std::mutex _publishMutex;                       // 写者之间串行
+};
+
+#endif // __SNAPSHOT_PUBLISHER_H__
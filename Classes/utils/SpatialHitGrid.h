@@ -0,0 +1,180 @@
+#ifndef __SPATIAL_HIT_GRID_H__
+#define __SPATIAL_HIT_GRID_H__
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * 命中检测用的均匀网格索引
+ * 把区域划分为固定尺寸的格子，每个对象按包围盒登记到它覆盖的所有格子中；
+ * 查询一个点时只返回该点所在格子的对象，格子尺寸取对象尺寸时每格平均只有少量对象，查询为O(1)。
+ * 超出区域的部分归入边缘格子。
+ *
+ * 只保存对象指针，不持有对象，也不比较层级：调用方在候选对象中做精确的包围盒与层级判断。
+ * 不依赖cocos2d，非线程安全
+ */
+template <typename T>
+class SpatialHitGrid {
+public:
+    /**
+     * 包围盒（区域坐标系）
+     */
+    struct Bounds {
+        float minX;
+        float minY;
+        float maxX;
+        float maxY;
+    };
+
+    SpatialHitGrid() : _cellWidth(1.0f), _cellHeight(1.0f), _columns(1), _rows(1), _cells(1) {}
+
+    /**
+     * 按区域与格子尺寸重新划分网格，清空所有对象
+     * @param width 区域宽度
+     * @param height 区域高度
+     * @param cellWidth 格子宽度，不大于0时按1处理
+     * @param cellHeight 格子高度，不大于0时按1处理
+     */
+    void reset(float width, float height, float cellWidth, float cellHeight) {
+        _cellWidth = cellWidth > 0.0f ? cellWidth : 1.0f;
+        _cellHeight = cellHeight > 0.0f ? cellHeight : 1.0f;
+        _columns = std::max(1, static_cast<int>(std::ceil(width / _cellWidth)));
+        _rows = std::max(1, static_cast<int>(std::ceil(height / _cellHeight)));
+        _cells.assign(_columns * _rows, std::vector<T*>());
+        _itemRanges.clear();
+    }
+
+    /**
+     * 登记对象或更新已登记对象的包围盒
+     * @param item 对象
+     * @param bounds 包围盒
+     * @return 对象覆盖的格子是否变化（新登记的对象返回true）
+     */
+    bool update(T* item, const Bounds& bounds) {
+        CellRange range = getCellRange(bounds);
+        auto it = _itemRanges.find(item);
+        if (it != _itemRanges.end()) {
+            // 仍在原来的格子中（多数移动帧如此），无需改动
+            if (it->second == range) {
+                return false;
+            }
+            eraseFromCells(item, it->second);
+            it->second = range;
+        } else {
+            _itemRanges[item] = range;
+        }
+        insertIntoCells(item, range);
+        return true;
+    }
+
+    /**
+     * 移除对象
+     * @param item 对象
+     * @return 对象是否已登记
+     */
+    bool remove(T* item) {
+        auto it = _itemRanges.find(item);
+        if (it == _itemRanges.end()) {
+            return false;
+        }
+        eraseFromCells(item, it->second);
+        _itemRanges.erase(it);
+        return true;
+    }
+
+    /**
+     * 对象是否已登记
+     */
+    bool contains(T* item) const { return _itemRanges.find(item) != _itemRanges.end(); }
+
+    /**
+     * 获取已登记的对象数量
+     */
+    size_t size() const { return _itemRanges.size(); }
+
+    /**
+     * 获取所有已登记的对象（顺序不定）
+     */
+    std::vector<T*> getItems() const {
+        std::vector<T*> items;
+        items.reserve(_itemRanges.size());
+        for (const auto& entry : _itemRanges) {
+            items.push_back(entry.first);
+        }
+        return items;
+    }
+
+    /**
+     * 获取点所在格子中的对象，即可能命中该点的全部对象
+     * 同一格子中按登记到该格子的先后排列；对象不一定包含该点，需由调用方精确判断
+     * @param x 区域坐标
+     * @param y 区域坐标
+     * @return 候选对象
+     */
+    const std::vector<T*>& getCandidates(float x, float y) const {
+        return _cells[getRow(y) * _columns + getColumn(x)];
+    }
+
+private:
+    /**
+     * 对象覆盖的格子范围（含两端）
+     */
+    struct CellRange {
+        int minColumn;
+        int minRow;
+        int maxColumn;
+        int maxRow;
+
+        bool operator==(const CellRange& other) const {
+            return minColumn == other.minColumn && minRow == other.minRow &&
+                   maxColumn == other.maxColumn && maxRow == other.maxRow;
+        }
+    };
+
+    CellRange getCellRange(const Bounds& bounds) const {
+        CellRange range;
+        range.minColumn = getColumn(bounds.minX);
+        range.minRow = getRow(bounds.minY);
+        range.maxColumn = getColumn(bounds.maxX);
+        range.maxRow = getRow(bounds.maxY);
+        return range;
+    }
+
+    int getColumn(float x) const {
+        int column = static_cast<int>(std::floor(x / _cellWidth));
+        return std::min(std::max(column, 0), _columns - 1);
+    }
+
+    int getRow(float y) const {
+        int row = static_cast<int>(std::floor(y / _cellHeight));
+        return std::min(std::max(row, 0), _rows - 1);
+    }
+
+    void insertIntoCells(T* item, const CellRange& range) {
+        for (int row = range.minRow; row <= range.maxRow; row++) {
+            for (int column = range.minColumn; column <= range.maxColumn; column++) {
+                _cells[row * _columns + column].push_back(item);
+            }
+        }
+    }
+
+    void eraseFromCells(T* item, const CellRange& range) {
+        for (int row = range.minRow; row <= range.maxRow; row++) {
+            for (int column = range.minColumn; column <= range.maxColumn; column++) {
+                auto& cell = _cells[row * _columns + column];
+                cell.erase(std::remove(cell.begin(), cell.end(), item), cell.end());
+            }
+        }
+    }
+
+    float _cellWidth;                                   // 格子宽度
+    float _cellHeight;                                  // 格子高度
+    int _columns;                                       // 列数
+    int _rows;                                          // 行数
+    std::vector<std::vector<T*>> _cells;                // 每个格子中的对象，下标为 row * 列数 + column
+    std::unordered_map<T*, CellRange> _itemRanges;      // 对象当前所在的格子范围
+};
+
+#endif // __SPATIAL_HIT_GRID_H__
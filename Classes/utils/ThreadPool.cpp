@@ -0,0 +1,87 @@
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(int threadCount)
+    : _activeTaskCount(0)
+    , _isStopping(false) {
+    if (threadCount <= 0) {
+        threadCount = getDefaultThreadCount();
+    }
+
+    _workers.reserve(threadCount);
+    for (int i = 0; i < threadCount; i++) {
+        _workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isStopping = true;
+        std::queue<Task> empty;
+        _tasks.swap(empty);
+    }
+    _taskCondition.notify_all();
+
+    for (auto& worker : _workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void ThreadPool::enqueue(const Task& task) {
+    if (!task) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_isStopping) {
+            return;
+        }
+        _tasks.push(task);
+    }
+    _taskCondition.notify_one();
+}
+
+void ThreadPool::waitForAll() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idleCondition.wait(lock, [this]() {
+        return _tasks.empty() && _activeTaskCount == 0;
+    });
+}
+
+int ThreadPool::getDefaultThreadCount() {
+    unsigned int count = std::thread::hardware_concurrency();
+    return count > 0 ? static_cast<int>(count) : 1;
+}
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _taskCondition.wait(lock, [this]() {
+                return _isStopping || !_tasks.empty();
+            });
+
+            if (_isStopping) {
+                return;
+            }
+
+            task = _tasks.front();
+            _tasks.pop();
+            _activeTaskCount++;
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _activeTaskCount--;
+            if (_tasks.empty() && _activeTaskCount == 0) {
+                _idleCondition.notify_all();
+            }
+        }
+    }
+}
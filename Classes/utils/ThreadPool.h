@@ -0,0 +1,73 @@
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+/**
+ * 固定大小的线程池
+ * 用于批量解析等可并行的后台任务
+ * 任务在任意工作线程执行，需自行保证线程安全；不访问引擎（节点、纹理等）对象
+ */
+class ThreadPool {
+public:
+    typedef std::function<void()> Task;
+
+    /**
+     * 构造函数
+     * @param threadCount 工作线程数量，小于等于0时使用硬件并发数
+     */
+    explicit ThreadPool(int threadCount = 0);
+
+    /**
+     * 析构函数
+     * 丢弃尚未开始的任务，等待正在执行的任务结束
+     */
+    ~ThreadPool();
+
+    /**
+     * 提交任务
+     * @param task 任务
+     */
+    void enqueue(const Task& task);
+
+    /**
+     * 阻塞等待所有已提交的任务执行完毕
+     */
+    void waitForAll();
+
+    /**
+     * 获取工作线程数量
+     * @return 线程数量
+     */
+    int getThreadCount() const { return static_cast<int>(_workers.size()); }
+
+    /**
+     * 获取默认线程数量（硬件并发数，至少为1）
+     * @return 线程数量
+     */
+    static int getDefaultThreadCount();
+
+private:
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * 工作线程主循环
+     */
+    void workerLoop();
+
+    std::vector<std::thread> _workers;          // 工作线程
+    std::queue<Task> _tasks;                    // 待执行任务
+    std::mutex _mutex;                          // 保护任务队列与计数
+    std::condition_variable _taskCondition;     // 有新任务或停止
+    std::condition_variable _idleCondition;     // 所有任务执行完毕
+    int _activeTaskCount;                       // 正在执行的任务数
+    bool _isStopping;                           // 是否正在停止
+};
+
+#endif // __THREAD_POOL_H__
@@ -0,0 +1,179 @@
+#include "CardArea.h"
+#include "CardView.h"
+#include "CardFaceCache.h"
+
+CardArea* CardArea::create(const Size& size) {
+    CardArea* cardArea = new (std::nothrow) CardArea();
+    if (cardArea && cardArea->initWithSize(size)) {
+        cardArea->autorelease();
+        return cardArea;
+    }
+    CC_SAFE_DELETE(cardArea);
+    return nullptr;
+}
+
+CardArea::CardArea()
+    : _touchListener(nullptr)
+    , _touchedCard(nullptr) {
+}
+
+CardArea::~CardArea() {
+    if (_touchListener) {
+        _eventDispatcher->removeEventListener(_touchListener);
+        _touchListener = nullptr;
+    }
+
+    // 卡牌由CardLayer与对象池持有，会比区域活得久，需解除其对本区域的引用
+    for (auto cardView : _grid.getItems()) {
+        cardView->setCardArea(nullptr);
+    }
+    CC_SAFE_RELEASE_NULL(_touchedCard);
+}
+
+bool CardArea::initWithSize(const Size& size) {
+    if (!Node::init()) {
+        return false;
+    }
+
+    setContentSize(size);
+
+    // 整个区域一个监听器，按场景图优先级参与分发
+    _touchListener = EventListenerTouchOneByOne::create();
+    _touchListener->setSwallowTouches(true);
+    _touchListener->onTouchBegan = CC_CALLBACK_2(CardArea::onTouchBegan, this);
+    _touchListener->onTouchEnded = CC_CALLBACK_2(CardArea::onTouchEnded, this);
+    _touchListener->onTouchCancelled = CC_CALLBACK_2(CardArea::onTouchCancelled, this);
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(_touchListener, this);
+
+    return true;
+}
+
+void CardArea::setContentSize(const Size& contentSize) {
+    Node::setContentSize(contentSize);
+    rebuildGrid();
+}
+
+void CardArea::rebuildGrid() {
+    Size cellSize = CardFaceCache::getInstance()->getCardSize();
+    std::vector<CardView*> cardViews = _grid.getItems();
+    _grid.reset(getContentSize().width, getContentSize().height, cellSize.width, cellSize.height);
+
+    // 按新网格重新索引已有的卡牌
+    for (auto cardView : cardViews) {
+        updateGrid(cardView);
+    }
+}
+
+void CardArea::addCard(CardView* cardView) {
+    if (!cardView) {
+        return;
+    }
+
+    CardArea* oldArea = cardView->getCardArea();
+    if (oldArea != this) {
+        if (oldArea) {
+            oldArea->removeCard(cardView);
+        }
+        cardView->setCardArea(this);
+    }
+    updateGrid(cardView);
+}
+
+void CardArea::updateCard(CardView* cardView) {
+    if (_grid.contains(cardView)) {
+        updateGrid(cardView);
+    }
+}
+
+void CardArea::removeCard(CardView* cardView) {
+    if (_grid.remove(cardView)) {
+        cardView->setCardArea(nullptr);
+    }
+}
+
+CardView* CardArea::hitTest(const Vec2& locationInArea) const {
+    // 只检查触摸点所在格子；同层级时后加入的在上，与场景图的绘制顺序一致
+    CardView* topCard = nullptr;
+    for (auto cardView : _grid.getCandidates(locationInArea.x, locationInArea.y)) {
+        if (!cardView->isTouchable() || !getCardBounds(cardView).containsPoint(locationInArea)) {
+            continue;
+        }
+        if (!topCard ||
+            cardView->getLocalZOrder() > topCard->getLocalZOrder() ||
+            (cardView->getLocalZOrder() == topCard->getLocalZOrder() &&
+             cardView->getOrderOfArrival() > topCard->getOrderOfArrival())) {
+            topCard = cardView;
+        }
+    }
+    return topCard;
+}
+
+bool CardArea::onTouchBegan(Touch* touch, Event* event) {
+    // 场景图优先级的监听器不考虑可见性，隐藏的区域（如回收后的GameView）不响应
+    if (_touchedCard || !isVisibleInHierarchy()) {
+        return false;
+    }
+
+    CardView* cardView = hitTest(convertToNodeSpace(touch->getLocation()));
+    if (!cardView || !cardView->onTouchBegan(touch, event)) {
+        return false;
+    }
+
+    // 点击回调可能把卡牌移出本区域，触摸结束前保持引用
+    _touchedCard = cardView;
+    _touchedCard->retain();
+    return true;
+}
+
+void CardArea::onTouchEnded(Touch* touch, Event* event) {
+    CardView* cardView = _touchedCard;
+    _touchedCard = nullptr;
+    if (cardView) {
+        cardView->onTouchEnded(touch, event);
+        cardView->release();
+    }
+}
+
+void CardArea::onTouchCancelled(Touch* touch, Event* event) {
+    CardView* cardView = _touchedCard;
+    _touchedCard = nullptr;
+    if (cardView) {
+        cardView->onTouchCancelled(touch, event);
+        cardView->release();
+    }
+}
+
+void CardArea::cancelTouch() {
+    CardView* cardView = _touchedCard;
+    _touchedCard = nullptr;
+    if (cardView) {
+        cardView->onTouchCancelled(nullptr, nullptr);
+        cardView->release();
+    }
+}
+
+Rect CardArea::getCardBounds(const CardView* cardView) const {
+    const Size& size = cardView->getContentSize();
+    const Vec2& anchor = cardView->getAnchorPoint();
+    Vec2 position = cardView->getPosition();
+    if (cardView->getParent()) {
+        position = convertToNodeSpace(cardView->getParent()->convertToWorldSpace(position));
+    }
+    return Rect(position.x - size.width * anchor.x, position.y - size.height * anchor.y,
+                size.width, size.height);
+}
+
+void CardArea::updateGrid(CardView* cardView) {
+    Rect bounds = getCardBounds(cardView);
+    SpatialHitGrid<CardView>::Bounds gridBounds = {bounds.getMinX(), bounds.getMinY(), bounds.getMaxX(), bounds.getMaxY()};
+    _grid.update(cardView, gridBounds);
+}
+
+bool CardArea::isVisibleInHierarchy() const {
+    for (const Node* node = this; node; node = node->getParent()) {
+        if (!node->isVisible()) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,127 @@
+#ifndef __CARD_AREA_H__
+#define __CARD_AREA_H__
+
+#include "cocos2d.h"
+#include "../utils/SpatialHitGrid.h"
+
+USING_NS_CC;
+
+class CardView;
+
+/**
+ * 卡牌区域节点（桌面牌区、手牌堆区）
+ * 整个区域只注册一个触摸监听器，不再每张卡牌各注册一个。
+ * 卡牌不是本区域的子节点（统一挂在CardLayer下），由CardLayer按所在区域加入或移出本区域的索引；
+ * 区域内卡牌的包围盒按卡牌尺寸划分的均匀网格（SpatialHitGrid）建立索引，卡牌移动时由CardView通知更新；
+ * 触摸时只检查触摸点所在格子中的卡牌，取层级最高且可交互的一张，平均为O(1)。
+ * 仅在主线程使用
+ */
+class CardArea : public Node {
+public:
+    /**
+     * 创建卡牌区域
+     * @param size 区域尺寸
+     * @return 卡牌区域实例
+     */
+    static CardArea* create(const Size& size);
+
+    /**
+     * 初始化卡牌区域
+     * @param size 区域尺寸
+     * @return 是否初始化成功
+     */
+    bool initWithSize(const Size& size);
+
+    /**
+     * 析构函数
+     */
+    virtual ~CardArea();
+
+    /**
+     * 设置区域尺寸，按新尺寸重建网格
+     */
+    virtual void setContentSize(const Size& contentSize) override;
+
+    /**
+     * 把卡牌加入本区域的索引（已在其它区域时先从其它区域移出）
+     * @param cardView 卡牌视图
+     */
+    void addCard(CardView* cardView);
+
+    /**
+     * 更新卡牌在网格中的位置（卡牌移动后由CardView调用），不在本区域的卡牌忽略
+     * @param cardView 卡牌视图
+     */
+    void updateCard(CardView* cardView);
+
+    /**
+     * 从本区域的索引中移除卡牌
+     * @param cardView 卡牌视图
+     */
+    void removeCard(CardView* cardView);
+
+    /**
+     * 查找触摸点处最上层的可交互卡牌
+     * @param locationInArea 区域坐标系中的点
+     * @return 卡牌视图，没有时返回nullptr
+     */
+    CardView* hitTest(const Vec2& locationInArea) const;
+
+    /**
+     * 取消当前按下的卡牌（如手势转为平移镜头），该次触摸结束时不再触发点击
+     */
+    void cancelTouch();
+
+    /**
+     * 获取已索引的卡牌数量
+     */
+    size_t getIndexedCardCount() const { return _grid.size(); }
+
+protected:
+    CardArea();
+
+    /**
+     * 触摸开始：命中检测后交给对应卡牌
+     */
+    bool onTouchBegan(Touch* touch, Event* event);
+
+    /**
+     * 触摸结束
+     */
+    void onTouchEnded(Touch* touch, Event* event);
+
+    /**
+     * 触摸取消
+     */
+    void onTouchCancelled(Touch* touch, Event* event);
+
+private:
+    /**
+     * 按区域尺寸与卡牌尺寸重建网格，并重新索引区域内的卡牌
+     */
+    void rebuildGrid();
+
+    /**
+     * 计算卡牌在区域坐标系中的包围盒（不含缩放，按压与高亮缩放不改变命中范围）
+     * 卡牌位于CardLayer坐标系，经世界坐标转换到本区域；卡牌的区域缩放与本区域节点的缩放相同，
+     * 在区域坐标系中相互抵消，镜头缩放后仍按卡牌原始尺寸计算
+     */
+    Rect getCardBounds(const CardView* cardView) const;
+
+    /**
+     * 按卡牌当前包围盒更新网格索引
+     */
+    void updateGrid(CardView* cardView);
+
+    /**
+     * 区域及其所有父节点是否可见
+     */
+    bool isVisibleInHierarchy() const;
+
+    SpatialHitGrid<CardView> _grid;                             // 区域内卡牌的网格索引，格子尺寸为卡牌尺寸
+
+    EventListenerTouchOneByOne* _touchListener;                 // 区域触摸监听器
+    CardView* _touchedCard;                                     // 当前按下的卡牌（持有）
+};
+
+#endif // __CARD_AREA_H__
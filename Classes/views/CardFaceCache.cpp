@@ -0,0 +1,305 @@
+#include "CardFaceCache.h"
+#include "../utils/CardAtlas.h"
+#include <chrono>
+#include <cmath>
+
+const int CardFaceCache::kCellPadding = 2;
+const int CardFaceCache::kMaxTextureSize = 2048;
+
+// 卡牌底图，决定卡牌尺寸
+static const char* const kCardBaseImagePath = "res/card_general.png";
+
+// 底图加载失败时的默认卡牌尺寸
+static const Size kDefaultCardSize(100, 140);
+
+CardFaceCache* CardFaceCache::s_instance = nullptr;
+
+CardFaceCache* CardFaceCache::getInstance() {
+    if (!s_instance) {
+        s_instance = new (std::nothrow) CardFaceCache();
+    }
+    return s_instance;
+}
+
+void CardFaceCache::destroyInstance() {
+    CC_SAFE_DELETE(s_instance);
+}
+
+CardFaceCache::CardFaceCache()
+    : _renderTexture(nullptr)
+    , _backFrame(nullptr)
+    , _cardSize(kDefaultCardSize)
+    , _configListenerId(0)
+    , _lastRenderDurationMs(0.0)
+    , _isBuilt(false)
+    , _hasTriedBuild(false) {
+    for (int i = 0; i < kFaceFrameCount; i++) {
+        _faceFrames[i] = nullptr;
+    }
+}
+
+CardFaceCache::~CardFaceCache() {
+    if (_isBuilt) {
+        ConfigManager::getInstance()->removeConfigChangeListener(_configListenerId);
+    }
+    for (int i = 0; i < kFaceFrameCount; i++) {
+        CC_SAFE_RELEASE_NULL(_faceFrames[i]);
+    }
+    CC_SAFE_RELEASE_NULL(_backFrame);
+    CC_SAFE_RELEASE_NULL(_renderTexture);
+}
+
+bool CardFaceCache::build() {
+    if (_hasTriedBuild) {
+        return _isBuilt;
+    }
+    _hasTriedBuild = true;
+
+    SpriteFrame* baseFrame = CardAtlas::getSpriteFrame(kCardBaseImagePath);
+    _cardSize = baseFrame ? baseFrame->getOriginalSize() : kDefaultCardSize;
+
+    // 52张牌面 + 1张牌背，按网格排布
+    const int frameCount = kFaceFrameCount + 1;
+    const float cellWidth = std::ceil(_cardSize.width) + kCellPadding;
+    const float cellHeight = std::ceil(_cardSize.height) + kCellPadding;
+    const int columns = std::min(frameCount, static_cast<int>(kMaxTextureSize / cellWidth));
+    if (columns <= 0) {
+        CCLOG("CardFaceCache::build - Card size %.0fx%.0f too large", _cardSize.width, _cardSize.height);
+        return false;
+    }
+    const int rows = (frameCount + columns - 1) / columns;
+    if (rows * cellHeight > kMaxTextureSize) {
+        CCLOG("CardFaceCache::build - %d frames do not fit into %d", frameCount, kMaxTextureSize);
+        return false;
+    }
+
+    _renderTexture = RenderTexture::create(static_cast<int>(columns * cellWidth),
+                                           static_cast<int>(rows * cellHeight),
+                                           Texture2D::PixelFormat::RGBA8888);
+    if (!_renderTexture) {
+        CCLOG("CardFaceCache::build - Failed to create render texture");
+        return false;
+    }
+    _renderTexture->retain();
+
+    Texture2D* texture = _renderTexture->getSprite()->getTexture();
+    for (int i = 0; i < frameCount; i++) {
+        Rect rect((i % columns) * cellWidth, (i / columns) * cellHeight, _cardSize.width, _cardSize.height);
+        SpriteFrame* frame = SpriteFrame::createWithTexture(texture, rect);
+        frame->retain();
+        if (i == kFaceFrameCount) {
+            _backFrame = frame;
+        } else {
+            _faceFrames[i] = frame;
+        }
+    }
+
+    renderFrames();
+
+    _isBuilt = true;
+
+    // 字体或卡牌布局热重载后原地重绘，所有卡牌精灵引用同一纹理，无需逐张更新
+    _configListenerId = ConfigManager::getInstance()->addConfigChangeListener([this](const ConfigChange& change) {
+        onConfigChanged(change);
+    });
+
+    CCLOG("CardFaceCache::build - Composed %d card frames into %dx%d texture (%zu KB) in %.2f ms",
+          frameCount, static_cast<int>(columns * cellWidth), static_cast<int>(rows * cellHeight),
+          getTextureMemoryBytes() / 1024, _lastRenderDurationMs);
+    return true;
+}
+
+size_t CardFaceCache::getTextureMemoryBytes() const {
+    if (!_renderTexture) {
+        return 0;
+    }
+    Texture2D* texture = _renderTexture->getSprite()->getTexture();
+    return static_cast<size_t>(texture->getPixelsWide()) * texture->getPixelsHigh() * 4;
+}
+
+void CardFaceCache::renderFrames() {
+    auto startTime = std::chrono::steady_clock::now();
+    _renderTexture->beginWithClear(0, 0, 0, 0);
+    for (int i = 0; i <= kFaceFrameCount; i++) {
+        bool isBack = (i == kFaceFrameCount);
+        SpriteFrame* frame = isBack ? _backFrame : _faceFrames[i];
+        Node* node = isBack ? createBackNode()
+                            : createFaceNode(static_cast<CardFaceType>(i / CST_NUM_CARD_SUIT_TYPES),
+                                             static_cast<CardSuitType>(i % CST_NUM_CARD_SUIT_TYPES));
+
+        // 帧矩形以纹理数据首行为上，渲染纹理首行对应帧缓冲底部，故上下翻转绘制
+        const Rect& rect = frame->getRect();
+        node->setPosition(rect.getMidX(), rect.getMidY());
+        node->setScaleY(-1.0f);
+        node->visit();
+    }
+    _renderTexture->end();
+
+    // 立即执行渲染命令，合成用的临时节点随后即可释放
+    Director::getInstance()->getRenderer()->render();
+
+    _lastRenderDurationMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - startTime).count();
+}
+
+void CardFaceCache::onConfigChanged(const ConfigChange& change) {
+    if (change.type != ConfigType::FONT && change.type != ConfigType::CARD_LAYOUT) {
+        return;
+    }
+
+    // 牌背文字取自CardFonts，牌面与牌背元素位置取自CardLayout
+    if (change.hasChanged("CardFonts") || change.hasChanged("CardLayout")) {
+        renderFrames();
+        CCLOG("CardFaceCache::onConfigChanged - Card frames redrawn in %.2f ms", _lastRenderDurationMs);
+    }
+}
+
+SpriteFrame* CardFaceCache::getFaceFrame(CardFaceType face, CardSuitType suit) {
+    if (face < 0 || face >= CFT_NUM_CARD_FACE_TYPES || suit < 0 || suit >= CST_NUM_CARD_SUIT_TYPES) {
+        CCLOG("CardFaceCache::getFaceFrame - Invalid card %d/%d", face, suit);
+        return getFallbackFrame();
+    }
+
+    if (!build()) {
+        return getFallbackFrame();
+    }
+    return _faceFrames[face * CST_NUM_CARD_SUIT_TYPES + suit];
+}
+
+SpriteFrame* CardFaceCache::getBackFrame() {
+    if (!build()) {
+        return getFallbackFrame();
+    }
+    return _backFrame;
+}
+
+Node* CardFaceCache::createFaceNode(CardFaceType face, CardSuitType suit) const {
+    Node* node = createBaseNode();
+    auto cardLayoutConfig = ConfigManager::getInstance()->getCardLayoutConfig();
+
+    // 大数字（中间）
+    auto bigNumberSprite = CardAtlas::createSprite(getNumberImagePath("big", face, suit));
+    if (bigNumberSprite) {
+        bigNumberSprite->setAnchorPoint(Vec2(0.5f, 0.5f));
+        bigNumberSprite->setPosition(cardLayoutConfig->getBigNumberAbsolutePosition(_cardSize));
+        node->addChild(bigNumberSprite);
+    }
+
+    // 小数字（左上角）
+    auto smallNumberSprite = CardAtlas::createSprite(getNumberImagePath("small", face, suit));
+    if (smallNumberSprite) {
+        smallNumberSprite->setAnchorPoint(Vec2(0.0f, 1.0f));
+        smallNumberSprite->setPosition(cardLayoutConfig->getSmallNumberAbsolutePosition(_cardSize));
+        node->addChild(smallNumberSprite);
+    }
+
+    // 花色（右上角）
+    auto suitSprite = CardAtlas::createSprite(getSuitImagePath(suit));
+    if (suitSprite) {
+        suitSprite->setAnchorPoint(Vec2(1.0f, 1.0f));
+        suitSprite->setPosition(cardLayoutConfig->getSuitAbsolutePosition(_cardSize));
+        node->addChild(suitSprite);
+    }
+
+    return node;
+}
+
+Node* CardFaceCache::createBackNode() const {
+    Node* node = createBaseNode();
+    auto configManager = ConfigManager::getInstance();
+
+    // 牌背文字，使用配置中的字体；字体为.ttf文件时用TTF渲染，否则用系统字体
+    // 只在合成时栅格化一次，所有卡牌共用合成结果
+    auto cardBackFont = configManager->getFontConfig()->getCardBackFont();
+    std::string text = cardBackFont.text.empty() ? "CARD" : cardBackFont.text;
+    const std::string& family = cardBackFont.family;
+    bool isTTF = family.size() > 4 && family.compare(family.size() - 4, 4, ".ttf") == 0;
+    Label* backLabel = isTTF ? Label::createWithTTF(text, family, cardBackFont.size)
+                             : Label::createWithSystemFont(text, family, cardBackFont.size);
+    if (!backLabel) {
+        CCLOG("CardFaceCache::createBackNode - Failed to create label with %s", family.c_str());
+        return node;
+    }
+    backLabel->setAnchorPoint(Vec2(0.5f, 0.5f));
+    backLabel->setColor(Color3B::BLUE);
+    backLabel->setPosition(configManager->getCardLayoutConfig()->getCardBackTextAbsolutePosition(_cardSize));
+    node->addChild(backLabel);
+
+    return node;
+}
+
+Node* CardFaceCache::createBaseNode() const {
+    Node* node = Node::create();
+    node->setContentSize(_cardSize);
+    node->setAnchorPoint(Vec2(0.5f, 0.5f));
+
+    auto background = CardAtlas::createSprite(kCardBaseImagePath);
+    if (background) {
+        background->setPosition(_cardSize.width * 0.5f, _cardSize.height * 0.5f);
+        node->addChild(background);
+    } else {
+        // 底图加载失败时绘制简单的矩形
+        auto drawNode = DrawNode::create();
+        drawNode->drawSolidRect(Vec2::ZERO, Vec2(_cardSize.width, _cardSize.height), Color4F::WHITE);
+        drawNode->drawRect(Vec2::ZERO, Vec2(_cardSize.width, _cardSize.height), Color4F::BLACK);
+        node->addChild(drawNode);
+    }
+
+    return node;
+}
+
+SpriteFrame* CardFaceCache::getFallbackFrame() const {
+    return CardAtlas::getSpriteFrame(kCardBaseImagePath);
+}
+
+std::string CardFaceCache::getFaceText(CardFaceType face) {
+    switch (face) {
+        case CFT_ACE:   return "A";
+        case CFT_TWO:   return "2";
+        case CFT_THREE: return "3";
+        case CFT_FOUR:  return "4";
+        case CFT_FIVE:  return "5";
+        case CFT_SIX:   return "6";
+        case CFT_SEVEN: return "7";
+        case CFT_EIGHT: return "8";
+        case CFT_NINE:  return "9";
+        case CFT_TEN:   return "10";
+        case CFT_JACK:  return "J";
+        case CFT_QUEEN: return "Q";
+        case CFT_KING:  return "K";
+        default:        return "A";
+    }
+}
+
+std::string CardFaceCache::getSuitImagePath(CardSuitType suit) {
+    switch (suit) {
+        case CST_CLUBS:    return "res/suits/club.png";
+        case CST_DIAMONDS: return "res/suits/diamond.png";
+        case CST_HEARTS:   return "res/suits/heart.png";
+        case CST_SPADES:   return "res/suits/spade.png";
+        default:           return "res/suits/club.png";
+    }
+}
+
+std::string CardFaceCache::getNumberImagePath(const std::string& size, CardFaceType face, CardSuitType suit) {
+    bool isRed = (suit == CST_HEARTS || suit == CST_DIAMONDS);
+    return "res/number/" + size + "_" + (isRed ? "red" : "black") + "_" + getFaceText(face) + ".png";
+}
+
+void CardFaceCache::getSourceImagePaths(std::vector<std::string>& imagePaths) {
+    imagePaths.clear();
+    imagePaths.push_back(kCardBaseImagePath);
+
+    // 数字图片只分红黑，取一红一黑两个花色即可覆盖
+    const CardSuitType colorSuits[] = { CST_CLUBS, CST_HEARTS };
+    for (int face = 0; face < CFT_NUM_CARD_FACE_TYPES; face++) {
+        for (auto suit : colorSuits) {
+            imagePaths.push_back(getNumberImagePath("big", static_cast<CardFaceType>(face), suit));
+            imagePaths.push_back(getNumberImagePath("small", static_cast<CardFaceType>(face), suit));
+        }
+    }
+
+    for (int suit = 0; suit < CST_NUM_CARD_SUIT_TYPES; suit++) {
+        imagePaths.push_back(getSuitImagePath(static_cast<CardSuitType>(suit)));
+    }
+}
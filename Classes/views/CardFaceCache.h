@@ -0,0 +1,151 @@
+#ifndef __CARD_FACE_CACHE_H__
+#define __CARD_FACE_CACHE_H__
+
+#include "cocos2d.h"
+#include "../models/CardModel.h"
+#include "../managers/ConfigManager.h"
+#include <string>
+#include <vector>
+
+USING_NS_CC;
+
+/**
+ * 卡牌牌面缓存
+ * 启动时把52张牌面（底图+大数字+小数字+花色）和牌背按CardLayoutConfig/FontConfig
+ * 一次性合成到同一张渲染纹理中，每张牌面对应一个精灵帧。
+ * CardView只需一个精灵，翻牌时切换帧；所有卡牌共用一张纹理，可自动合批。
+ * 牌背文字只栅格化一次；字体或卡牌布局配置变化时原地重绘，已有卡牌随之更新。
+ * 仅在主线程使用
+ */
+class CardFaceCache {
+public:
+    /**
+     * 获取单例实例
+     * @return 牌面缓存实例
+     */
+    static CardFaceCache* getInstance();
+
+    /**
+     * 销毁单例实例
+     */
+    static void destroyInstance();
+
+    /**
+     * 合成所有牌面（只合成一次）
+     * 需在OpenGL上下文创建之后调用
+     * @return 是否合成成功
+     */
+    bool build();
+
+    /**
+     * 获取牌面精灵帧
+     * @param face 牌面
+     * @param suit 花色
+     * @return 精灵帧，合成失败时返回卡牌底图
+     */
+    SpriteFrame* getFaceFrame(CardFaceType face, CardSuitType suit);
+
+    /**
+     * 获取牌背精灵帧
+     * @return 精灵帧，合成失败时返回卡牌底图
+     */
+    SpriteFrame* getBackFrame();
+
+    /**
+     * 获取卡牌尺寸（底图尺寸）
+     */
+    const Size& getCardSize() const { return _cardSize; }
+
+    /**
+     * 获取合成纹理占用的显存（RGBA8888），未合成时为0
+     * @return 字节数
+     */
+    size_t getTextureMemoryBytes() const;
+
+    /**
+     * 获取最近一次绘制全部牌面与牌背的耗时（合成或配置变化后重绘）
+     * @return 耗时（毫秒）
+     */
+    double getLastRenderDurationMs() const { return _lastRenderDurationMs; }
+
+    /**
+     * 获取牌面文字
+     * @param face 牌面类型
+     * @return 牌面文字，如"A"、"10"
+     */
+    static std::string getFaceText(CardFaceType face);
+
+    /**
+     * 获取花色图片路径
+     * @param suit 花色类型
+     * @return 图片路径
+     */
+    static std::string getSuitImagePath(CardSuitType suit);
+
+    /**
+     * 获取数字图片路径
+     * @param size 尺寸前缀，"big"或"small"
+     * @param face 牌面类型
+     * @param suit 花色类型（决定红黑）
+     * @return 图片路径
+     */
+    static std::string getNumberImagePath(const std::string& size, CardFaceType face, CardSuitType suit);
+
+    /**
+     * 获取合成牌面用到的所有卡牌图片（底图、大小数字与花色），用于启动时预加载
+     * @param imagePaths 输出图片路径列表（先清空）
+     */
+    static void getSourceImagePaths(std::vector<std::string>& imagePaths);
+
+private:
+    CardFaceCache();
+    ~CardFaceCache();
+
+    /**
+     * 把所有牌面与牌背绘制到合成纹理（帧矩形已确定）
+     */
+    void renderFrames();
+
+    /**
+     * 配置变化时重绘
+     * @param change 配置变化信息
+     */
+    void onConfigChanged(const ConfigChange& change);
+
+    /**
+     * 创建单张牌面的合成节点（锚点为中心，尺寸为卡牌尺寸）
+     */
+    Node* createFaceNode(CardFaceType face, CardSuitType suit) const;
+
+    /**
+     * 创建牌背的合成节点
+     */
+    Node* createBackNode() const;
+
+    /**
+     * 创建卡牌底图节点
+     */
+    Node* createBaseNode() const;
+
+    /**
+     * 合成失败时使用的卡牌底图帧
+     */
+    SpriteFrame* getFallbackFrame() const;
+
+    static const int kFaceFrameCount = CFT_NUM_CARD_FACE_TYPES * CST_NUM_CARD_SUIT_TYPES;
+    static const int kCellPadding;              // 帧之间的间距（点）
+    static const int kMaxTextureSize;           // 渲染纹理最大边长（点）
+
+    static CardFaceCache* s_instance;           // 单例实例
+
+    RenderTexture* _renderTexture;              // 合成纹理（持有）
+    SpriteFrame* _faceFrames[kFaceFrameCount];  // 牌面帧（持有），下标为 face * 花色数 + suit
+    SpriteFrame* _backFrame;                    // 牌背帧（持有）
+    Size _cardSize;                             // 卡牌尺寸
+    int _configListenerId;                      // 配置变化订阅ID
+    double _lastRenderDurationMs;               // 最近一次绘制耗时（毫秒）
+    bool _isBuilt;                              // 是否已合成
+    bool _hasTriedBuild;                        // 是否已尝试合成（失败后不再重试）
+};
+
+#endif // __CARD_FACE_CACHE_H__
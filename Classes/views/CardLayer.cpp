@@ -0,0 +1,188 @@
+#include "CardLayer.h"
+#include "CardView.h"
+#include "CardArea.h"
+#include <algorithm>
+
+const int CardLayer::kBandZRange = 10000;
+
+CardLayer* CardLayer::create() {
+    CardLayer* cardLayer = new (std::nothrow) CardLayer();
+    if (cardLayer && cardLayer->init()) {
+        cardLayer->autorelease();
+        return cardLayer;
+    }
+    CC_SAFE_DELETE(cardLayer);
+    return nullptr;
+}
+
+CardLayer::CardLayer() {
+    clearBandAnchors();
+}
+
+void CardLayer::setBandAnchor(CardBand band, Node* anchor, CardArea* cardArea) {
+    int index = static_cast<int>(band);
+    _bandAnchors[index] = anchor;
+    _bandCardAreas[index] = cardArea;
+}
+
+void CardLayer::clearBandAnchors() {
+    for (int i = 0; i < static_cast<int>(CardBand::COUNT); i++) {
+        _bandAnchors[i] = nullptr;
+        _bandCardAreas[i] = nullptr;
+        _bandCulling[i] = false;
+    }
+}
+
+void CardLayer::placeCard(CardView* cardView, CardBand band, const Vec2& position, int zOrder) {
+    if (!cardView) {
+        return;
+    }
+    if (zOrder < 0 || zOrder >= kBandZRange) {
+        CCLOG("CardLayer::placeCard - Z order %d out of band range", zOrder);
+        zOrder = std::min(std::max(zOrder, 0), kBandZRange - 1);
+    }
+
+    int localZOrder = static_cast<int>(band) * kBandZRange + zOrder;
+    if (cardView->getParent() != this) {
+        if (cardView->getParent()) {
+            CCLOG("CardLayer::placeCard - Card already has another parent");
+            return;
+        }
+        addChild(cardView, localZOrder);
+    } else {
+        cardView->setLocalZOrder(localZOrder);
+    }
+
+    // 先切换命中检测区域，再设置位置，区域按新位置建立索引
+    updateCardArea(cardView, band);
+    float scale = getBandScale(band);
+    cardView->setBandScale(scale);
+    cardView->setPosition(getBandOrigin(band) + position * scale);
+    updateCulling(cardView, band);
+}
+
+void CardLayer::moveCardToBand(CardView* cardView, CardBand band, int zOrder) {
+    if (!cardView || cardView->getParent() != this) {
+        return;
+    }
+    Vec2 worldPosition = convertToWorldSpace(cardView->getPosition());
+    placeCard(cardView, band, convertToBandSpace(band, worldPosition), zOrder);
+}
+
+void CardLayer::setBandTransform(CardBand band, const Vec2& position, float scale) {
+    Node* anchor = _bandAnchors[static_cast<int>(band)];
+    if (!anchor || scale <= 0.0f) {
+        CCLOG("CardLayer::setBandTransform - Band has no anchor or invalid scale");
+        return;
+    }
+
+    // 按旧变换取出区域坐标，变换锚点后按新变换放回
+    getCardsInBand(band, _bandCardViews);
+    _bandCardPositions.clear();
+    for (auto cardView : _bandCardViews) {
+        _bandCardPositions.push_back(getCardPosition(cardView));
+    }
+
+    anchor->setPosition(position);
+    anchor->setScale(scale);
+
+    Vec2 origin = getBandOrigin(band);
+    for (size_t i = 0; i < _bandCardViews.size(); i++) {
+        CardView* cardView = _bandCardViews[i];
+        cardView->setBandScale(scale);
+        cardView->setPosition(origin + _bandCardPositions[i] * scale);
+        updateCulling(cardView, band);
+    }
+    _bandCardViews.clear();
+}
+
+void CardLayer::setBandCullRect(CardBand band, const Rect& rect) {
+    int index = static_cast<int>(band);
+    _bandCullRects[index] = rect;
+    _bandCulling[index] = true;
+
+    getCardsInBand(band, _bandCardViews);
+    for (auto cardView : _bandCardViews) {
+        updateCulling(cardView, band);
+    }
+    _bandCardViews.clear();
+}
+
+void CardLayer::clearBandCullRect(CardBand band) {
+    _bandCulling[static_cast<int>(band)] = false;
+
+    getCardsInBand(band, _bandCardViews);
+    for (auto cardView : _bandCardViews) {
+        cardView->setCulled(false);
+    }
+    _bandCardViews.clear();
+}
+
+size_t CardLayer::getCulledCardCount(CardBand band) const {
+    size_t count = 0;
+    for (auto child : getChildren()) {
+        auto cardView = dynamic_cast<CardView*>(child);
+        if (cardView && cardView->isCulled() && getCardBand(cardView) == band) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void CardLayer::getCardsInBand(CardBand band, std::vector<CardView*>& cardViews) const {
+    cardViews.clear();
+    for (auto child : getChildren()) {
+        auto cardView = dynamic_cast<CardView*>(child);
+        if (cardView && getCardBand(cardView) == band) {
+            cardViews.push_back(cardView);
+        }
+    }
+}
+
+CardBand CardLayer::getCardBand(const CardView* cardView) {
+    int band = cardView->getLocalZOrder() / kBandZRange;
+    if (band < 0 || band >= static_cast<int>(CardBand::COUNT)) {
+        return CardBand::OVERLAY;
+    }
+    return static_cast<CardBand>(band);
+}
+
+int CardLayer::getCardZOrder(const CardView* cardView) {
+    return cardView->getLocalZOrder() % kBandZRange;
+}
+
+Vec2 CardLayer::getCardPosition(const CardView* cardView) const {
+    CardBand band = getCardBand(cardView);
+    return (cardView->getPosition() - getBandOrigin(band)) / getBandScale(band);
+}
+
+Vec2 CardLayer::convertToBandSpace(CardBand band, const Vec2& worldPosition) const {
+    return (convertToNodeSpace(worldPosition) - getBandOrigin(band)) / getBandScale(band);
+}
+
+Vec2 CardLayer::getBandOrigin(CardBand band) const {
+    Node* anchor = _bandAnchors[static_cast<int>(band)];
+    if (!anchor) {
+        return Vec2::ZERO;
+    }
+    return convertToNodeSpace(anchor->convertToWorldSpace(Vec2::ZERO));
+}
+
+float CardLayer::getBandScale(CardBand band) const {
+    Node* anchor = _bandAnchors[static_cast<int>(band)];
+    return anchor ? anchor->getScale() : 1.0f;
+}
+
+void CardLayer::updateCardArea(CardView* cardView, CardBand band) {
+    CardArea* cardArea = _bandCardAreas[static_cast<int>(band)];
+    if (cardArea) {
+        cardArea->addCard(cardView);
+    } else if (cardView->getCardArea()) {
+        cardView->getCardArea()->removeCard(cardView);
+    }
+}
+
+void CardLayer::updateCulling(CardView* cardView, CardBand band) {
+    int index = static_cast<int>(band);
+    cardView->setCulled(_bandCulling[index] && !_bandCullRects[index].intersectsRect(cardView->getBoundingBox()));
+}
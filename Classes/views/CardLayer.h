@@ -0,0 +1,162 @@
+#ifndef __CARD_LAYER_H__
+#define __CARD_LAYER_H__
+
+#include "cocos2d.h"
+#include <vector>
+
+USING_NS_CC;
+
+class CardView;
+class CardArea;
+
+/**
+ * 卡牌所在的逻辑区域（z段）
+ */
+enum class CardBand {
+    PLAYFIELD = 0,          // 桌面牌区
+    STACK,                  // 手牌堆区
+    CURRENT,                // 底牌区
+    OVERLAY,                // 动画覆盖层
+    COUNT
+};
+
+/**
+ * 卡牌层
+ * 所有卡牌视图始终是本层的子节点，逻辑区域不再是父节点，而是z段加上区域锚点的坐标变换：
+ * 卡牌的本地z序 = 区域z段基数 + 区域内z序，位置 = 区域锚点位置 + 区域内位置 * 锚点缩放，
+ * 卡牌的区域缩放 = 锚点缩放（桌面镜头缩放时锚点带缩放）。
+ * 卡牌在区域之间移动只修改位置、缩放与z序，不再retain/removeFromParent/addChild。
+ * 区域可设置裁剪矩形，包围盒与矩形不相交的卡牌标记为裁剪，visit时直接跳过。
+ * 区域锚点（GameView中的区域节点）与本层需位于同一父节点坐标系，本层放在父节点原点且不缩放。
+ * 仅在主线程使用
+ */
+class CardLayer : public Node {
+public:
+    /**
+     * 创建卡牌层
+     * @return 卡牌层实例
+     */
+    static CardLayer* create();
+
+    /**
+     * 设置区域锚点与对应的命中检测区域
+     * @param band 区域
+     * @param anchor 锚点节点（不持有），为nullptr时区域原点即本层原点
+     * @param cardArea 命中检测区域（不持有），该区域的卡牌加入其索引；可为nullptr
+     */
+    void setBandAnchor(CardBand band, Node* anchor, CardArea* cardArea = nullptr);
+
+    /**
+     * 清除所有区域锚点与裁剪设置（区域节点销毁前调用）
+     */
+    void clearBandAnchors();
+
+    /**
+     * 把卡牌放入区域的指定位置
+     * 卡牌尚不在本层时加入本层（仅首次），之后只修改z序与位置
+     * @param cardView 卡牌视图
+     * @param band 目标区域
+     * @param position 区域坐标系中的位置
+     * @param zOrder 区域内z序，需在[0, kBandZRange)内
+     */
+    void placeCard(CardView* cardView, CardBand band, const Vec2& position, int zOrder);
+
+    /**
+     * 把卡牌移到另一区域，保持屏幕位置不变（如提升到动画覆盖层）
+     * @param cardView 卡牌视图
+     * @param band 目标区域
+     * @param zOrder 区域内z序
+     */
+    void moveCardToBand(CardView* cardView, CardBand band, int zOrder);
+
+    /**
+     * 移动并缩放区域锚点，区域内的所有卡牌保持区域坐标不变随之变换
+     * @param band 区域（需已设置锚点）
+     * @param position 锚点位置
+     * @param scale 锚点缩放，需大于0
+     */
+    void setBandTransform(CardBand band, const Vec2& position, float scale);
+
+    /**
+     * 设置区域的裁剪矩形，并重新计算区域内卡牌的裁剪状态
+     * @param band 区域
+     * @param rect 本层坐标系中的矩形
+     */
+    void setBandCullRect(CardBand band, const Rect& rect);
+
+    /**
+     * 取消区域的裁剪，区域内的卡牌全部恢复遍历
+     * @param band 区域
+     */
+    void clearBandCullRect(CardBand band);
+
+    /**
+     * 获取区域内被裁剪的卡牌数量（用于性能分析）
+     * @param band 区域
+     */
+    size_t getCulledCardCount(CardBand band) const;
+
+    /**
+     * 获取区域内的所有卡牌
+     * @param band 区域
+     * @param cardViews 输出卡牌视图列表（先清空）
+     */
+    void getCardsInBand(CardBand band, std::vector<CardView*>& cardViews) const;
+
+    /**
+     * 获取卡牌所在区域（由z段推出）
+     */
+    static CardBand getCardBand(const CardView* cardView);
+
+    /**
+     * 获取卡牌的区域内z序
+     */
+    static int getCardZOrder(const CardView* cardView);
+
+    /**
+     * 获取卡牌在区域坐标系中的位置
+     */
+    Vec2 getCardPosition(const CardView* cardView) const;
+
+    /**
+     * 世界坐标转换为区域坐标
+     * @param band 区域
+     * @param worldPosition 世界坐标
+     * @return 区域坐标
+     */
+    Vec2 convertToBandSpace(CardBand band, const Vec2& worldPosition) const;
+
+    static const int kBandZRange;               // 每个z段的范围
+
+private:
+    CardLayer();
+
+    /**
+     * 区域原点在本层坐标系中的位置
+     */
+    Vec2 getBandOrigin(CardBand band) const;
+
+    /**
+     * 区域锚点的缩放，无锚点时为1
+     */
+    float getBandScale(CardBand band) const;
+
+    /**
+     * 切换卡牌所属的命中检测区域
+     */
+    void updateCardArea(CardView* cardView, CardBand band);
+
+    /**
+     * 按区域的裁剪矩形更新卡牌的裁剪状态，未设置裁剪的区域不裁剪
+     */
+    void updateCulling(CardView* cardView, CardBand band);
+
+    Node* _bandAnchors[static_cast<int>(CardBand::COUNT)];        // 区域锚点（不持有）
+    CardArea* _bandCardAreas[static_cast<int>(CardBand::COUNT)];  // 区域命中检测（不持有）
+    Rect _bandCullRects[static_cast<int>(CardBand::COUNT)];       // 区域裁剪矩形
+    bool _bandCulling[static_cast<int>(CardBand::COUNT)];         // 区域是否裁剪
+    std::vector<CardView*> _bandCardViews;                        // 变换区域时复用的卡牌列表
+    std::vector<Vec2> _bandCardPositions;                         // 变换区域时复用的区域坐标列表
+};
+
+#endif // __CARD_LAYER_H__
@@ -1,4 +1,7 @@
 #include "CardView.h"
+#include "CardFaceCache.h"
+#include "CardArea.h"
+#include "../managers/TweenManager.h"
 
 // 移除固定尺寸，改为使用实际图片尺寸
 
@@ -15,27 +18,22 @@ CardView* CardView::create(std::shared_ptr<CardModel> cardModel) {
 CardView::CardView()
     : _cardModel(nullptr)
     , _configManager(nullptr)
-    , _cardBackground(nullptr)
-    , _cardFront(nullptr)
-    , _cardBack(nullptr)
-    , _bigNumberSprite(nullptr)
-    , _smallNumberSprite(nullptr)
-    , _suitSprite(nullptr)
     , _isHighlighted(false)
     , _isEnabled(true)
     , _isAnimating(false)
-    , _touchListener(nullptr) {
+    , _displayedFace(-1)
+    , _displayedSuit(-1)
+    , _displayedFlipped(false)
+    , _cardArea(nullptr)
+    , _bandScale(1.0f)
+    , _isCulled(false) {
 }
 
 CardView::~CardView() {
-    if (_touchListener) {
-        _eventDispatcher->removeEventListener(_touchListener);
-        _touchListener = nullptr;
-    }
 }
 
 bool CardView::initWithCardModel(std::shared_ptr<CardModel> cardModel) {
-    if (!Node::init()) {
+    if (!Sprite::init()) {
         return false;
     }
 
@@ -51,14 +49,6 @@ bool CardView::initWithCardModel(std::shared_ptr<CardModel> cardModel) {
         return false;
     }
 
-    // 创建卡牌组件（背景图片会决定实际尺寸）
-    createCardBackground();
-    createCardFront();
-    createCardBack();
-
-    // 初始化触摸事件
-    initTouchEvents();
-
     // 更新显示
     updateDisplay();
 
@@ -70,6 +60,30 @@ void CardView::setCardModel(std::shared_ptr<CardModel> cardModel) {
     updateDisplay();
 }
 
+void CardView::resetForReuse(std::shared_ptr<CardModel> cardModel) {
+    stopAllActions();
+    TweenManager::getInstance()->stopTweens(this);
+
+    _bandScale = 1.0f;
+    _isCulled = false;
+    setScale(1.0f);
+    setRotation(0.0f);
+    setColor(Color3B::WHITE);
+    setOpacity(255);
+    setVisible(true);
+    setLocalZOrder(0);
+    setAnchorPoint(Vec2(0.5f, 0.5f));
+    setPosition(Vec2::ZERO);
+
+    _isHighlighted = false;
+    _isEnabled = true;
+    _isAnimating = false;
+    _cardClickCallback = nullptr;
+    _animationCallback = nullptr;
+
+    setCardModel(cardModel);
+}
+
 void CardView::setFlipped(bool flipped, bool animated) {
     if (!_cardModel) return;
     
@@ -78,7 +92,8 @@ void CardView::setFlipped(bool flipped, bool animated) {
     _cardModel->setFlipped(flipped);
     
     if (animated) {
-        playFlipAnimation(flipped);
+        // 每次播放时读取动画配置，热重载后的时长立即生效
+        playFlipAnimation(flipped, _configManager->getAnimationConfig()->getFlipAnimationDuration());
     } else {
         updateDisplay();
     }
@@ -101,9 +116,7 @@ void CardView::setEnabled(bool enabled) {
 }
 
 void CardView::setDimmed(bool dimmed) {
-    if (_cardBackground) {
-        _cardBackground->setColor(dimmed ? Color3B(128,128,128) : Color3B::WHITE);
-    }
+    setColor(dimmed ? Color3B(128,128,128) : Color3B::WHITE);
 }
 
 void CardView::playMoveAnimation(const Vec2& targetPosition, float duration, 
@@ -111,17 +124,13 @@ void CardView::playMoveAnimation(const Vec2& targetPosition, float duration,
     if (_isAnimating) return;
     
     _isAnimating = true;
+    _animationCallback = callback;
     
-    auto moveAction = MoveTo::create(duration, targetPosition);
-    auto callbackAction = CallFunc::create([this, callback]() {
-        _isAnimating = false;
-        if (callback) {
-            callback();
-        }
+    TweenManager::getInstance()->moveTo(this, targetPosition, duration,
+                                        _configManager->getAnimationConfig()->getMoveEasing(),
+                                        0.0f, [this]() {
+        onAnimationFinished();
     });
-    
-    auto sequence = Sequence::create(moveAction, callbackAction, nullptr);
-    runAction(sequence);
 }
 
 void CardView::playFlipAnimation(bool flipped, float duration, 
@@ -129,247 +138,161 @@ void CardView::playFlipAnimation(bool flipped, float duration,
     if (_isAnimating) return;
     
     _isAnimating = true;
+    _animationCallback = callback;
     
-    // 翻牌动画：先缩放到0，切换显示，再缩放回来
-    auto scaleDown = ScaleTo::create(duration * 0.5f, 0.0f, 1.0f);
-    auto switchDisplay = CallFunc::create([this, flipped]() {
+    // 翻牌动画：先缩放到0，切换显示，再缩放回来（后半段延迟半个时长开始）
+    auto tweenManager = TweenManager::getInstance();
+    EasingType easing = _configManager->getAnimationConfig()->getFlipEasing();
+    float halfDuration = duration * 0.5f;
+    tweenManager->scaleTo(this, 0.0f, 1.0f, halfDuration, easing, 0.0f, [this]() {
         updateDisplay();
     });
-    auto scaleUp = ScaleTo::create(duration * 0.5f, 1.0f, 1.0f);
-    auto callbackAction = CallFunc::create([this, callback]() {
-        _isAnimating = false;
-        if (callback) {
-            callback();
-        }
+    tweenManager->scaleTo(this, 1.0f, 1.0f, halfDuration, easing, halfDuration, [this]() {
+        onAnimationFinished();
     });
-    
-    auto sequence = Sequence::create(scaleDown, switchDisplay, scaleUp, callbackAction, nullptr);
-    runAction(sequence);
 }
 
 void CardView::playHighlightAnimation(bool highlighted) {
     if (highlighted) {
         // 高亮效果：轻微放大和发光
-        auto scaleUp = ScaleTo::create(0.1f, 1.1f);
-        auto scaleDown = ScaleTo::create(0.1f, 1.0f);
-        auto sequence = Sequence::create(scaleUp, scaleDown, nullptr);
-        runAction(sequence);
+        auto animationConfig = _configManager->getAnimationConfig();
+        float duration = animationConfig->getHighlightAnimationDuration();
+        float scaleFactor = animationConfig->getHighlightScaleFactor();
+        auto tweenManager = TweenManager::getInstance();
+        tweenManager->scaleTo(this, scaleFactor, scaleFactor, duration, animationConfig->getHighlightEasing());
+        tweenManager->scaleTo(this, 1.0f, 1.0f, duration, animationConfig->getHighlightEasing(), duration);
 
         // 改变颜色为高亮色
-        if (_cardBackground) {
-            _cardBackground->setColor(Color3B(255, 255, 150));
-        }
+        setColor(Color3B(255, 255, 150));
     } else {
         // 恢复正常颜色
-        if (_cardBackground) {
-            _cardBackground->setColor(Color3B::WHITE);
-        }
+        setColor(Color3B::WHITE);
     }
 }
 
 void CardView::playScaleAnimation(float scale, float duration) {
-    auto scaleAction = ScaleTo::create(duration, scale);
-    runAction(scaleAction);
+    TweenManager::getInstance()->scaleTo(this, scale, scale, duration,
+                                         _configManager->getAnimationConfig()->getScaleEasing());
 }
 
-void CardView::updateDisplay() {
-    if (!_cardModel) return;
-
-    bool flipped = _cardModel->isFlipped();
+void CardView::onAnimationFinished() {
+    _isAnimating = false;
 
-    // 显示/隐藏正面和背面
-    if (_cardFront) {
-        _cardFront->setVisible(flipped);
-    }
-    if (_cardBack) {
-        _cardBack->setVisible(!flipped);
+    // 先取出回调再调用，回调中可能开始新的动画
+    std::function<void()> callback;
+    callback.swap(_animationCallback);
+    if (callback) {
+        callback();
     }
+}
 
-    // 更新正面显示
-    if (flipped) {
-        updateCardFront();
+void CardView::updateDisplay() {
+    if (!_cardModel || !isDisplayStale()) return;
+
+    // 切换为牌面或牌背帧
+    auto faceCache = CardFaceCache::getInstance();
+    SpriteFrame* frame = _cardModel->isFlipped()
+        ? faceCache->getFaceFrame(_cardModel->getFace(), _cardModel->getSuit())
+        : faceCache->getBackFrame();
+    if (frame && frame != getSpriteFrame()) {
+        setSpriteFrame(frame);
+
+        // 合成纹理内容为预乘透明度，但未带预乘标记；setSpriteFrame会按纹理标记重置混合方式，需在之后统一设置
+        setBlendFunc(BlendFunc::ALPHA_PREMULTIPLIED);
+        setOpacityModifyRGB(true);
     }
 
+    _displayedFace = _cardModel->getFace();
+    _displayedSuit = _cardModel->getSuit();
+    _displayedFlipped = _cardModel->isFlipped();
+
     // 暂时不更新位置，避免位置重置问题
     // setPosition(_cardModel->getPosition());
 }
 
-void CardView::updateCardLayout() {
-    if (!_cardBackground) return;
-
-    Size actualSize = _cardBackground->getContentSize();
-    // layout with actual size
-
-    // 更新节点内容尺寸
-    if (_cardFront) {
-        _cardFront->setContentSize(actualSize);
-    }
-    if (_cardBack) {
-        _cardBack->setContentSize(actualSize);
-    }
-
-    // 使用配置中的卡牌布局
-    auto cardLayoutConfig = _configManager->getCardLayoutConfig();
-
-    // 根据实际卡牌尺寸精确定位元素
-    if (_bigNumberSprite) {
-        // 大数字位置使用配置
-        Vec2 bigPos = cardLayoutConfig->getBigNumberAbsolutePosition(actualSize);
-        _bigNumberSprite->setPosition(bigPos);
-        // big number position
-    }
-
-    if (_smallNumberSprite) {
-        // 小数字位置使用配置
-        Vec2 smallPos = cardLayoutConfig->getSmallNumberAbsolutePosition(actualSize);
-        _smallNumberSprite->setPosition(smallPos);
-        // small number position
-    }
-
-    if (_suitSprite) {
-        // 花色位置使用配置
-        Vec2 suitPos = cardLayoutConfig->getSuitAbsolutePosition(actualSize);
-        _suitSprite->setPosition(suitPos);
-        // suit position
-    }
-
-    // 更新背面标签位置
-    if (_cardBack) {
-        auto backLabel = _cardBack->getChildByName("back_label");
-        if (backLabel) {
-            Vec2 backPos = cardLayoutConfig->getCardBackTextAbsolutePosition(actualSize);
-            backLabel->setPosition(backPos);
-        }
+bool CardView::isDisplayStale() const {
+    if (!_cardModel) {
+        return false;
     }
+    return _displayedFace != _cardModel->getFace() ||
+           _displayedSuit != _cardModel->getSuit() ||
+           _displayedFlipped != _cardModel->isFlipped();
 }
 
-void CardView::initTouchEvents() {
-    _touchListener = EventListenerTouchOneByOne::create();
-    _touchListener->setSwallowTouches(true);
-
-    _touchListener->onTouchBegan = CC_CALLBACK_2(CardView::onTouchBegan, this);
-    _touchListener->onTouchEnded = CC_CALLBACK_2(CardView::onTouchEnded, this);
-    _touchListener->onTouchCancelled = CC_CALLBACK_2(CardView::onTouchCancelled, this);
+void CardView::cleanup() {
+    Sprite::cleanup();
 
-    _eventDispatcher->addEventListenerWithSceneGraphPriority(_touchListener, this);
+    // 与动作一致：带清理地移出父节点时停止补间
+    TweenManager::getInstance()->stopTweens(this);
 }
 
-void CardView::createCardBackground() {
-    // 使用实际的卡牌底图，保持原始尺寸
-    _cardBackground = Sprite::create("res/card_general.png");
-    if (_cardBackground) {
-        // 不修改图片尺寸，保持原始大小
-        _cardBackground->setAnchorPoint(Vec2(0.5f, 0.5f));
-
-        // 根据背景图片的实际尺寸设置节点尺寸和位置
-        Size actualSize = _cardBackground->getContentSize();
-        setContentSize(actualSize);
-        _cardBackground->setPosition(actualSize.width * 0.5f, actualSize.height * 0.5f);
-        addChild(_cardBackground);
-
-        // card actual size
-    } else {
-        // 如果图片加载失败，创建简单的矩形背景
-        Size defaultSize = Size(100, 140);
-        setContentSize(defaultSize);
-        auto drawNode = DrawNode::create();
-        drawNode->drawSolidRect(Vec2::ZERO, Vec2(defaultSize.width, defaultSize.height),
-                               Color4F::WHITE);
-        drawNode->drawRect(Vec2::ZERO, Vec2(defaultSize.width, defaultSize.height),
-                          Color4F::BLACK);
-        addChild(drawNode);
+void CardView::setParent(Node* parent) {
+    if (_cardArea && parent != getParent()) {
+        _cardArea->removeCard(this);
     }
-}
 
-void CardView::createCardFront() {
-    _cardFront = Node::create();
-    addChild(_cardFront);
+    Sprite::setParent(parent);
+}
 
-    // 创建大数字精灵（中间）- 保持原始尺寸
-    _bigNumberSprite = Sprite::create("res/number/big_black_A.png");
-    if (_bigNumberSprite) {
-        _bigNumberSprite->setAnchorPoint(Vec2(0.5f, 0.5f));
-        _cardFront->addChild(_bigNumberSprite);
+void CardView::setPosition(const Vec2& position) {
+    Sprite::setPosition(position);
+    if (_cardArea) {
+        _cardArea->updateCard(this);
     }
+}
 
-    // 创建小数字精灵（左上角）- 保持原始尺寸
-    _smallNumberSprite = Sprite::create("res/number/small_black_A.png");
-    if (_smallNumberSprite) {
-        _smallNumberSprite->setAnchorPoint(Vec2(0.0f, 1.0f));
-        _cardFront->addChild(_smallNumberSprite);
+void CardView::setPosition(float x, float y) {
+    Sprite::setPosition(x, y);
+    if (_cardArea) {
+        _cardArea->updateCard(this);
     }
+}
 
-    // 创建花色精灵（右上角）- 保持原始尺寸
-    _suitSprite = Sprite::create("res/suits/club.png");
-    if (_suitSprite) {
-        _suitSprite->setAnchorPoint(Vec2(1.0f, 1.0f));
-        _cardFront->addChild(_suitSprite);
+void CardView::setBandScale(float scale) {
+    if (scale == _bandScale || scale <= 0.0f) {
+        return;
     }
 
-    // 立即更新布局（此时背景已经创建完成）
-    updateCardLayout();
+    // 保持逻辑缩放（如进行中的按压补间）不变，只替换区域缩放
+    float scaleX = getScaleX();
+    float scaleY = getScaleY();
+    _bandScale = scale;
+    setScale(scaleX, scaleY);
 }
 
-void CardView::createCardBack() {
-    _cardBack = Node::create();
-    addChild(_cardBack);
-
-    // 创建卡牌背面图案，使用配置中的字体
-    auto fontConfig = _configManager->getFontConfig();
-    auto cardBackFont = fontConfig->getCardBackFont();
-
-    auto backLabel = Label::createWithSystemFont(
-        cardBackFont.text.empty() ? "CARD" : cardBackFont.text,
-        cardBackFont.family,
-        cardBackFont.size
-    );
-    backLabel->setAnchorPoint(Vec2(0.5f, 0.5f));
-    backLabel->setColor(Color3B::BLUE);
-
-    // 立即设置到中心位置
-    Size cardSize = getCardSize();
-    backLabel->setPosition(cardSize.width * 0.5f, cardSize.height * 0.5f);
-
-    _cardBack->addChild(backLabel, 0, "back_label");
+void CardView::setScale(float scale) {
+    Sprite::setScale(scale * _bandScale);
+}
 
-    // 添加边框
-    auto border = createCardBorder();
-    if (border) {
-        _cardBack->addChild(border);
-    }
+void CardView::setScale(float scaleX, float scaleY) {
+    Sprite::setScale(scaleX * _bandScale, scaleY * _bandScale);
 }
 
-void CardView::updateCardFront() {
-    if (!_cardModel || !_bigNumberSprite || !_smallNumberSprite || !_suitSprite) return;
+void CardView::setScaleX(float scaleX) {
+    Sprite::setScaleX(scaleX * _bandScale);
+}
 
-    // 获取牌面文字
-    std::string faceText = getFaceText(_cardModel->getFace());
+void CardView::setScaleY(float scaleY) {
+    Sprite::setScaleY(scaleY * _bandScale);
+}
 
-    // 获取颜色（红色或黑色）
-    bool isRed = (_cardModel->getSuit() == CST_HEARTS ||
-                  _cardModel->getSuit() == CST_DIAMONDS);
-    std::string colorPrefix = isRed ? "red" : "black";
+float CardView::getScale() const {
+    return Sprite::getScale() / _bandScale;
+}
 
-    // 更新大数字精灵（中间）
-    std::string bigNumberPath = "res/number/big_" + colorPrefix + "_" + faceText + ".png";
-    auto bigTexture = Director::getInstance()->getTextureCache()->addImage(bigNumberPath);
-    if (bigTexture) {
-        _bigNumberSprite->setTexture(bigTexture);
-    }
+float CardView::getScaleX() const {
+    return Sprite::getScaleX() / _bandScale;
+}
 
-    // 更新小数字精灵（左上角）
-    std::string smallNumberPath = "res/number/small_" + colorPrefix + "_" + faceText + ".png";
-    auto smallTexture = Director::getInstance()->getTextureCache()->addImage(smallNumberPath);
-    if (smallTexture) {
-        _smallNumberSprite->setTexture(smallTexture);
-    }
+float CardView::getScaleY() const {
+    return Sprite::getScaleY() / _bandScale;
+}
 
-    // 更新花色精灵（右上角）
-    std::string suitPath = getSuitImagePath(_cardModel->getSuit());
-    auto suitTexture = Director::getInstance()->getTextureCache()->addImage(suitPath);
-    if (suitTexture) {
-        _suitSprite->setTexture(suitTexture);
+void CardView::visit(Renderer* renderer, const Mat4& parentTransform, uint32_t parentFlags) {
+    if (_isCulled) {
+        return;
     }
+    Sprite::visit(renderer, parentTransform, parentFlags);
 }
 
 bool CardView::onTouchBegan(Touch* touch, Event* event) {
@@ -424,54 +347,3 @@ void CardView::onTouchCancelled(Touch* touch, Event* event) {
     // 恢复正常大小
     playScaleAnimation(1.0f, 0.1f);
 }
-
-Color3B CardView::getSuitColor(CardSuitType suit) const {
-    switch (suit) {
-        case CST_HEARTS:
-        case CST_DIAMONDS:
-            return Color3B::RED;
-        case CST_CLUBS:
-        case CST_SPADES:
-            return Color3B::BLACK;
-        default:
-            return Color3B::BLACK;
-    }
-}
-
-Sprite* CardView::createCardBorder() const {
-    // 创建简单的边框
-    auto drawNode = DrawNode::create();
-    Size cardSize = getCardSize();
-    drawNode->drawRect(Vec2::ZERO, Vec2(cardSize.width, cardSize.height),
-                      Color4F(0, 0, 0, 1));
-    return nullptr; // 暂时返回nullptr，后续可以改为返回实际的边框精灵
-}
-
-std::string CardView::getFaceText(CardFaceType face) const {
-    switch (face) {
-        case CFT_ACE:   return "A";
-        case CFT_TWO:   return "2";
-        case CFT_THREE: return "3";
-        case CFT_FOUR:  return "4";
-        case CFT_FIVE:  return "5";
-        case CFT_SIX:   return "6";
-        case CFT_SEVEN: return "7";
-        case CFT_EIGHT: return "8";
-        case CFT_NINE:  return "9";
-        case CFT_TEN:   return "10";
-        case CFT_JACK:  return "J";
-        case CFT_QUEEN: return "Q";
-        case CFT_KING:  return "K";
-        default:        return "A";
-    }
-}
-
-std::string CardView::getSuitImagePath(CardSuitType suit) const {
-    switch (suit) {
-        case CST_CLUBS:    return "res/suits/club.png";
-        case CST_DIAMONDS: return "res/suits/diamond.png";
-        case CST_HEARTS:   return "res/suits/heart.png";
-        case CST_SPADES:   return "res/suits/spade.png";
-        default:           return "res/suits/club.png";
-    }
-}
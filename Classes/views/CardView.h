@@ -9,11 +9,15 @@
 
 USING_NS_CC;
 
+class CardArea;
+
 /**
  * 卡牌视图组件
- * 负责卡牌的显示、动画和触摸事件处理
+ * 负责卡牌的显示、动画和触摸事件处理，动画由TweenManager统一推进，不创建Action
+ * 卡牌本身即一个精灵，牌面与牌背取自CardFaceCache预先合成的精灵帧，翻牌时切换帧
+ * 卡牌自身不注册触摸监听器，由所在CardArea命中检测后分发；所在区域由CardLayer设置，移动时通知区域更新索引
  */
-class CardView : public Node {
+class CardView : public Sprite {
 public:
     /**
      * 创建卡牌视图
@@ -37,6 +41,13 @@ public:
     // 卡牌模型相关
     std::shared_ptr<CardModel> getCardModel() const { return _cardModel; }
     void setCardModel(std::shared_ptr<CardModel> cardModel);
+
+    /**
+     * 重置为新建时的状态并绑定模型（对象池复用）
+     * 停止动作，恢复缩放、旋转、颜色、透明度、可见性、层级与交互状态，清除点击回调
+     * @param cardModel 卡牌数据模型
+     */
+    void resetForReuse(std::shared_ptr<CardModel> cardModel);
     
     // 触摸事件回调
     using CardClickCallback = std::function<void(CardView*, std::shared_ptr<CardModel>)>;
@@ -52,6 +63,11 @@ public:
     void setEnabled(bool enabled);
     bool isEnabled() const { return _isEnabled; }
     
+    /**
+     * 是否可响应触摸（可用、未在动画中、可见且未被视口裁剪）
+     */
+    bool isTouchable() const { return _isEnabled && !_isAnimating && isVisible() && !_isCulled; }
+    
     /**
      * 独立控制是否以灰色显示（不影响交互开关）
      */
@@ -89,54 +105,83 @@ public:
      */
     void playScaleAnimation(float scale, float duration = 0.1f);
     
-    // 卡牌尺寸 - 动态获取实际图片尺寸
-    Size getCardSize() const {
-        // 返回背景图片的实际尺寸
-        if (_cardBackground) {
-            return _cardBackground->getContentSize();
-        }
-        return Size(100, 140); // 默认尺寸，仅在图片加载失败时使用
-    }
+    // 卡牌尺寸 - 即当前精灵帧尺寸
+    Size getCardSize() const { return getContentSize(); }
     
-    // 更新显示
+    // 更新显示（模型的牌面、花色与翻开状态与已显示的相同时不做任何操作）
     void updateDisplay();
-
+    
     /**
-     * 更新卡牌布局（根据实际图片尺寸）
+     * 已显示的牌面是否与模型不一致
      */
-    void updateCardLayout();
-
-protected:
+    bool isDisplayStale() const;
+    
     /**
-     * 构造函数
+     * 是否正在播放移动或翻牌动画
      */
-    CardView();
+    bool isAnimating() const { return _isAnimating; }
+    
+    /**
+     * 清理节点（停止动作、调度与补间）
+     */
+    virtual void cleanup() override;
+    
+    /**
+     * 设置父节点，离开原父节点时同时移出所在CardArea的命中索引
+     */
+    virtual void setParent(Node* parent) override;
+    
+    /**
+     * 设置所在的卡牌区域（由CardArea加入或移出索引时调用）
+     * @param cardArea 卡牌区域，不在区域中时为nullptr
+     */
+    void setCardArea(CardArea* cardArea) { _cardArea = cardArea; }
     
     /**
-     * 初始化触摸事件
+     * 获取所在的卡牌区域
      */
-    void initTouchEvents();
+    CardArea* getCardArea() const { return _cardArea; }
     
     /**
-     * 创建卡牌背景
+     * 设置位置，在CardArea中时同步区域的命中索引（动作移动也经由此处）
      */
-    void createCardBackground();
+    virtual void setPosition(const Vec2& position) override;
+    virtual void setPosition(float x, float y) override;
     
     /**
-     * 创建卡牌正面
+     * 设置所在区域的缩放（由CardLayer按区域锚点的缩放设置，如桌面镜头缩放）
+     * 节点的实际缩放 = 区域缩放 * 逻辑缩放；setScale/getScale读写的是逻辑缩放，
+     * 按压、高亮与翻牌补间照常以1.0为原始大小，不会与区域缩放冲突
+     * @param scale 区域缩放，需大于0
      */
-    void createCardFront();
+    void setBandScale(float scale);
+    float getBandScale() const { return _bandScale; }
     
     /**
-     * 创建卡牌背面
+     * 逻辑缩放（不含区域缩放）
      */
-    void createCardBack();
+    virtual void setScale(float scale) override;
+    virtual void setScale(float scaleX, float scaleY) override;
+    virtual void setScaleX(float scaleX) override;
+    virtual void setScaleY(float scaleY) override;
+    virtual float getScale() const override;
+    virtual float getScaleX() const override;
+    virtual float getScaleY() const override;
     
     /**
-     * 更新卡牌正面显示
+     * 设置是否被视口裁剪：裁剪的卡牌在visit时直接返回，不计算变换也不提交绘制
+     * 与可见性分开，游戏逻辑对setVisible的使用不受影响
+     * @param culled 是否裁剪
      */
-    void updateCardFront();
+    void setCulled(bool culled) { _isCulled = culled; }
+    bool isCulled() const { return _isCulled; }
     
+    /**
+     * 遍历节点，被裁剪时跳过
+     */
+    virtual void visit(Renderer* renderer, const Mat4& parentTransform, uint32_t parentFlags) override;
+    
+    // 触摸事件，由所在CardArea分发
     /**
      * 触摸开始事件
      */
@@ -152,53 +197,38 @@ protected:
      */
     void onTouchCancelled(Touch* touch, Event* event);
 
+protected:
+    /**
+     * 构造函数
+     */
+    CardView();
+    
+    /**
+     * 移动或翻牌动画结束：解除动画状态并调用完成回调
+     */
+    void onAnimationFinished();
+
 private:
     std::shared_ptr<CardModel> _cardModel;      // 卡牌数据模型
     CardClickCallback _cardClickCallback;       // 点击回调
+    std::function<void()> _animationCallback;   // 移动或翻牌动画的完成回调
     ConfigManager* _configManager;              // 配置管理器
     
-    // UI组件
-    Sprite* _cardBackground;                    // 卡牌背景
-    Node* _cardFront;                          // 卡牌正面
-    Node* _cardBack;                           // 卡牌背面
-    Sprite* _bigNumberSprite;                  // 大数字精灵（中间）
-    Sprite* _smallNumberSprite;                // 小数字精灵（左上角）
-    Sprite* _suitSprite;                       // 花色精灵（右上角）
-    
     // 状态
     bool _isHighlighted;                       // 是否高亮
     bool _isEnabled;                           // 是否可用
     bool _isAnimating;                         // 是否正在动画
     
-    // 触摸相关
-    EventListenerTouchOneByOne* _touchListener; // 触摸监听器
-    
-    /**
-     * 获取花色颜色
-     * @param suit 花色类型
-     * @return 颜色
-     */
-    Color3B getSuitColor(CardSuitType suit) const;
+    // 已显示的牌面（updateDisplay据此跳过重复的帧查找）
+    int _displayedFace;                        // 牌面，未显示时为-1
+    int _displayedSuit;                        // 花色，未显示时为-1
+    bool _displayedFlipped;                    // 是否显示正面
     
-    /**
-     * 创建卡牌边框
-     * @return 边框精灵
-     */
-    Sprite* createCardBorder() const;
+    // 所在的卡牌区域（不持有），不在区域中时为nullptr
+    CardArea* _cardArea;
 
-    /**
-     * 获取牌面文字
-     * @param face 牌面类型
-     * @return 牌面文字
-     */
-    std::string getFaceText(CardFaceType face) const;
-
-    /**
-     * 获取花色图片路径
-     * @param suit 花色类型
-     * @return 图片路径
-     */
-    std::string getSuitImagePath(CardSuitType suit) const;
+    float _bandScale;                          // 区域缩放
+    bool _isCulled;                            // 是否被视口裁剪
 };
 
 #endif // __CARD_VIEW_H__
@@ -0,0 +1,66 @@
+#include "CardViewPool.h"
+
+CardViewPool::CardViewPool()
+    : _createdCount(0) {
+}
+
+CardViewPool::~CardViewPool() {
+    _cardViews.clear();
+}
+
+CardView* CardViewPool::acquire(std::shared_ptr<CardModel> cardModel) {
+    for (auto cardView : _cardViews) {
+        if (isFree(cardView)) {
+            cardView->resetForReuse(cardModel);
+
+            // 与create一致：本帧内多保留一次引用，避免加入父节点前被再次取出
+            cardView->retain();
+            cardView->autorelease();
+            return cardView;
+        }
+    }
+
+    auto cardView = CardView::create(cardModel);
+    if (!cardView) {
+        CCLOG("CardViewPool::acquire - Failed to create card view");
+        return nullptr;
+    }
+    _cardViews.pushBack(cardView);
+    _createdCount++;
+    return cardView;
+}
+
+void CardViewPool::release(CardView* cardView) {
+    if (!cardView) {
+        return;
+    }
+
+    cardView->stopAllActions();
+    cardView->removeFromParent();
+}
+
+void CardViewPool::warmUp(size_t count) {
+    while (_cardViews.size() < count) {
+        auto cardView = CardView::create(nullptr);
+        if (!cardView) {
+            CCLOG("CardViewPool::warmUp - Failed to create card view");
+            return;
+        }
+        _cardViews.pushBack(cardView);
+        _createdCount++;
+    }
+}
+
+size_t CardViewPool::getFreeCount() const {
+    size_t freeCount = 0;
+    for (auto cardView : _cardViews) {
+        if (isFree(cardView)) {
+            freeCount++;
+        }
+    }
+    return freeCount;
+}
+
+bool CardViewPool::isFree(const CardView* cardView) {
+    return cardView->getReferenceCount() == 1 && cardView->getParent() == nullptr;
+}
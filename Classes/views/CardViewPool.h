@@ -0,0 +1,69 @@
+#ifndef __CARD_VIEW_POOL_H__
+#define __CARD_VIEW_POOL_H__
+
+#include "cocos2d.h"
+#include "CardView.h"
+#include <memory>
+
+USING_NS_CC;
+
+/**
+ * 卡牌视图对象池
+ * 池持有所有创建过的CardView；视图从父节点移除且没有其它引用时（引用计数为1）即视为空闲，
+ * 可被再次取出，因此各控制器沿用removeFromParent即可归还，无需逐处改为显式归还。
+ * 预热后开局、重开和撤销都不再构造新的CardView。仅在主线程使用
+ */
+class CardViewPool {
+public:
+    CardViewPool();
+    ~CardViewPool();
+
+    /**
+     * 取出卡牌视图并绑定模型
+     * 视图状态已重置（缩放、颜色、可见性、交互、点击回调等），与新建视图一致
+     * 返回的视图在本帧内保留一次引用（同create的autorelease语义），未加入父节点前不会被再次取出
+     * @param cardModel 卡牌数据模型
+     * @return 卡牌视图，创建失败时返回nullptr
+     */
+    CardView* acquire(std::shared_ptr<CardModel> cardModel);
+
+    /**
+     * 归还卡牌视图
+     * 停止动作并从父节点移除，没有其它引用后即可再次取出
+     * @param cardView 卡牌视图
+     */
+    void release(CardView* cardView);
+
+    /**
+     * 预热：保证池中至少有指定数量的视图
+     * 新建视图带autorelease引用，下一帧起才可取出，应在开局前的帧调用
+     * @param count 视图数量
+     */
+    void warmUp(size_t count);
+
+    /**
+     * 获取池中视图总数（含使用中的）
+     */
+    size_t getSize() const { return _cardViews.size(); }
+
+    /**
+     * 获取池中空闲视图数量
+     */
+    size_t getFreeCount() const;
+
+    /**
+     * 获取累计构造的视图数量（用于确认预热后不再构造）
+     */
+    size_t getCreatedCount() const { return _createdCount; }
+
+private:
+    /**
+     * 视图是否空闲（只被池引用且不在场景中）
+     */
+    static bool isFree(const CardView* cardView);
+
+    Vector<CardView*> _cardViews;               // 池中所有视图（持有）
+    size_t _createdCount;                       // 累计构造数量
+};
+
+#endif // __CARD_VIEW_POOL_H__
@@ -1,4 +1,10 @@
 #include "GameView.h"
+#include "../managers/TweenManager.h"
+#include <algorithm>
+#include <chrono>
+
+// 预热的卡牌视图数量：一副牌加上底牌与回退动画用的视图
+static const size_t kCardViewWarmUpCount = CFT_NUM_CARD_FACE_TYPES * CST_NUM_CARD_SUIT_TYPES + 2;
 
 GameView* GameView::create() {
     GameView* gameView = new (std::nothrow) GameView();
@@ -24,15 +30,43 @@ bool GameView::init() {
 
     // 初始化成员变量
     _currentCardView = nullptr;
+    _cardLayer = nullptr;
+    _playfieldCamera = nullptr;
     _playfieldArea = nullptr;
     _stackArea = nullptr;
     _currentCardArea = nullptr;
     _undoButton = nullptr;
+    _titleLabel = nullptr;
+    _playfieldBackground = nullptr;
+    _stackBackground = nullptr;
+    _lastBuildDurationMs = 0.0;
+
+    // 订阅配置变化，热重载时增量更新布局
+    _configListenerId = _configManager->addConfigChangeListener([this](const ConfigChange& change) {
+        onConfigChanged(change);
+    });
+
+    // 所有卡牌始终挂在卡牌层下，在区域之间移动不改动节点树；复用视图时卡牌层保留
+    _cardLayer = CardLayer::create();
+    addChild(_cardLayer);
+    
+    // 镜头的z序高于区域节点，先于CardArea收到触摸以识别拖动与捏合
+    _playfieldCamera = PlayfieldCamera::create(_cardLayer, CardBand::PLAYFIELD);
+    addChild(_playfieldCamera, 1);
+
+    // 关卡在后台加载，开局时预热的视图已可取出
+    _cardViewPool.warmUp(kCardViewWarmUpCount);
+
+    // 视图调和在补间推进之后执行（补间管理器优先级为0），同帧的动画回调中的标记当帧生效
+    scheduleUpdateWithPriority(1);
 
     return true;
 }
 
 GameView::~GameView() {
+    if (_configManager) {
+        _configManager->removeConfigChangeListener(_configListenerId);
+    }
     clearAllCards();
 }
 
@@ -43,6 +77,8 @@ bool GameView::initWithLevelConfig(std::shared_ptr<LevelConfig> levelConfig,
         return false;
     }
     
+    auto startTime = std::chrono::steady_clock::now();
+    
     // 清除现有内容
     clearAllCards();
     
@@ -57,11 +93,31 @@ bool GameView::initWithLevelConfig(std::shared_ptr<LevelConfig> levelConfig,
     createStackArea(levelConfig, gameModel);
     createCurrentCardArea(gameModel);
     
+    _viewReconciler.bind(gameModel, _cardLayer);
+    
     // layout completed
+    _lastBuildDurationMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - startTime).count();
+    CCLOG("GameView::initWithLevelConfig - %zu cards, %d nodes in view, built in %.2f ms",
+          _cardViewMap.size(), getNodeCount(), _lastBuildDurationMs);
     
     return true;
 }
 
+int GameView::getNodeCount() const {
+    int count = 0;
+    std::vector<const Node*> pending(1, this);
+    while (!pending.empty()) {
+        const Node* node = pending.back();
+        pending.pop_back();
+        count++;
+        for (auto child : node->getChildren()) {
+            pending.push_back(child);
+        }
+    }
+    return count;
+}
+
 CardView* GameView::getCardView(int cardId) const {
     auto it = _cardViewMap.find(cardId);
     return (it != _cardViewMap.end()) ? it->second : nullptr;
@@ -81,22 +137,49 @@ void GameView::updateDisplay(std::shared_ptr<GameModel> gameModel) {
     
     // 更新当前底牌
     auto currentCard = gameModel->getCurrentCard();
-    if (currentCard && _currentCardView) {
+    if (currentCard && _currentCardView && _currentCardView->getCardModel() != currentCard) {
         _currentCardView->setCardModel(currentCard);
-        _currentCardView->updateDisplay();
     }
     
-    // 这里可以添加更多的显示更新逻辑
+    // 其余视图在本帧调和时与模型统一同步
+    _viewReconciler.markAllDirty();
+}
+
+void GameView::update(float dt) {
+    if (!_viewReconciler.isDirty()) {
+        return;
+    }
+    _lastReconcileStats = _viewReconciler.reconcile(_currentCardView, _cardViewPool);
 }
 
 void GameView::clearAllCards() {
+    _viewReconciler.unbind();
+    
     // 清除卡牌视图
     _playfieldCardViews.clear();
     _stackCardViews.clear();
     _currentCardView = nullptr;
     _cardViewMap.clear();
     
-    // 移除所有子节点
+    // 归还卡牌层中的所有卡牌（含正在动画覆盖层中移动的卡牌）
+    if (_cardLayer) {
+        std::vector<CardView*> cardViews;
+        for (auto child : _cardLayer->getChildren()) {
+            auto cardView = dynamic_cast<CardView*>(child);
+            if (cardView) {
+                cardViews.push_back(cardView);
+            }
+        }
+        for (auto cardView : cardViews) {
+            releaseCardView(cardView);
+        }
+        if (_playfieldCamera) {
+            _playfieldCamera->detach();
+        }
+        _cardLayer->clearBandAnchors();
+    }
+    
+    // 移除区域节点
     if (_playfieldArea) {
         _playfieldArea->removeFromParent();
         _playfieldArea = nullptr;
@@ -111,36 +194,55 @@ void GameView::clearAllCards() {
     }
 }
 
+CardView* GameView::acquireCardView(std::shared_ptr<CardModel> cardModel) {
+    return _cardViewPool.acquire(cardModel);
+}
+
+void GameView::releaseCardView(CardView* cardView) {
+    _cardViewPool.release(cardView);
+}
+
+void GameView::recycle() {
+    clearAllCards();
+    
+    // 解除对上一局控制器的引用
+    _cardClickCallback = nullptr;
+    _undoCallback = nullptr;
+    setUserData(nullptr);
+    
+    setVisible(false);
+}
+
 void GameView::createPlayfieldArea(std::shared_ptr<LevelConfig> levelConfig, 
                                   std::shared_ptr<GameModel> gameModel) {
     // create playfield area
     
-    // 创建桌面牌区域节点
-    _playfieldArea = Node::create();
-    _playfieldArea->setContentSize(levelConfig->getPlayfieldSize());
+    // 创建桌面牌区域节点（区域内卡牌共用一个触摸监听器）
+    _playfieldArea = CardArea::create(levelConfig->getPlayfieldSize());
     
     // 使用配置中的桌面区域偏移位置
     auto uiLayoutConfig = _configManager->getUILayoutConfig();
     _playfieldArea->setPosition(uiLayoutConfig->getPlayfieldAreaOffset());
     addChild(_playfieldArea);
+    _cardLayer->setBandAnchor(CardBand::PLAYFIELD, _playfieldArea, _playfieldArea);
+    
+    // 超过视口的桌面从能看到全部卡牌的缩放开始，普通关卡保持原布局
+    _playfieldCamera->setMaxZoom(uiLayoutConfig->getPlayfieldMaxZoom());
+    _playfieldCamera->attach(_playfieldArea, getPlayfieldViewport(), levelConfig->getPlayfieldSize());
     
     // 根据配置创建桌面牌
     const auto& playfieldCards = gameModel->getPlayfieldCards();
     for (size_t i = 0; i < playfieldCards.size(); ++i) {
         const auto& cardModel = playfieldCards[i];
-        auto cardView = CardView::create(cardModel);
+        auto cardView = acquireCardView(cardModel);
         if (cardView) {
-            // 设置卡牌位置（相对于桌面区域）
-            cardView->setPosition(cardModel->getPosition());
-            // 固定初始化z序，便于后续撤销时按原始层级恢复
-            cardView->setLocalZOrder(static_cast<int>(i));
-            
             // 设置点击回调
             cardView->setCardClickCallback([this](CardView* view, std::shared_ptr<CardModel> model) {
                 onCardClicked(view, model);
             });
             
-            _playfieldArea->addChild(cardView);
+            // 位置相对于桌面区域；固定初始化z序，便于后续撤销时按原始层级恢复
+            _cardLayer->placeCard(cardView, CardBand::PLAYFIELD, cardModel->getPosition(), static_cast<int>(i));
             _playfieldCardViews.push_back(cardView);
             _cardViewMap[cardModel->getCardId()] = cardView;
             
@@ -153,9 +255,8 @@ void GameView::createStackArea(std::shared_ptr<LevelConfig> levelConfig,
                               std::shared_ptr<GameModel> gameModel) {
     // create stack area
 
-    // 创建手牌堆区域节点
-    _stackArea = Node::create();
-    _stackArea->setContentSize(levelConfig->getStackSize());
+    // 创建手牌堆区域节点（区域内卡牌共用一个触摸监听器）
+    _stackArea = CardArea::create(levelConfig->getStackSize());
 
     // 使用配置中的手牌堆位置
     auto uiLayoutConfig = _configManager->getUILayoutConfig();
@@ -163,18 +264,14 @@ void GameView::createStackArea(std::shared_ptr<LevelConfig> levelConfig,
     // stack position and offset from config
     _stackArea->setPosition(stackPos);
     addChild(_stackArea);
+    _cardLayer->setBandAnchor(CardBand::STACK, _stackArea, _stackArea);
 
     // 根据配置创建手牌堆（从底部到顶部）
     const auto& stackCards = gameModel->getStackCards();
     for (size_t i = 0; i < stackCards.size(); i++) {
         const auto& cardModel = stackCards[i];
-        auto cardView = CardView::create(cardModel);
+        auto cardView = acquireCardView(cardModel);
         if (cardView) {
-            // 备用牌堆左右叠放（横向偏移），顶部卡在最右侧
-            Vec2 cardPosition = Vec2(i * uiLayoutConfig->getStackCardOffset(), 0);
-            cardView->setPosition(cardPosition);
-            cardView->setLocalZOrder(static_cast<int>(i));
-
             // 只有顶部卡牌可以点击
             bool isTopCard = (i == stackCards.size() - 1);
             cardView->setEnabled(isTopCard);
@@ -184,7 +281,9 @@ void GameView::createStackArea(std::shared_ptr<LevelConfig> levelConfig,
                 onCardClicked(view, model);
             });
 
-            _stackArea->addChild(cardView);
+            // 备用牌堆左右叠放（横向偏移），顶部卡在最右侧
+            Vec2 cardPosition = Vec2(i * uiLayoutConfig->getStackCardOffset(), 0);
+            _cardLayer->placeCard(cardView, CardBand::STACK, cardPosition, static_cast<int>(i));
             _stackCardViews.push_back(cardView);
             _cardViewMap[cardModel->getCardId()] = cardView;
 
@@ -198,7 +297,7 @@ void GameView::createCurrentCardArea(std::shared_ptr<GameModel> gameModel) {
 
     // 创建底牌区域节点
     _currentCardArea = Node::create();
-    _currentCardArea->setName("currentCardArea"); // 设置名称，供CardView识别
+    _currentCardArea->setName("currentCardArea");
     
     // 设置底牌区域的尺寸（足够容纳一张卡牌）
     _currentCardArea->setContentSize(Size(182, 282)); // 标准卡牌尺寸
@@ -210,8 +309,9 @@ void GameView::createCurrentCardArea(std::shared_ptr<GameModel> gameModel) {
     
     // set position
     
-    // 确保_currentCardArea在较高层级，不被背景遮挡
-    addChild(_currentCardArea, 100);
+    // 底牌区域节点只作为卡牌层中底牌z段的锚点
+    addChild(_currentCardArea);
+    _cardLayer->setBandAnchor(CardBand::CURRENT, _currentCardArea);
 
     // 创建当前底牌 - 等待StackController的初始化
     auto currentCard = gameModel->getCurrentCard();
@@ -227,38 +327,120 @@ void GameView::createCurrentCardArea(std::shared_ptr<GameModel> gameModel) {
 void GameView::createBackground(std::shared_ptr<LevelConfig> levelConfig) {
     // 创建简单的背景
     auto visibleSize = Director::getInstance()->getVisibleSize();
-    auto uiLayoutConfig = _configManager->getUILayoutConfig();
 
-    // 桌面区域背景
-    auto playfieldBg = DrawNode::create();
-    playfieldBg->drawSolidRect(Vec2::ZERO,
-                              Vec2(levelConfig->getPlayfieldSize().width,
-                                   levelConfig->getPlayfieldSize().height),
-                              uiLayoutConfig->getPlayfieldBackgroundColor().toColor4F());
-    playfieldBg->setPosition(uiLayoutConfig->getPlayfieldAreaOffset());
-    addChild(playfieldBg, -1);
-
-    // 手牌区域背景
-    auto stackBg = DrawNode::create();
-    stackBg->drawSolidRect(Vec2::ZERO,
-                          Vec2(levelConfig->getStackSize().width * uiLayoutConfig->getStackBackgroundWidthRatio(),
-                               uiLayoutConfig->getStackBackgroundHeight()),
-                          uiLayoutConfig->getStackBackgroundColor().toColor4F());
-    // 背景固定从(0,0)开始
-    stackBg->setPosition(Vec2::ZERO);
-    addChild(stackBg, -1);
-
-    // 添加标题（使用 Marker Felt 字体）
-    auto titleLabel = Label::createWithTTF(
-        levelConfig->getLevelName().empty() ? "Card Game" : levelConfig->getLevelName(),
-        "fonts/Marker Felt.ttf", 48);
-    titleLabel->setPosition(visibleSize.width * 0.5f, visibleSize.height - 48);
-    titleLabel->setColor(Color3B::WHITE);
-    addChild(titleLabel);
+    // 桌面区域与手牌区域背景
+    if (_playfieldBackground) {
+        _playfieldBackground->removeFromParent();
+    }
+    if (_stackBackground) {
+        _stackBackground->removeFromParent();
+    }
+    _playfieldSize = levelConfig->getPlayfieldSize();
+    _stackSize = levelConfig->getStackSize();
+    _playfieldBackground = DrawNode::create();
+    addChild(_playfieldBackground, -1);
+    _stackBackground = DrawNode::create();
+    addChild(_stackBackground, -1);
+    drawBackgrounds();
+
+    // 添加标题（使用 Marker Felt 字体），复用视图时只更新文字
+    std::string title = levelConfig->getLevelName().empty() ? "Card Game" : levelConfig->getLevelName();
+    if (_titleLabel) {
+        _titleLabel->setString(title);
+    } else {
+        _titleLabel = Label::createWithTTF(title, "fonts/Marker Felt.ttf", 48);
+        _titleLabel->setPosition(visibleSize.width * 0.5f, visibleSize.height - 48);
+        _titleLabel->setColor(Color3B::WHITE);
+        addChild(_titleLabel);
+    }
 
     // background created
 }
 
+void GameView::drawBackgrounds() {
+    auto uiLayoutConfig = _configManager->getUILayoutConfig();
+
+    // 桌面区域背景，桌面超过视口时只覆盖视口
+    if (_playfieldBackground) {
+        Size viewportSize = uiLayoutConfig->getPlayfieldViewportSize();
+        _playfieldBackground->clear();
+        _playfieldBackground->drawSolidRect(Vec2::ZERO,
+                                            Vec2(std::min(_playfieldSize.width, viewportSize.width),
+                                                 std::min(_playfieldSize.height, viewportSize.height)),
+                                            uiLayoutConfig->getPlayfieldBackgroundColor().toColor4F());
+        _playfieldBackground->setPosition(uiLayoutConfig->getPlayfieldAreaOffset());
+    }
+
+    // 手牌区域背景，固定从(0,0)开始
+    if (_stackBackground) {
+        _stackBackground->clear();
+        _stackBackground->drawSolidRect(Vec2::ZERO,
+                                        Vec2(_stackSize.width * uiLayoutConfig->getStackBackgroundWidthRatio(),
+                                             uiLayoutConfig->getStackBackgroundHeight()),
+                                        uiLayoutConfig->getStackBackgroundColor().toColor4F());
+        _stackBackground->setPosition(Vec2::ZERO);
+    }
+}
+
+void GameView::onConfigChanged(const ConfigChange& change) {
+    if (change.type != ConfigType::UI_LAYOUT) {
+        return;
+    }
+
+    auto uiLayoutConfig = _configManager->getUILayoutConfig();
+
+    // 区域节点只是锚点，移动锚点后对应z段中的卡牌随之变换；桌面锚点由镜头按视口放置
+    if (change.hasChanged("PlayfieldMaxZoom")) {
+        _playfieldCamera->setMaxZoom(uiLayoutConfig->getPlayfieldMaxZoom());
+    }
+
+    if (change.hasChanged("PlayfieldAreaOffset") || change.hasChanged("PlayfieldViewportSize")) {
+        _playfieldCamera->setViewport(getPlayfieldViewport());
+    }
+
+    if (change.hasChanged("StackPosition") && _stackArea) {
+        _cardLayer->setBandTransform(CardBand::STACK, uiLayoutConfig->getStackPosition(), 1.0f);
+    }
+
+    if (change.hasChanged("CurrentCardPosition") && _currentCardArea) {
+        _cardLayer->setBandTransform(CardBand::CURRENT, uiLayoutConfig->getCurrentCardPosition(), 1.0f);
+    }
+
+    if (change.hasChanged("StackCardOffset") && _stackArea) {
+        // 手牌堆中的卡牌按区域内z序（即堆内下标）横向排列
+        float offset = uiLayoutConfig->getStackCardOffset();
+        std::vector<CardView*> cardViews;
+        _cardLayer->getCardsInBand(CardBand::STACK, cardViews);
+        for (auto cardView : cardViews) {
+            if (!TweenManager::getInstance()->isTweening(cardView)) {
+                int zOrder = CardLayer::getCardZOrder(cardView);
+                _cardLayer->placeCard(cardView, CardBand::STACK, Vec2(zOrder * offset, 0), zOrder);
+            }
+        }
+    }
+
+    if (change.hasChanged("PlayfieldAreaOffset") || change.hasChanged("PlayfieldViewportSize") ||
+        change.hasChanged("BackgroundColors") ||
+        change.hasChanged("StackBackgroundWidthRatio") || change.hasChanged("StackBackgroundHeight")) {
+        drawBackgrounds();
+    }
+
+    if (change.hasChanged("UndoButton") && _undoButton) {
+        auto undoConfig = uiLayoutConfig->getUndoButtonConfig();
+        _undoButton->setPosition(undoConfig.position);
+        auto undoLabel = dynamic_cast<Label*>(_undoButton->getLabel());
+        if (undoLabel) {
+            undoLabel->setString(undoConfig.text);
+            undoLabel->setSystemFontSize(undoConfig.fontSize);
+        }
+    }
+}
+
+Rect GameView::getPlayfieldViewport() const {
+    auto uiLayoutConfig = _configManager->getUILayoutConfig();
+    return Rect(uiLayoutConfig->getPlayfieldAreaOffset(), uiLayoutConfig->getPlayfieldViewportSize());
+}
+
 void GameView::onCardClicked(CardView* cardView, std::shared_ptr<CardModel> cardModel) {
     // card clicked
 
@@ -274,6 +456,11 @@ void GameView::createUIButtons() {
         return;
     }
 
+    // 复用视图时按钮已存在
+    if (_undoButton) {
+        return;
+    }
+
     auto uiConfig = _configManager->getUILayoutConfig();
     if (!uiConfig) {
         CCLOG("GameView::createUIButtons - UILayoutConfig not available");
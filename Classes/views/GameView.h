@@ -6,6 +6,11 @@
 #include "../configs/models/LevelConfig.h"
 #include "../managers/ConfigManager.h"
 #include "CardView.h"
+#include "CardViewPool.h"
+#include "CardArea.h"
+#include "CardLayer.h"
+#include "PlayfieldCamera.h"
+#include "ViewReconciler.h"
 #include <vector>
 #include <memory>
 #include <map>
@@ -31,6 +36,12 @@ public:
      */
     virtual bool init() override;
     
+    /**
+     * 每帧更新：有待同步的标记时执行一次视图调和
+     * @param dt 帧间隔
+     */
+    virtual void update(float dt) override;
+    
     /**
      * 析构函数
      */
@@ -77,19 +88,37 @@ public:
     void setCurrentCardView(CardView* cardView) { _currentCardView = cardView; }
     
     /**
-     * 获取当前底牌区域节点
+     * 获取卡牌层（所有卡牌视图的父节点）
+     * @return 卡牌层
+     */
+    CardLayer* getCardLayer() const { return _cardLayer; }
+    
+    /**
+     * 统计本视图节点树中的节点数（含本节点，用于性能分析）
+     * @return 节点数
+     */
+    int getNodeCount() const;
+    
+    /**
+     * 获取桌面镜头（桌面超过视口时平移、缩放桌面z段）
+     * @return 桌面镜头
+     */
+    PlayfieldCamera* getPlayfieldCamera() const { return _playfieldCamera; }
+    
+    /**
+     * 获取当前底牌区域节点（底牌z段的锚点）
      * @return 底牌区域节点
      */
     Node* getCurrentCardArea() const { return _currentCardArea; }
     
     /**
-     * 获取手牌堆区域节点
+     * 获取手牌堆区域节点（手牌堆z段的锚点）
      * @return 手牌堆区域节点
      */
     Node* getStackArea() const { return _stackArea; }
     
     /**
-     * 获取桌面区域节点
+     * 获取桌面区域节点（桌面牌z段的锚点）
      * @return 桌面区域节点
      */
     Node* getPlayfieldArea() const { return _playfieldArea; }
@@ -132,14 +161,62 @@ public:
     
     /**
      * 更新游戏显示
+     * 当前底牌视图绑定模型中的当前底牌，其余视图标记为待同步，在本帧调和时统一更新
      * @param gameModel 游戏数据模型
      */
     void updateDisplay(std::shared_ptr<GameModel> gameModel);
     
     /**
-     * 清除所有卡牌视图
+     * 标记单张卡牌的牌面需要与模型同步
+     * @param cardView 卡牌视图
+     */
+    void markCardDirty(CardView* cardView) { _viewReconciler.markCardDirty(cardView); }
+    
+    /**
+     * 标记手牌堆需要与模型同步（牌面与栈顶交互状态）
+     */
+    void markStackDirty() { _viewReconciler.markStackDirty(); }
+    
+    /**
+     * 标记底牌区域需要同步：移除不是当前底牌的视图
+     * 控制器更换底牌时只需加入新视图并设置当前底牌视图，旧视图在本帧调和时归还对象池
+     */
+    void markCurrentCardDirty() { _viewReconciler.markCurrentCardDirty(); }
+    
+    /**
+     * 获取最近一次视图调和的统计（用于性能分析）
+     */
+    const ViewReconciler::Stats& getLastReconcileStats() const { return _lastReconcileStats; }
+    
+    /**
+     * 获取最近一次按关卡建立布局（initWithLevelConfig）的耗时（用于性能分析）
+     * @return 耗时（毫秒）
+     */
+    double getLastBuildDurationMs() const { return _lastBuildDurationMs; }
+    
+    /**
+     * 清除所有卡牌视图（归还到对象池）
      */
     void clearAllCards();
+    
+    /**
+     * 从对象池取出卡牌视图
+     * 控制器需要新的卡牌视图时应通过此方法获取，不直接调用CardView::create
+     * @param cardModel 卡牌数据模型
+     * @return 卡牌视图
+     */
+    CardView* acquireCardView(std::shared_ptr<CardModel> cardModel);
+    
+    /**
+     * 归还卡牌视图到对象池
+     * @param cardView 卡牌视图
+     */
+    void releaseCardView(CardView* cardView);
+    
+    /**
+     * 回收视图以便下一局复用：清除卡牌、解除回调并隐藏
+     */
+    void recycle();
 
 protected:
     /**
@@ -175,6 +252,22 @@ protected:
      */
     void createUIButtons();
     
+    /**
+     * 绘制桌面与手牌区背景
+     */
+    void drawBackgrounds();
+    
+    /**
+     * 配置变化时增量更新布局，不重建场景
+     * @param change 配置变化信息
+     */
+    void onConfigChanged(const ConfigChange& change);
+    
+    /**
+     * 当前配置下的桌面视口（本视图坐标系）
+     */
+    Rect getPlayfieldViewport() const;
+    
     /**
      * 处理卡牌点击事件
      * @param cardView 被点击的卡牌视图
@@ -191,9 +284,23 @@ private:
     // 卡牌ID到视图的映射
     std::map<int, CardView*> _cardViewMap;
     
-    // 区域节点
-    Node* _playfieldArea;                           // 桌面牌区域
-    Node* _stackArea;                               // 手牌堆区域
+    // 卡牌视图对象池
+    CardViewPool _cardViewPool;
+    
+    // 视图调和器及最近一次调和的统计
+    ViewReconciler _viewReconciler;
+    ViewReconciler::Stats _lastReconcileStats;
+    double _lastBuildDurationMs;                    // 最近一次建立布局的耗时（毫秒）
+    
+    // 卡牌层：所有卡牌视图的唯一父节点，区域以z段区分
+    CardLayer* _cardLayer;
+    
+    // 桌面镜头：平移、缩放桌面z段并裁剪视口外的卡牌
+    PlayfieldCamera* _playfieldCamera;
+    
+    // 区域节点（卡牌层中对应z段的锚点）
+    CardArea* _playfieldArea;                       // 桌面牌区域
+    CardArea* _stackArea;                           // 手牌堆区域
     Node* _currentCardArea;                         // 底牌区域
     
     // 回调函数
@@ -202,6 +309,16 @@ private:
     
     // UI元素
     MenuItemLabel* _undoButton;                     // 回退按钮
+    Label* _titleLabel;                             // 关卡标题
+    DrawNode* _playfieldBackground;                 // 桌面区域背景
+    DrawNode* _stackBackground;                     // 手牌区域背景
+    
+    // 当前关卡区域尺寸（重绘背景用）
+    Size _playfieldSize;
+    Size _stackSize;
+    
+    // 配置变化订阅ID
+    int _configListenerId;
     
     // 配置管理器（不持有，只引用）
     ConfigManager* _configManager;
@@ -0,0 +1,347 @@
+#include "LevelSelectListView.h"
+#include "../managers/FrameRateGovernor.h"
+#include <algorithm>
+#include <cmath>
+
+const float LevelSelectListView::kRowHeight = 150.0f;
+const Size LevelSelectListView::kButtonSize = Size(360.0f, 110.0f);
+const float LevelSelectListView::kFontSize = 48.0f;
+const int LevelSelectListView::kBufferRows = 1;
+const float LevelSelectListView::kDragThreshold = 20.0f;
+const float LevelSelectListView::kDeceleration = 3000.0f;
+
+// 按钮配色（与原关卡菜单一致）
+static const Color4F kNormalBackground(0.22f, 0.36f, 0.52f, 0.96f);
+static const Color4F kNormalBorder(1.0f, 1.0f, 1.0f, 0.60f);
+static const Color4F kPressedBackground(0.30f, 0.50f, 0.70f, 0.98f);
+static const Color4F kPressedBorder(1.0f, 1.0f, 1.0f, 0.80f);
+
+LevelSelectListView* LevelSelectListView::create(const Size& viewSize) {
+    LevelSelectListView* listView = new (std::nothrow) LevelSelectListView();
+    if (listView && listView->initWithViewSize(viewSize)) {
+        listView->autorelease();
+        return listView;
+    }
+    CC_SAFE_DELETE(listView);
+    return nullptr;
+}
+
+LevelSelectListView::LevelSelectListView()
+    : _clipNode(nullptr)
+    , _scrollOffset(0.0f)
+    , _velocity(0.0f)
+    , _dragDelta(0.0f)
+    , _touchListener(nullptr)
+    , _mouseListener(nullptr)
+    , _isDragging(false)
+    , _pressedIndex(-1) {
+}
+
+LevelSelectListView::~LevelSelectListView() {
+    if (_touchListener) {
+        _eventDispatcher->removeEventListener(_touchListener);
+        _touchListener = nullptr;
+    }
+    if (_mouseListener) {
+        _eventDispatcher->removeEventListener(_mouseListener);
+        _mouseListener = nullptr;
+    }
+}
+
+bool LevelSelectListView::initWithViewSize(const Size& viewSize) {
+    if (!Node::init()) {
+        return false;
+    }
+
+    _viewSize = viewSize;
+    setContentSize(viewSize);
+
+    // 裁剪到可视区域，缓冲行在区域外不可见
+    _clipNode = ClippingRectangleNode::create(Rect(0, 0, viewSize.width, viewSize.height));
+    addChild(_clipNode);
+
+    _touchListener = EventListenerTouchOneByOne::create();
+    _touchListener->setSwallowTouches(true);
+    _touchListener->onTouchBegan = CC_CALLBACK_2(LevelSelectListView::onTouchBegan, this);
+    _touchListener->onTouchMoved = CC_CALLBACK_2(LevelSelectListView::onTouchMoved, this);
+    _touchListener->onTouchEnded = CC_CALLBACK_2(LevelSelectListView::onTouchEnded, this);
+    _touchListener->onTouchCancelled = CC_CALLBACK_2(LevelSelectListView::onTouchCancelled, this);
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(_touchListener, this);
+
+    _mouseListener = EventListenerMouse::create();
+    _mouseListener->onMouseScroll = CC_CALLBACK_1(LevelSelectListView::onMouseScroll, this);
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(_mouseListener, this);
+
+    scheduleUpdate();
+    return true;
+}
+
+void LevelSelectListView::setLevelIds(const std::vector<int>& levelIds) {
+    _levelIds = levelIds;
+    _velocity = 0.0f;
+    setPressedIndex(-1);
+
+    // 行数可能变化，关卡下标到行的映射随之变化，全部重新绑定
+    ensureRows();
+    for (auto& row : _rows) {
+        row.index = -1;
+        row.node->setVisible(false);
+    }
+    setScrollOffset(0.0f);
+}
+
+int LevelSelectListView::getLevelIdAt(const Vec2& worldLocation) const {
+    if (!isVisibleInHierarchy()) {
+        return 0;
+    }
+    int index = getIndexAt(convertToNodeSpace(worldLocation));
+    return index >= 0 ? _levelIds[index] : 0;
+}
+
+void LevelSelectListView::update(float dt) {
+    if (_isDragging) {
+        // 拖动时按本帧的拖动距离估算速度，松手后以此惯性滚动
+        if (dt > 0.0f) {
+            _velocity = _dragDelta / dt;
+        }
+        _dragDelta = 0.0f;
+        return;
+    }
+
+    if (_velocity == 0.0f) {
+        return;
+    }
+
+    float previousOffset = _scrollOffset;
+    setScrollOffset(_scrollOffset + _velocity * dt);
+
+    // 减速到零或滚到边界时停止
+    float speed = std::max(0.0f, std::abs(_velocity) - kDeceleration * dt);
+    _velocity = (_scrollOffset == previousOffset) ? 0.0f : std::copysign(speed, _velocity);
+
+    // 惯性滚动期间保持正常帧率
+    FrameRateGovernor::notifyActivity();
+}
+
+bool LevelSelectListView::onTouchBegan(Touch* touch, Event* event) {
+    // 场景图优先级的监听器不考虑可见性，隐藏时（进入关卡后）不响应
+    if (!isVisibleInHierarchy()) {
+        return false;
+    }
+
+    Vec2 localPoint = convertToNodeSpace(touch->getLocation());
+    if (!Rect(0, 0, _viewSize.width, _viewSize.height).containsPoint(localPoint)) {
+        return false;
+    }
+
+    _touchStartLocation = touch->getLocation();
+    _isDragging = false;
+    _velocity = 0.0f;
+    _dragDelta = 0.0f;
+    setPressedIndex(getIndexAt(localPoint));
+    return true;
+}
+
+void LevelSelectListView::onTouchMoved(Touch* touch, Event* event) {
+    if (!_isDragging) {
+        if (touch->getLocation().distance(_touchStartLocation) < kDragThreshold) {
+            return;
+        }
+        // 超过阈值后转为拖动，取消按下态
+        _isDragging = true;
+        setPressedIndex(-1);
+    }
+
+    // 手指上移，列表内容随之上移，显示后面的关卡
+    float delta = touch->getDelta().y;
+    _dragDelta += delta;
+    setScrollOffset(_scrollOffset + delta);
+}
+
+void LevelSelectListView::onTouchEnded(Touch* touch, Event* event) {
+    if (_isDragging) {
+        _isDragging = false;
+        _dragDelta = 0.0f;
+        return;
+    }
+
+    // 抬起时仍在按下的按钮上才算点击
+    int pressedIndex = _pressedIndex;
+    setPressedIndex(-1);
+    if (pressedIndex < 0 || getIndexAt(convertToNodeSpace(touch->getLocation())) != pressedIndex) {
+        return;
+    }
+    if (_levelSelectedCallback) {
+        _levelSelectedCallback(_levelIds[pressedIndex]);
+    }
+}
+
+void LevelSelectListView::onTouchCancelled(Touch* touch, Event* event) {
+    _isDragging = false;
+    _dragDelta = 0.0f;
+    _velocity = 0.0f;
+    setPressedIndex(-1);
+}
+
+void LevelSelectListView::onMouseScroll(EventMouse* event) {
+    if (!isVisibleInHierarchy()) {
+        return;
+    }
+
+    Vec2 localPoint = convertToNodeSpace(Vec2(event->getCursorX(), event->getCursorY()));
+    if (!Rect(0, 0, _viewSize.width, _viewSize.height).containsPoint(localPoint)) {
+        return;
+    }
+
+    // 滚轮向下为正，每格滚动半行
+    _velocity = 0.0f;
+    setScrollOffset(_scrollOffset + event->getScrollY() * kRowHeight * 0.5f);
+}
+
+void LevelSelectListView::ensureRows() {
+    // 可见范围最多跨越 ceil(可视高度 / 行高) + 1 行，另加上下缓冲行
+    int visibleRows = static_cast<int>(std::ceil(_viewSize.height / kRowHeight)) + 1;
+    size_t rowCount = std::min(static_cast<size_t>(visibleRows + kBufferRows * 2), _levelIds.size());
+
+    while (_rows.size() < rowCount) {
+        Row row;
+        row.node = Node::create();
+        row.node->setContentSize(kButtonSize);
+        row.node->setAnchorPoint(Vec2(0.5f, 0.5f));
+        row.node->setVisible(false);
+        _clipNode->addChild(row.node);
+
+        row.background = DrawNode::create();
+        row.node->addChild(row.background);
+
+        // 所有行同一字体与字号，共用同一张字形图集
+        row.label = Label::createWithTTF("", "fonts/Marker Felt.ttf", kFontSize);
+        row.label->setColor(Color3B::WHITE);
+        row.label->setPosition(Vec2(kButtonSize.width * 0.5f, kButtonSize.height * 0.5f));
+        row.node->addChild(row.label, 1);
+
+        row.index = -1;
+        row.isPressed = true;
+        drawRowBackground(row, false);
+        _rows.push_back(row);
+    }
+}
+
+void LevelSelectListView::layoutRows() {
+    if (_rows.empty()) {
+        return;
+    }
+
+    // 可见范围（含缓冲行）内的关卡下标
+    float top = _scrollOffset - getContentTopPadding();
+    int lastIndex = static_cast<int>(_levelIds.size()) - 1;
+    int first = std::max(0, static_cast<int>(std::floor(top / kRowHeight)) - kBufferRows);
+    int last = std::min(lastIndex, static_cast<int>(std::floor((top + _viewSize.height) / kRowHeight)) + kBufferRows);
+
+    // 隐藏滚出范围的行
+    for (auto& row : _rows) {
+        if (row.index >= 0 && (row.index < first || row.index > last)) {
+            row.index = -1;
+            row.node->setVisible(false);
+        }
+    }
+
+    int rowCount = static_cast<int>(_rows.size());
+    for (int index = first; index <= last; index++) {
+        Row& row = _rows[index % rowCount];
+        if (row.index != index) {
+            // 复用行节点：只改写文字
+            row.index = index;
+            row.label->setString(StringUtils::format("Level %d", _levelIds[index]));
+            row.node->setVisible(true);
+            drawRowBackground(row, index == _pressedIndex);
+        }
+        float y = _viewSize.height + top - (index + 0.5f) * kRowHeight;
+        row.node->setPosition(Vec2(_viewSize.width * 0.5f, y));
+    }
+}
+
+void LevelSelectListView::setScrollOffset(float offset) {
+    _scrollOffset = std::min(std::max(offset, 0.0f), getMaxScrollOffset());
+    layoutRows();
+}
+
+float LevelSelectListView::getMaxScrollOffset() const {
+    float contentHeight = _levelIds.size() * kRowHeight;
+    return std::max(0.0f, contentHeight - _viewSize.height);
+}
+
+float LevelSelectListView::getContentTopPadding() const {
+    float contentHeight = _levelIds.size() * kRowHeight;
+    return std::max(0.0f, (_viewSize.height - contentHeight) * 0.5f);
+}
+
+int LevelSelectListView::getIndexAt(const Vec2& localPoint) const {
+    if (!Rect(0, 0, _viewSize.width, _viewSize.height).containsPoint(localPoint)) {
+        return -1;
+    }
+
+    float top = _scrollOffset - getContentTopPadding();
+    float distanceFromTop = _viewSize.height - localPoint.y + top;
+    if (distanceFromTop < 0.0f) {
+        return -1;
+    }
+    int index = static_cast<int>(distanceFromTop / kRowHeight);
+    if (index >= static_cast<int>(_levelIds.size())) {
+        return -1;
+    }
+
+    // 行间空隙与按钮两侧不算命中
+    float centerY = _viewSize.height + top - (index + 0.5f) * kRowHeight;
+    if (std::abs(localPoint.x - _viewSize.width * 0.5f) > kButtonSize.width * 0.5f ||
+        std::abs(localPoint.y - centerY) > kButtonSize.height * 0.5f) {
+        return -1;
+    }
+    return index;
+}
+
+void LevelSelectListView::drawRowBackground(Row& row, bool pressed) {
+    if (row.isPressed == pressed) {
+        return;
+    }
+    row.isPressed = pressed;
+
+    row.background->clear();
+    row.background->drawSolidRect(Vec2::ZERO, Vec2(kButtonSize.width, kButtonSize.height),
+                                  pressed ? kPressedBackground : kNormalBackground);
+    row.background->drawRect(Vec2(0.5f, 0.5f), Vec2(kButtonSize.width - 0.5f, kButtonSize.height - 0.5f),
+                             pressed ? kPressedBorder : kNormalBorder);
+}
+
+void LevelSelectListView::setPressedIndex(int index) {
+    if (_pressedIndex == index) {
+        return;
+    }
+
+    Row* row = findRow(_pressedIndex);
+    if (row) {
+        drawRowBackground(*row, false);
+    }
+    _pressedIndex = index;
+    row = findRow(_pressedIndex);
+    if (row) {
+        drawRowBackground(*row, true);
+    }
+}
+
+LevelSelectListView::Row* LevelSelectListView::findRow(int index) {
+    if (index < 0 || _rows.empty()) {
+        return nullptr;
+    }
+    Row& row = _rows[index % _rows.size()];
+    return row.index == index ? &row : nullptr;
+}
+
+bool LevelSelectListView::isVisibleInHierarchy() const {
+    for (const Node* node = this; node; node = node->getParent()) {
+        if (!node->isVisible()) {
+            return false;
+        }
+    }
+    return true;
+}
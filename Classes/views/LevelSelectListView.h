@@ -0,0 +1,177 @@
+#ifndef __LEVEL_SELECT_LIST_VIEW_H__
+#define __LEVEL_SELECT_LIST_VIEW_H__
+
+#include "cocos2d.h"
+#include <vector>
+#include <functional>
+
+USING_NS_CC;
+
+/**
+ * 关卡选择列表视图（虚拟化）
+ * 只创建可见行数加少量缓冲行的按钮节点，滚动时按行下标对行数取模复用节点，
+ * 滚过一行只需改写一个按钮的文字与位置。打开列表的开销与关卡数量无关，
+ * 关卡ID列表本身只是一个整数数组。
+ * 各行文字共用同一字体与字号，字形来自同一张字形图集。
+ * 支持拖动（带惯性）、鼠标滚轮滚动与点击选择。仅在主线程使用
+ */
+class LevelSelectListView : public Node {
+public:
+    /**
+     * 关卡选择回调
+     */
+    using LevelSelectedCallback = std::function<void(int levelId)>;
+
+    /**
+     * 创建关卡列表
+     * @param viewSize 可视区域尺寸
+     * @return 关卡列表实例
+     */
+    static LevelSelectListView* create(const Size& viewSize);
+
+    /**
+     * 初始化关卡列表
+     * @param viewSize 可视区域尺寸
+     * @return 是否初始化成功
+     */
+    bool initWithViewSize(const Size& viewSize);
+
+    /**
+     * 析构函数
+     */
+    virtual ~LevelSelectListView();
+
+    /**
+     * 设置关卡ID列表并滚动到顶部
+     * @param levelIds 关卡ID列表（按显示顺序）
+     */
+    void setLevelIds(const std::vector<int>& levelIds);
+
+    /**
+     * 设置关卡选择回调
+     * @param callback 回调
+     */
+    void setLevelSelectedCallback(const LevelSelectedCallback& callback) { _levelSelectedCallback = callback; }
+
+    /**
+     * 获取指定位置下的关卡ID（用于悬停预取）
+     * @param worldLocation 世界坐标
+     * @return 关卡ID，不在任何按钮上时返回0
+     */
+    int getLevelIdAt(const Vec2& worldLocation) const;
+
+    /**
+     * 获取已创建的行节点数量（与关卡数量无关）
+     */
+    size_t getRowNodeCount() const { return _rows.size(); }
+
+    /**
+     * 每帧更新：拖动时估算速度，松手后惯性滚动
+     * @param dt 帧间隔
+     */
+    virtual void update(float dt) override;
+
+protected:
+    LevelSelectListView();
+
+    // 输入事件
+    bool onTouchBegan(Touch* touch, Event* event);
+    void onTouchMoved(Touch* touch, Event* event);
+    void onTouchEnded(Touch* touch, Event* event);
+    void onTouchCancelled(Touch* touch, Event* event);
+    void onMouseScroll(EventMouse* event);
+
+private:
+    /**
+     * 复用的行节点
+     */
+    struct Row {
+        Node* node;                 // 行根节点
+        DrawNode* background;       // 按钮背景与边框
+        Label* label;               // 关卡文字
+        int index;                  // 当前显示的关卡下标，未使用时为-1
+        bool isPressed;             // 按钮是否绘制为按下态
+    };
+
+    /**
+     * 按需补足行节点（可见行数加缓冲行数，且不超过关卡数量）
+     */
+    void ensureRows();
+
+    /**
+     * 按滚动位置把可见范围内的关卡绑定到行节点，并隐藏其余行
+     */
+    void layoutRows();
+
+    /**
+     * 设置滚动位置（限制在有效范围内）并重新布局
+     * @param offset 滚动位置，0为顶部
+     */
+    void setScrollOffset(float offset);
+
+    /**
+     * 最大滚动位置
+     */
+    float getMaxScrollOffset() const;
+
+    /**
+     * 第一行顶部到可视区域顶部的距离（关卡少于一屏时居中显示）
+     */
+    float getContentTopPadding() const;
+
+    /**
+     * 本地坐标处的按钮对应的关卡下标
+     * @param localPoint 本节点坐标系中的点
+     * @return 关卡下标，不在按钮上时返回-1
+     */
+    int getIndexAt(const Vec2& localPoint) const;
+
+    /**
+     * 绘制按钮背景
+     * @param row 行节点
+     * @param pressed 是否按下态
+     */
+    void drawRowBackground(Row& row, bool pressed);
+
+    /**
+     * 设置按下的关卡，并切换对应行的按钮颜色
+     * @param index 关卡下标，-1表示取消按下
+     */
+    void setPressedIndex(int index);
+
+    /**
+     * 查找显示指定关卡下标的行节点
+     * @return 行节点，不可见时返回nullptr
+     */
+    Row* findRow(int index);
+
+    /**
+     * 列表及其所有父节点是否可见
+     */
+    bool isVisibleInHierarchy() const;
+
+    static const float kRowHeight;                  // 行高（原菜单的按钮间距）
+    static const Size kButtonSize;                  // 按钮尺寸
+    static const float kFontSize;                   // 字号
+    static const int kBufferRows;                   // 可见范围上下各多保留的行数
+    static const float kDragThreshold;              // 超过该距离视为拖动而非点击
+    static const float kDeceleration;               // 惯性滚动的减速度（像素/秒²）
+
+    std::vector<int> _levelIds;                     // 关卡ID列表
+    std::vector<Row> _rows;                         // 复用的行节点，关卡下标 % 行数 即所在行
+    Size _viewSize;                                 // 可视区域尺寸
+    ClippingRectangleNode* _clipNode;               // 裁剪到可视区域
+    float _scrollOffset;                            // 滚动位置
+    float _velocity;                                // 惯性滚动速度（像素/秒）
+    float _dragDelta;                               // 本帧累计的拖动距离
+
+    EventListenerTouchOneByOne* _touchListener;     // 触摸监听器
+    EventListenerMouse* _mouseListener;             // 鼠标滚轮监听器
+    Vec2 _touchStartLocation;                       // 按下位置
+    bool _isDragging;                               // 是否正在拖动
+    int _pressedIndex;                              // 按下的关卡下标
+
+    LevelSelectedCallback _levelSelectedCallback;   // 关卡选择回调
+};
+
+#endif // __LEVEL_SELECT_LIST_VIEW_H__
@@ -0,0 +1,260 @@
+#include "PlayfieldCamera.h"
+#include "CardArea.h"
+
+const float PlayfieldCamera::kDragThreshold = 20.0f;
+const float PlayfieldCamera::kScrollZoomStep = 1.1f;
+
+PlayfieldCamera* PlayfieldCamera::create(CardLayer* cardLayer, CardBand band) {
+    PlayfieldCamera* camera = new (std::nothrow) PlayfieldCamera();
+    if (camera && camera->initWithCardLayer(cardLayer, band)) {
+        camera->autorelease();
+        return camera;
+    }
+    CC_SAFE_DELETE(camera);
+    return nullptr;
+}
+
+PlayfieldCamera::PlayfieldCamera()
+    : _cardLayer(nullptr)
+    , _band(CardBand::PLAYFIELD)
+    , _cardArea(nullptr)
+    , _touchListener(nullptr)
+    , _mouseListener(nullptr)
+    , _isPanning(false) {
+}
+
+PlayfieldCamera::~PlayfieldCamera() {
+    if (_touchListener) {
+        _eventDispatcher->removeEventListener(_touchListener);
+        _touchListener = nullptr;
+    }
+    if (_mouseListener) {
+        _eventDispatcher->removeEventListener(_mouseListener);
+        _mouseListener = nullptr;
+    }
+}
+
+bool PlayfieldCamera::initWithCardLayer(CardLayer* cardLayer, CardBand band) {
+    if (!Node::init()) {
+        return false;
+    }
+    if (!cardLayer) {
+        CCLOG("PlayfieldCamera::initWithCardLayer - Card layer is null");
+        return false;
+    }
+
+    _cardLayer = cardLayer;
+    _band = band;
+
+    // 不吞没触摸：未形成拖动时触摸照常交给CardArea点击卡牌
+    _touchListener = EventListenerTouchOneByOne::create();
+    _touchListener->setSwallowTouches(false);
+    _touchListener->onTouchBegan = CC_CALLBACK_2(PlayfieldCamera::onTouchBegan, this);
+    _touchListener->onTouchMoved = CC_CALLBACK_2(PlayfieldCamera::onTouchMoved, this);
+    _touchListener->onTouchEnded = CC_CALLBACK_2(PlayfieldCamera::onTouchEnded, this);
+    _touchListener->onTouchCancelled = CC_CALLBACK_2(PlayfieldCamera::onTouchEnded, this);
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(_touchListener, this);
+
+    _mouseListener = EventListenerMouse::create();
+    _mouseListener->onMouseScroll = CC_CALLBACK_1(PlayfieldCamera::onMouseScroll, this);
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(_mouseListener, this);
+
+    return true;
+}
+
+void PlayfieldCamera::attach(CardArea* cardArea, const Rect& viewport, const Size& worldSize) {
+    _cardArea = cardArea;
+    _viewport = viewport;
+    _viewportState.reset(viewport.origin, viewport.size, worldSize);
+    _touches.clear();
+    _isPanning = false;
+
+    applyTransform(true);
+    updateCullRect();
+}
+
+void PlayfieldCamera::detach() {
+    if (_cardArea) {
+        _cardLayer->clearBandCullRect(_band);
+    }
+    _cardArea = nullptr;
+    _touches.clear();
+    _isPanning = false;
+}
+
+void PlayfieldCamera::setViewport(const Rect& viewport) {
+    _viewport = viewport;
+    _viewportState.setViewport(viewport.origin, viewport.size);
+    if (!_cardArea) {
+        return;
+    }
+
+    applyTransform(true);
+    updateCullRect();
+}
+
+void PlayfieldCamera::setMaxZoom(float maxZoom) {
+    _viewportState.setMaxZoom(maxZoom);
+    applyTransform();
+}
+
+void PlayfieldCamera::zoomAt(float zoom, const Vec2& focus) {
+    if (!_cardArea) {
+        return;
+    }
+    _viewportState.zoomAt(zoom, focus);
+    applyTransform();
+}
+
+void PlayfieldCamera::panBy(const Vec2& delta) {
+    if (!_cardArea) {
+        return;
+    }
+    _viewportState.panBy(delta);
+    applyTransform();
+}
+
+bool PlayfieldCamera::onTouchBegan(Touch* touch, Event* event) {
+    // 场景图优先级的监听器不考虑可见性，隐藏的视图（如回收后的GameView）不响应
+    if (!_cardArea || !isInteractive() || _touches.size() >= 2 || !isVisibleInHierarchy()) {
+        return false;
+    }
+
+    Vec2 location = toParentSpace(touch->getLocation());
+    if (!_viewport.containsPoint(location)) {
+        return false;
+    }
+
+    TrackedTouch trackedTouch;
+    trackedTouch.id = touch->getID();
+    trackedTouch.location = location;
+    _touches.push_back(trackedTouch);
+
+    if (_touches.size() == 1) {
+        _touchStartLocation = location;
+        _isPanning = false;
+    } else {
+        // 第二个手指按下即进入捏合缩放
+        _isPanning = true;
+        cancelCardTouch();
+    }
+    return true;
+}
+
+void PlayfieldCamera::onTouchMoved(Touch* touch, Event* event) {
+    int index = findTouch(touch->getID());
+    if (index < 0) {
+        return;
+    }
+
+    Vec2 location = toParentSpace(touch->getLocation());
+    if (_touches.size() == 2) {
+        // 捏合：按两指距离的变化缩放，按两指中点的移动平移
+        const Vec2& other = _touches[1 - index].location;
+        Vec2 previousCenter = (_touches[index].location + other) * 0.5f;
+        float previousDistance = _touches[index].location.distance(other);
+        _touches[index].location = location;
+
+        Vec2 center = (location + other) * 0.5f;
+        float distance = location.distance(other);
+        if (previousDistance > 0.0f && distance > 0.0f) {
+            zoomAt(getZoom() * distance / previousDistance, previousCenter);
+        }
+        panBy(center - previousCenter);
+
+        // 第二个手指可能在按下时被CardArea当作点击接收
+        cancelCardTouch();
+        return;
+    }
+
+    Vec2 delta = location - _touches[index].location;
+    _touches[index].location = location;
+    if (!_isPanning) {
+        if (location.distance(_touchStartLocation) <= kDragThreshold) {
+            return;
+        }
+        _isPanning = true;
+        cancelCardTouch();
+        delta = location - _touchStartLocation;
+    }
+    panBy(delta);
+}
+
+void PlayfieldCamera::onTouchEnded(Touch* touch, Event* event) {
+    int index = findTouch(touch->getID());
+    if (index < 0) {
+        return;
+    }
+    _touches.erase(_touches.begin() + index);
+
+    // 捏合后剩下的手指从当前位置继续平移
+    if (!_touches.empty()) {
+        _touchStartLocation = _touches[0].location;
+    }
+}
+
+void PlayfieldCamera::onMouseScroll(EventMouse* event) {
+    if (!_cardArea || !isInteractive() || !isVisibleInHierarchy()) {
+        return;
+    }
+
+    Vec2 location = toParentSpace(Vec2(event->getCursorX(), event->getCursorY()));
+    if (!_viewport.containsPoint(location)) {
+        return;
+    }
+
+    // 滚轮向下为正，缩小
+    float step = event->getScrollY() > 0 ? 1.0f / kScrollZoomStep : kScrollZoomStep;
+    zoomAt(getZoom() * step, location);
+}
+
+void PlayfieldCamera::applyTransform(bool force) {
+    if (!_cardArea) {
+        return;
+    }
+
+    // 平移到边界后继续拖动时变换不变，无需重新放置卡牌
+    Vec2 position = _viewportState.getContentOrigin();
+    float zoom = _viewportState.getZoom();
+    if (!force && _cardArea->getPosition() == position && _cardArea->getScale() == zoom) {
+        return;
+    }
+    _cardLayer->setBandTransform(_band, position, zoom);
+}
+
+void PlayfieldCamera::updateCullRect() {
+    // 只有内容超出视口时才可能有卡牌在视口外
+    if (isInteractive()) {
+        _cardLayer->setBandCullRect(_band, _viewport);
+    } else {
+        _cardLayer->clearBandCullRect(_band);
+    }
+}
+
+Vec2 PlayfieldCamera::toParentSpace(const Vec2& worldLocation) const {
+    return getParent() ? getParent()->convertToNodeSpace(worldLocation) : worldLocation;
+}
+
+int PlayfieldCamera::findTouch(int id) const {
+    for (size_t i = 0; i < _touches.size(); i++) {
+        if (_touches[i].id == id) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void PlayfieldCamera::cancelCardTouch() {
+    if (_cardArea) {
+        _cardArea->cancelTouch();
+    }
+}
+
+bool PlayfieldCamera::isVisibleInHierarchy() const {
+    for (const Node* node = this; node; node = node->getParent()) {
+        if (!node->isVisible()) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,167 @@
+#ifndef __PLAYFIELD_CAMERA_H__
+#define __PLAYFIELD_CAMERA_H__
+
+#include "cocos2d.h"
+#include "CardLayer.h"
+#include "../utils/PlayfieldViewport.h"
+#include <vector>
+
+USING_NS_CC;
+
+class CardArea;
+
+/**
+ * 桌面镜头
+ * 关卡桌面尺寸超过视口时，支持单指拖动平移、双指捏合与鼠标滚轮缩放。
+ * 平移与缩放的限制由PlayfieldViewport计算，本节点负责手势与应用变换。
+ * 镜头不移动节点树：平移与缩放作用于卡牌层中桌面z段的锚点（即桌面CardArea），
+ * 由CardLayer按新锚点变换放置z段中的卡牌，并把视口设为z段的裁剪矩形，
+ * 视口外的卡牌在visit时直接跳过，遍历与绘制开销只与视口内的卡牌数量相关。
+ * 桌面不超过视口的普通关卡不响应手势，布局与原来完全一致。
+ * 本节点需挂在卡牌层的父节点下、位于原点且不缩放，z序高于CardArea以先收到触摸。仅在主线程使用
+ */
+class PlayfieldCamera : public Node {
+public:
+    /**
+     * 创建桌面镜头
+     * @param cardLayer 卡牌层（不持有）
+     * @param band 镜头控制的区域
+     * @return 桌面镜头实例
+     */
+    static PlayfieldCamera* create(CardLayer* cardLayer, CardBand band);
+
+    /**
+     * 初始化桌面镜头
+     * @param cardLayer 卡牌层（不持有）
+     * @param band 镜头控制的区域
+     * @return 是否初始化成功
+     */
+    bool initWithCardLayer(CardLayer* cardLayer, CardBand band);
+
+    /**
+     * 析构函数
+     */
+    virtual ~PlayfieldCamera();
+
+    /**
+     * 绑定区域并重置镜头：缩放到能看到全部内容（不超过1）
+     * 需在区域锚点设置之后、放置卡牌之前调用
+     * @param cardArea 区域节点（不持有），即卡牌层中该区域的锚点
+     * @param viewport 视口（父节点坐标系）
+     * @param worldSize 区域内容尺寸（关卡桌面尺寸）
+     */
+    void attach(CardArea* cardArea, const Rect& viewport, const Size& worldSize);
+
+    /**
+     * 解除绑定（区域节点销毁前调用），并取消区域的裁剪
+     */
+    void detach();
+
+    /**
+     * 设置视口，保持当前缩放与平移（配置热重载时调用）
+     * @param viewport 视口（父节点坐标系）
+     */
+    void setViewport(const Rect& viewport);
+
+    /**
+     * 获取视口
+     */
+    const Rect& getViewport() const { return _viewport; }
+
+    /**
+     * 设置最大缩放
+     * @param maxZoom 最大缩放，不小于1
+     */
+    void setMaxZoom(float maxZoom);
+
+    /**
+     * 以指定点为中心缩放，该点下的内容保持不动
+     * @param zoom 目标缩放（限制在最小与最大缩放之间）
+     * @param focus 缩放中心（父节点坐标系）
+     */
+    void zoomAt(float zoom, const Vec2& focus);
+
+    /**
+     * 平移镜头（限制在内容范围内）
+     * @param delta 平移量（父节点坐标系）
+     */
+    void panBy(const Vec2& delta);
+
+    /**
+     * 获取当前缩放
+     */
+    float getZoom() const { return _viewportState.getZoom(); }
+
+    /**
+     * 内容是否超出视口（超出时才响应平移与缩放）
+     */
+    bool isInteractive() const { return _viewportState.isInteractive(); }
+
+protected:
+    PlayfieldCamera();
+
+    // 输入事件
+    bool onTouchBegan(Touch* touch, Event* event);
+    void onTouchMoved(Touch* touch, Event* event);
+    void onTouchEnded(Touch* touch, Event* event);
+    void onMouseScroll(EventMouse* event);
+
+private:
+    /**
+     * 跟踪中的触摸点
+     */
+    struct TrackedTouch {
+        int id;                     // 触摸ID
+        Vec2 location;              // 最近位置（父节点坐标系）
+    };
+
+    /**
+     * 把锚点变换应用到卡牌层（与当前变换相同时跳过）
+     * @param force 是否强制应用
+     */
+    void applyTransform(bool force = false);
+
+    /**
+     * 按内容是否超出视口设置或取消区域的裁剪
+     */
+    void updateCullRect();
+
+    /**
+     * 世界坐标转换为父节点坐标
+     */
+    Vec2 toParentSpace(const Vec2& worldLocation) const;
+
+    /**
+     * 查找跟踪中的触摸点
+     * @return 下标，未跟踪时返回-1
+     */
+    int findTouch(int id) const;
+
+    /**
+     * 手势转为平移或缩放后取消卡牌的按下状态，松手时不再触发点击
+     */
+    void cancelCardTouch();
+
+    /**
+     * 镜头及其所有父节点是否可见
+     */
+    bool isVisibleInHierarchy() const;
+
+    static const float kDragThreshold;              // 超过该距离视为拖动而非点击
+    static const float kScrollZoomStep;             // 滚轮每格的缩放倍数
+
+    CardLayer* _cardLayer;                          // 卡牌层（不持有）
+    CardBand _band;                                 // 镜头控制的区域
+    CardArea* _cardArea;                            // 区域节点（不持有），未绑定时为nullptr
+
+    Rect _viewport;                                 // 视口
+    PlayfieldViewport _viewportState;               // 缩放与平移
+
+    EventListenerTouchOneByOne* _touchListener;     // 触摸监听器（不吞没）
+    EventListenerMouse* _mouseListener;             // 鼠标滚轮监听器
+    std::vector<TrackedTouch> _touches;             // 跟踪中的触摸点（最多两个）
+    Vec2 _touchStartLocation;                       // 单指按下位置
+    bool _isPanning;                                // 是否已转为平移或缩放
+};
+
+#endif // __PLAYFIELD_CAMERA_H__
@@ -0,0 +1,130 @@
+#include "ViewReconciler.h"
+
+ViewReconciler::ViewReconciler()
+    : _cardLayer(nullptr)
+    , _isStackDirty(false)
+    , _isCurrentCardDirty(false)
+    , _isAllDirty(false) {
+}
+
+void ViewReconciler::bind(std::shared_ptr<GameModel> gameModel, CardLayer* cardLayer) {
+    unbind();
+
+    _gameModel = gameModel;
+    _cardLayer = cardLayer;
+}
+
+void ViewReconciler::unbind() {
+    _gameModel = nullptr;
+    _cardLayer = nullptr;
+
+    _dirtyCards.clear();
+    _isStackDirty = false;
+    _isCurrentCardDirty = false;
+    _isAllDirty = false;
+}
+
+void ViewReconciler::markCardDirty(CardView* cardView) {
+    if (cardView) {
+        _dirtyCards.insert(cardView);
+    }
+}
+
+bool ViewReconciler::isDirty() const {
+    return !_dirtyCards.empty() || _isStackDirty || _isCurrentCardDirty || _isAllDirty;
+}
+
+ViewReconciler::Stats ViewReconciler::reconcile(CardView* currentCardView, CardViewPool& pool) {
+    Stats stats;
+    if (!_gameModel || !_cardLayer) {
+        return stats;
+    }
+
+    // 先整理底牌区域，移除的视图不再参与后续同步
+    if (_isCurrentCardDirty || _isAllDirty) {
+        reconcileCurrentCardArea(currentCardView, pool, stats);
+    }
+
+    if (_isAllDirty) {
+        reconcileBandDisplay(CardBand::PLAYFIELD, stats);
+        reconcileBandDisplay(CardBand::STACK, stats);
+        reconcileBandDisplay(CardBand::CURRENT, stats);
+    } else {
+        if (_isStackDirty) {
+            reconcileBandDisplay(CardBand::STACK, stats);
+        }
+        for (auto cardView : _dirtyCards) {
+            reconcileDisplay(cardView, stats);
+        }
+    }
+
+    if (_isStackDirty || _isAllDirty) {
+        reconcileStackInteractivity(stats);
+    }
+
+    _dirtyCards.clear();
+    _isStackDirty = false;
+    _isCurrentCardDirty = false;
+    _isAllDirty = false;
+
+    return stats;
+}
+
+void ViewReconciler::reconcileDisplay(CardView* cardView, Stats& stats) {
+    // 动画中的卡牌由动画自行切换（如翻牌在中点切换帧）
+    if (cardView->isAnimating() || !cardView->isDisplayStale()) {
+        return;
+    }
+    cardView->updateDisplay();
+    stats.displayUpdates++;
+}
+
+void ViewReconciler::reconcileBandDisplay(CardBand band, Stats& stats) {
+    _cardLayer->getCardsInBand(band, _bandViews);
+    for (auto cardView : _bandViews) {
+        reconcileDisplay(cardView, stats);
+    }
+    _bandViews.clear();
+}
+
+void ViewReconciler::reconcileStackInteractivity(Stats& stats) {
+    // 只有模型中的栈顶卡牌可以交互
+    auto topCard = _gameModel->getTopStackCard();
+    int topCardId = topCard ? topCard->getCardId() : -1;
+    _cardLayer->getCardsInBand(CardBand::STACK, _bandViews);
+    for (auto cardView : _bandViews) {
+        if (!cardView->getCardModel()) {
+            continue;
+        }
+        bool isTopCard = topCard && cardView->getCardModel()->getCardId() == topCardId;
+        if (cardView->isEnabled() != isTopCard) {
+            cardView->setEnabled(isTopCard);
+            stats.interactivityChanges++;
+        }
+    }
+    _bandViews.clear();
+}
+
+void ViewReconciler::reconcileCurrentCardArea(CardView* currentCardView, CardViewPool& pool, Stats& stats) {
+    // 收集后统一移除，避免遍历子节点时修改子节点列表
+    _cardLayer->getCardsInBand(CardBand::CURRENT, _bandViews);
+    _staleViews.clear();
+    for (auto cardView : _bandViews) {
+        if (cardView != currentCardView) {
+            _staleViews.push_back(cardView);
+        }
+    }
+    _bandViews.clear();
+    for (auto cardView : _staleViews) {
+        _dirtyCards.erase(cardView);
+        pool.release(cardView);
+        stats.removedViews++;
+    }
+    _staleViews.clear();
+
+    // 底牌不可点击
+    if (currentCardView && currentCardView->isEnabled()) {
+        currentCardView->setEnabled(false);
+        stats.interactivityChanges++;
+    }
+}
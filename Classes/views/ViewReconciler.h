@@ -0,0 +1,119 @@
+#ifndef __VIEW_RECONCILER_H__
+#define __VIEW_RECONCILER_H__
+
+#include "cocos2d.h"
+#include "../models/GameModel.h"
+#include "CardView.h"
+#include "CardViewPool.h"
+#include "CardLayer.h"
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+USING_NS_CC;
+
+/**
+ * 视图调和器
+ * 控制器只修改模型并标记哪些卡牌视图需要同步，每帧由GameView调用一次reconcile，
+ * 对比GameModel与视图的当前状态，只对不一致的部分执行节点操作：
+ * - 牌面：模型的牌面/花色/翻开状态与已显示的不同才切换精灵帧（动画中的卡牌跳过）
+ * - 手牌堆交互：只有模型中的栈顶卡牌可点击，状态不同才调用setEnabled
+ * - 底牌区域：移除底牌z段中不是当前底牌的视图并归还对象池，当前底牌不可点击
+ * 各区域的卡牌按CardLayer中的z段查找
+ * 同一帧内的多次标记合并为一次处理，也便于集中统计与性能分析。仅在主线程使用
+ */
+class ViewReconciler {
+public:
+    /**
+     * 单次调和的统计
+     */
+    struct Stats {
+        int displayUpdates;                     // 切换精灵帧的卡牌数
+        int interactivityChanges;               // 交互状态变化的卡牌数
+        int removedViews;                       // 从底牌区域移除的视图数
+
+        Stats() : displayUpdates(0), interactivityChanges(0), removedViews(0) {}
+    };
+
+    ViewReconciler();
+
+    /**
+     * 绑定一局的模型与卡牌层
+     * @param gameModel 游戏数据模型
+     * @param cardLayer 卡牌层（所有卡牌视图的父节点）
+     */
+    void bind(std::shared_ptr<GameModel> gameModel, CardLayer* cardLayer);
+
+    /**
+     * 解除绑定并清除所有标记
+     */
+    void unbind();
+
+    /**
+     * 标记单张卡牌的牌面需要同步
+     * @param cardView 卡牌视图
+     */
+    void markCardDirty(CardView* cardView);
+
+    /**
+     * 标记手牌堆需要同步（牌面与栈顶交互状态）
+     */
+    void markStackDirty() { _isStackDirty = true; }
+
+    /**
+     * 标记底牌区域需要同步
+     */
+    void markCurrentCardDirty() { _isCurrentCardDirty = true; }
+
+    /**
+     * 标记所有区域的卡牌需要同步
+     */
+    void markAllDirty() { _isAllDirty = true; }
+
+    /**
+     * 是否有待同步的标记
+     */
+    bool isDirty() const;
+
+    /**
+     * 执行一次调和并清除标记
+     * @param currentCardView 当前底牌视图（底牌区域中唯一保留的视图）
+     * @param pool 卡牌视图对象池（移除的视图归还到此处）
+     * @return 本次调和的统计
+     */
+    Stats reconcile(CardView* currentCardView, CardViewPool& pool);
+
+private:
+    /**
+     * 同步卡牌牌面
+     */
+    void reconcileDisplay(CardView* cardView, Stats& stats);
+
+    /**
+     * 同步区域内所有卡牌的牌面
+     */
+    void reconcileBandDisplay(CardBand band, Stats& stats);
+
+    /**
+     * 同步手牌堆交互状态
+     */
+    void reconcileStackInteractivity(Stats& stats);
+
+    /**
+     * 同步底牌区域
+     */
+    void reconcileCurrentCardArea(CardView* currentCardView, CardViewPool& pool, Stats& stats);
+
+    std::shared_ptr<GameModel> _gameModel;      // 游戏数据模型
+    CardLayer* _cardLayer;                      // 卡牌层（不持有）
+
+    std::unordered_set<CardView*> _dirtyCards;  // 待同步牌面的卡牌
+    bool _isStackDirty;                         // 手牌堆待同步
+    bool _isCurrentCardDirty;                   // 底牌区域待同步
+    bool _isAllDirty;                           // 所有卡牌待同步
+
+    std::vector<CardView*> _bandViews;          // 区域内的视图（复用，避免每帧分配）
+    std::vector<CardView*> _staleViews;         // 待移除的视图（复用，避免每帧分配）
+};
+
+#endif // __VIEW_RECONCILER_H__
@@ -0,0 +1,61 @@
+#include "CoreTest.h"
+#include "models/CardModel.h"
+#include "external/json/document.h"
+
+CORE_TEST(CardModel_NewCardHasNoId) {
+    CardModel card(CFT_KING, CST_SPADES, Vec2(10.0f, 20.0f));
+
+    // 卡牌ID由引擎上下文分配，模型本身不再生成
+    CORE_EXPECT(card.getCardId() == CardModel::kInvalidCardId);
+    CORE_EXPECT(card.getFace() == CFT_KING);
+    CORE_EXPECT(card.getSuit() == CST_SPADES);
+    CORE_EXPECT(card.getPosition() == Vec2(10.0f, 20.0f));
+}
+
+CORE_TEST(CardModel_JsonRoundTrip) {
+    CardModel card(CFT_THREE, CST_HEARTS, Vec2(250.0f, 1000.0f));
+    card.setCardId(1042);
+    card.setFlipped(true);
+
+    rapidjson::Document document;
+    rapidjson::Value json = card.toJson(document.GetAllocator());
+
+    CardModel restored;
+    restored.fromJson(json);
+    CORE_EXPECT(restored.getCardId() == 1042);
+    CORE_EXPECT(restored.getFace() == CFT_THREE);
+    CORE_EXPECT(restored.getSuit() == CST_HEARTS);
+    CORE_EXPECT(restored.getPosition() == Vec2(250.0f, 1000.0f));
+    CORE_EXPECT(restored.isFlipped());
+}
+
+CORE_TEST(CardModel_FromJsonText) {
+    rapidjson::Document document;
+    document.Parse("{\"CardFace\": 12, \"CardSuit\": 0, \"Position\": {\"x\": 850, \"y\": 600},"
+                   " \"CardId\": 7, \"IsFlipped\": false}");
+    CORE_ASSERT(!document.HasParseError());
+
+    CardModel card;
+    card.fromJson(document);
+    CORE_EXPECT(card.getCardId() == 7);
+    CORE_EXPECT(card.getFace() == CFT_KING);
+    CORE_EXPECT(card.getSuit() == CST_CLUBS);
+    CORE_EXPECT(card.getPosition() == Vec2(850.0f, 600.0f));
+    CORE_EXPECT(!card.isFlipped());
+}
+
+CORE_TEST(CardModel_FromJsonKeepsMissingFields) {
+    CardModel card(CFT_ACE, CST_DIAMONDS, Vec2(1.0f, 2.0f));
+    card.setCardId(5);
+
+    // 缺失或类型不对的字段保留原值
+    rapidjson::Document document;
+    document.Parse("{\"CardFace\": \"K\", \"CardSuit\": 3}");
+    CORE_ASSERT(!document.HasParseError());
+
+    card.fromJson(document);
+    CORE_EXPECT(card.getFace() == CFT_ACE);
+    CORE_EXPECT(card.getSuit() == CST_SPADES);
+    CORE_EXPECT(card.getPosition() == Vec2(1.0f, 2.0f));
+    CORE_EXPECT(card.getCardId() == 5);
+}
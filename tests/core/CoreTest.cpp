@@ -0,0 +1,60 @@
+#include "CoreTest.h"
+#include <chrono>
+#include <cstdio>
+
+int CoreTestRegistry::s_currentFailureCount = 0;
+
+std::vector<CoreTestRegistry::TestCase>& CoreTestRegistry::getTests() {
+    // 函数内静态变量，保证先于各测试文件的注册完成构造
+    static std::vector<TestCase> s_tests;
+    return s_tests;
+}
+
+bool CoreTestRegistry::registerTest(const char* name, TestFunction function) {
+    TestCase testCase;
+    testCase.name = name;
+    testCase.function = function;
+    getTests().push_back(testCase);
+    return true;
+}
+
+void CoreTestRegistry::reportFailure(const char* file, int line, const char* expression) {
+    s_currentFailureCount++;
+    printf("%s:%d: check failed: %s\n", file, line, expression);
+}
+
+int CoreTestRegistry::runAll(const std::string& filter) {
+    int runCount = 0;
+    int failedCount = 0;
+
+    for (const auto& testCase : getTests()) {
+        if (!filter.empty() && std::string(testCase.name).find(filter) == std::string::npos) {
+            continue;
+        }
+
+        printf("[ RUN  ] %s\n", testCase.name);
+        fflush(stdout);
+
+        s_currentFailureCount = 0;
+        auto startTime = std::chrono::steady_clock::now();
+        testCase.function();
+        double durationMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - startTime).count();
+
+        runCount++;
+        if (s_currentFailureCount > 0) {
+            failedCount++;
+            printf("[ FAIL ] %s (%.1f ms)\n", testCase.name, durationMs);
+        } else {
+            printf("[  OK  ] %s (%.1f ms)\n", testCase.name, durationMs);
+        }
+    }
+
+    printf("%d tests, %d passed, %d failed\n", runCount, runCount - failedCount, failedCount);
+    return (runCount == 0) ? 1 : failedCount;
+}
+
+int main(int argc, char** argv) {
+    std::string filter = (argc > 1) ? argv[1] : "";
+    return CoreTestRegistry::runAll(filter) == 0 ? 0 : 1;
+}
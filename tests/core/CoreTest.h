@@ -0,0 +1,73 @@
+#ifndef __CORE_TEST_H__
+#define __CORE_TEST_H__
+
+#include <string>
+#include <vector>
+
+/**
+ * 规则核心单元测试的最小框架（无第三方依赖，可在无界面的Linux上运行）
+ * - CORE_TEST(name) 定义并注册一个测试
+ * - CORE_EXPECT(条件) 失败时记录位置，测试继续执行
+ * - CORE_ASSERT(条件) 失败时记录位置并结束当前测试
+ *
+ * 运行：cardgame_core_tests [名称子串]，只运行名称包含该子串的测试；全部通过时退出码为0
+ */
+class CoreTestRegistry {
+public:
+    typedef void (*TestFunction)();
+
+    /**
+     * 注册测试（由CORE_TEST在静态初始化时调用）
+     * @param name 测试名
+     * @param function 测试函数
+     * @return 总是true，用于初始化静态变量
+     */
+    static bool registerTest(const char* name, TestFunction function);
+
+    /**
+     * 记录一次检查失败
+     * @param file 源文件
+     * @param line 行号
+     * @param expression 失败的表达式
+     */
+    static void reportFailure(const char* file, int line, const char* expression);
+
+    /**
+     * 运行测试
+     * @param filter 名称子串，为空时运行全部
+     * @return 失败的测试数
+     */
+    static int runAll(const std::string& filter);
+
+private:
+    struct TestCase {
+        const char* name;
+        TestFunction function;
+    };
+
+    static std::vector<TestCase>& getTests();
+
+    static int s_currentFailureCount;   // 当前测试的失败次数
+};
+
+#define CORE_TEST(name) \
+    static void coreTest_##name(); \
+    static const bool s_coreTestRegistered_##name = CoreTestRegistry::registerTest(#name, coreTest_##name); \
+    static void coreTest_##name()
+
+#define CORE_EXPECT(condition) \
+    do { \
+        if (!(condition)) { \
+            CoreTestRegistry::reportFailure(__FILE__, __LINE__, #condition); \
+        } \
+    } while (0)
+
+#define CORE_ASSERT(condition) \
+    do { \
+        if (!(condition)) { \
+            CoreTestRegistry::reportFailure(__FILE__, __LINE__, #condition); \
+            return; \
+        } \
+    } while (0)
+
+#endif // __CORE_TEST_H__
@@ -0,0 +1,37 @@
+#ifndef __CORE_TEST_DATA_H__
+#define __CORE_TEST_DATA_H__
+
+#include "configs/models/LevelConfig.h"
+#include "configs/loaders/LevelConfigSaxHandler.h"
+#include <memory>
+#include <string>
+
+// 由CMake传入：仓库中的关卡目录与测试可写目录
+#ifndef CARDGAME_TEST_LEVEL_DIRECTORY
+#define CARDGAME_TEST_LEVEL_DIRECTORY "Resources/configs/data/levels"
+#endif
+#ifndef CARDGAME_TEST_OUTPUT_DIRECTORY
+#define CARDGAME_TEST_OUTPUT_DIRECTORY "."
+#endif
+
+/**
+ * 读取并解析仓库中附带的关卡
+ * @param levelId 关卡ID
+ * @return 关卡配置，失败返回nullptr
+ */
+inline std::shared_ptr<LevelConfig> loadShippedLevel(int levelId) {
+    std::string filePath = std::string(CARDGAME_TEST_LEVEL_DIRECTORY) + "/level_" + std::to_string(levelId) + ".json";
+    std::string content;
+    if (cocos2d::FileUtils::getInstance()->getContents(filePath, &content) != cocos2d::FileUtils::Status::OK) {
+        return nullptr;
+    }
+
+    auto config = std::make_shared<LevelConfig>();
+    std::string errorMessage;
+    if (!LevelConfigSaxHandler::parseInsitu(&content[0], config.get(), errorMessage)) {
+        return nullptr;
+    }
+    return config;
+}
+
+#endif // __CORE_TEST_DATA_H__
@@ -0,0 +1,92 @@
+#include "CoreTest.h"
+#include "CoreTestData.h"
+#include "services/GameModelFromLevelGenerator.h"
+#include "managers/EngineContext.h"
+#include <set>
+
+CORE_TEST(Generator_ShippedLevelMatchesConfig) {
+    auto levelConfig = loadShippedLevel(1);
+    CORE_ASSERT(levelConfig);
+
+    auto engineContext = std::make_shared<EngineContext>(nullptr, 1);
+    auto gameModel = GameModelFromLevelGenerator::generateGameModel(engineContext, levelConfig);
+    CORE_ASSERT(gameModel);
+    CORE_EXPECT(gameModel->getGameState() == GameState::INITIALIZING);
+    CORE_EXPECT(gameModel->getEngineContext() == engineContext);
+
+    const auto& playfieldConfigs = levelConfig->getPlayfieldCards();
+    const auto& stackConfigs = levelConfig->getStackCards();
+    const auto& playfieldCards = gameModel->getPlayfieldCards();
+    const auto& stackCards = gameModel->getStackCards();
+    CORE_ASSERT(playfieldCards.size() == playfieldConfigs.size());
+    CORE_ASSERT(stackCards.size() == stackConfigs.size());
+
+    // 不打乱时顺序、牌面与位置与配置一致
+    for (size_t i = 0; i < playfieldCards.size(); ++i) {
+        CORE_EXPECT(playfieldCards[i]->getFace() == playfieldConfigs[i].cardFace);
+        CORE_EXPECT(playfieldCards[i]->getSuit() == playfieldConfigs[i].cardSuit);
+        CORE_EXPECT(playfieldCards[i]->getPosition() == playfieldConfigs[i].position);
+        CORE_EXPECT(playfieldCards[i]->isFlipped());
+    }
+    for (size_t i = 0; i < stackCards.size(); ++i) {
+        CORE_EXPECT(stackCards[i]->getFace() == stackConfigs[i].cardFace);
+        CORE_EXPECT(stackCards[i]->getSuit() == stackConfigs[i].cardSuit);
+    }
+}
+
+CORE_TEST(Generator_AssignsUniqueIdsFromContext) {
+    auto levelConfig = loadShippedLevel(1);
+    CORE_ASSERT(levelConfig);
+
+    auto engineContext = std::make_shared<EngineContext>(nullptr, 1);
+    int startingCardId = engineContext->getGameRulesConfig()->getStartingCardId();
+    auto gameModel = GameModelFromLevelGenerator::generateGameModel(engineContext, levelConfig);
+    CORE_ASSERT(gameModel);
+
+    std::set<int> cardIds;
+    for (const auto& card : gameModel->getPlayfieldCards()) {
+        cardIds.insert(card->getCardId());
+    }
+    for (const auto& card : gameModel->getStackCards()) {
+        cardIds.insert(card->getCardId());
+    }
+
+    size_t cardCount = gameModel->getPlayfieldCards().size() + gameModel->getStackCards().size();
+    CORE_EXPECT(cardIds.size() == cardCount);
+    CORE_EXPECT(*cardIds.begin() == startingCardId);
+    CORE_EXPECT(*cardIds.rbegin() == startingCardId + static_cast<int>(cardCount) - 1);
+}
+
+CORE_TEST(Generator_ShuffleIsDeterministicPerSeed) {
+    auto levelConfig = loadShippedLevel(1);
+    CORE_ASSERT(levelConfig);
+
+    auto describe = [&](EngineContext::result_type seed) {
+        auto gameModel = GameModelFromLevelGenerator::generateGameModel(
+            std::make_shared<EngineContext>(nullptr, seed), levelConfig, true, true);
+        std::vector<std::string> cards;
+        if (gameModel) {
+            for (const auto& card : gameModel->getPlayfieldCards()) {
+                cards.push_back(card->toString());
+            }
+            for (const auto& card : gameModel->getStackCards()) {
+                cards.push_back(card->toString());
+            }
+        }
+        return cards;
+    };
+
+    auto first = describe(42);
+    CORE_ASSERT(!first.empty());
+    CORE_EXPECT(first == describe(42));
+}
+
+CORE_TEST(Generator_RejectsInvalidArguments) {
+    auto levelConfig = loadShippedLevel(1);
+    CORE_ASSERT(levelConfig);
+
+    auto engineContext = std::make_shared<EngineContext>(nullptr, 1);
+    CORE_EXPECT(!GameModelFromLevelGenerator::generateGameModel(nullptr, levelConfig));
+    CORE_EXPECT(!GameModelFromLevelGenerator::generateGameModel(engineContext, nullptr));
+    CORE_EXPECT(!GameModelFromLevelGenerator::generateGameModel(engineContext, std::make_shared<LevelConfig>()));
+}
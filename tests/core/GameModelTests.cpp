@@ -0,0 +1,89 @@
+#include "CoreTest.h"
+#include "models/GameModel.h"
+#include "managers/EngineContext.h"
+#include "external/json/document.h"
+
+/**
+ * 创建一张已分配ID的卡牌
+ */
+static std::shared_ptr<CardModel> createCard(EngineContext& engineContext, CardFaceType face, CardSuitType suit,
+                                             const Vec2& position = Vec2::ZERO) {
+    auto card = std::make_shared<CardModel>(face, suit, position);
+    card->setCardId(engineContext.allocateCardId());
+    card->setFlipped(true);
+    return card;
+}
+
+CORE_TEST(GameModel_JsonRoundTrip) {
+    auto engineContext = std::make_shared<EngineContext>(nullptr, 1);
+    GameModel gameModel(engineContext);
+    gameModel.addPlayfieldCard(createCard(*engineContext, CFT_KING, CST_CLUBS, Vec2(250.0f, 1000.0f)));
+    gameModel.addPlayfieldCard(createCard(*engineContext, CFT_THREE, CST_HEARTS, Vec2(300.0f, 800.0f)));
+    gameModel.addStackCard(createCard(*engineContext, CFT_FOUR, CST_SPADES));
+    gameModel.setCurrentCard(createCard(*engineContext, CFT_TWO, CST_DIAMONDS));
+    gameModel.setScore(30);
+    gameModel.setMoveCount(4);
+    gameModel.setCurrentLevel(2);
+    gameModel.setGameState(GameState::PLAYING);
+
+    rapidjson::Document document;
+    rapidjson::Value json = gameModel.toJson(document.GetAllocator());
+
+    auto restoredContext = std::make_shared<EngineContext>(nullptr, 1);
+    GameModel restored(restoredContext);
+    restored.fromJson(json);
+
+    CORE_EXPECT(restored.getGameState() == GameState::PLAYING);
+    CORE_EXPECT(restored.getScore() == 30);
+    CORE_EXPECT(restored.getMoveCount() == 4);
+    CORE_EXPECT(restored.getCurrentLevel() == 2);
+
+    CORE_ASSERT(restored.getPlayfieldCards().size() == 2);
+    CORE_ASSERT(restored.getStackCards().size() == 1);
+    CORE_ASSERT(restored.getCurrentCard() != nullptr);
+    for (size_t i = 0; i < 2; i++) {
+        const auto& original = gameModel.getPlayfieldCards()[i];
+        const auto& card = restored.getPlayfieldCards()[i];
+        CORE_EXPECT(card->getCardId() == original->getCardId());
+        CORE_EXPECT(card->getFace() == original->getFace());
+        CORE_EXPECT(card->getSuit() == original->getSuit());
+        CORE_EXPECT(card->getPosition() == original->getPosition());
+    }
+    CORE_EXPECT(restored.getStackCards()[0]->getFace() == CFT_FOUR);
+    CORE_EXPECT(restored.getCurrentCard()->getCardId() == gameModel.getCurrentCard()->getCardId());
+}
+
+CORE_TEST(GameModel_FromJsonReservesCardIds) {
+    rapidjson::Document document;
+    document.Parse("{\"Playfield\": [{\"CardFace\": 1, \"CardSuit\": 0, \"Position\": {\"x\": 0, \"y\": 0},"
+                   " \"CardId\": 5000, \"IsFlipped\": true}],"
+                   " \"Stack\": [{\"CardFace\": 2, \"CardSuit\": 1, \"Position\": {\"x\": 0, \"y\": 0},"
+                   " \"CardId\": 4000, \"IsFlipped\": false}],"
+                   " \"CurrentCard\": {\"CardFace\": 3, \"CardSuit\": 2, \"Position\": {\"x\": 0, \"y\": 0},"
+                   " \"CardId\": 6000, \"IsFlipped\": true}}");
+    CORE_ASSERT(!document.HasParseError());
+
+    auto engineContext = std::make_shared<EngineContext>(nullptr, 1);
+    GameModel gameModel(engineContext);
+    gameModel.fromJson(document);
+
+    // 之后分配的ID不能与读入的ID重复
+    CORE_EXPECT(engineContext->allocateCardId() == 6001);
+    CORE_EXPECT(gameModel.getPlayfieldCard(5000) != nullptr);
+}
+
+CORE_TEST(GameModel_CurrentCardStack) {
+    auto engineContext = std::make_shared<EngineContext>(nullptr, 1);
+    GameModel gameModel(engineContext);
+    auto first = createCard(*engineContext, CFT_TWO, CST_CLUBS);
+    auto second = createCard(*engineContext, CFT_THREE, CST_CLUBS);
+
+    gameModel.pushCurrentCard(first);
+    gameModel.pushCurrentCard(second);
+    CORE_EXPECT(gameModel.getCurrentCard() == second);
+    CORE_EXPECT(gameModel.popCurrentCard() == second);
+    CORE_EXPECT(gameModel.getCurrentCard() == first);
+    CORE_EXPECT(gameModel.popCurrentCard() == first);
+    CORE_EXPECT(gameModel.getCurrentCard() == nullptr);
+    CORE_EXPECT(gameModel.popCurrentCard() == nullptr);
+}
@@ -0,0 +1,107 @@
+#include "CoreTest.h"
+#include "services/GameRulesService.h"
+#include "managers/EngineContext.h"
+
+/**
+ * 创建一张已分配ID、正面朝上的卡牌
+ */
+static std::shared_ptr<CardModel> createCard(EngineContext& engineContext, CardFaceType face, CardSuitType suit) {
+    auto card = std::make_shared<CardModel>(face, suit);
+    card->setCardId(engineContext.allocateCardId());
+    card->setFlipped(true);
+    return card;
+}
+
+CORE_TEST(GameRulesService_CanMatchCyclic) {
+    // 默认规则：点数相差1、A与K循环、忽略花色
+    GameRulesConfig::MatchingRules rules;
+    CORE_EXPECT(GameRulesService::canMatch(CardModel(CFT_TWO, CST_CLUBS), CardModel(CFT_ACE, CST_HEARTS), rules));
+    CORE_EXPECT(GameRulesService::canMatch(CardModel(CFT_ACE, CST_CLUBS), CardModel(CFT_TWO, CST_HEARTS), rules));
+    CORE_EXPECT(GameRulesService::canMatch(CardModel(CFT_ACE, CST_CLUBS), CardModel(CFT_KING, CST_SPADES), rules));
+    CORE_EXPECT(GameRulesService::canMatch(CardModel(CFT_KING, CST_CLUBS), CardModel(CFT_ACE, CST_SPADES), rules));
+    CORE_EXPECT(!GameRulesService::canMatch(CardModel(CFT_THREE, CST_CLUBS), CardModel(CFT_ACE, CST_HEARTS), rules));
+    CORE_EXPECT(!GameRulesService::canMatch(CardModel(CFT_FIVE, CST_CLUBS), CardModel(CFT_FIVE, CST_HEARTS), rules));
+
+    // 差值为2时循环匹配的是A与Q、2与K
+    GameRulesConfig::MatchingRules differenceTwo(true, true, 2);
+    CORE_EXPECT(GameRulesService::canMatch(CardModel(CFT_THREE, CST_CLUBS), CardModel(CFT_ACE, CST_HEARTS), differenceTwo));
+    CORE_EXPECT(GameRulesService::canMatch(CardModel(CFT_ACE, CST_CLUBS), CardModel(CFT_QUEEN, CST_HEARTS), differenceTwo));
+    CORE_EXPECT(GameRulesService::canMatch(CardModel(CFT_TWO, CST_CLUBS), CardModel(CFT_KING, CST_HEARTS), differenceTwo));
+    CORE_EXPECT(!GameRulesService::canMatch(CardModel(CFT_TWO, CST_CLUBS), CardModel(CFT_ACE, CST_HEARTS), differenceTwo));
+}
+
+CORE_TEST(GameRulesService_CanMatchNonCyclic) {
+    GameRulesConfig::MatchingRules rules(false, true, 1);
+    CORE_EXPECT(!GameRulesService::canMatch(CardModel(CFT_ACE, CST_CLUBS), CardModel(CFT_KING, CST_SPADES), rules));
+    CORE_EXPECT(!GameRulesService::canMatch(CardModel(CFT_KING, CST_CLUBS), CardModel(CFT_ACE, CST_SPADES), rules));
+    CORE_EXPECT(GameRulesService::canMatch(CardModel(CFT_QUEEN, CST_CLUBS), CardModel(CFT_KING, CST_SPADES), rules));
+    CORE_EXPECT(GameRulesService::canMatch(CardModel(CFT_TWO, CST_CLUBS), CardModel(CFT_ACE, CST_SPADES), rules));
+}
+
+CORE_TEST(GameRulesService_CanMatchRequiresSuit) {
+    GameRulesConfig::MatchingRules rules(true, false, 1);
+    CORE_EXPECT(GameRulesService::canMatch(CardModel(CFT_TWO, CST_HEARTS), CardModel(CFT_ACE, CST_HEARTS), rules));
+    CORE_EXPECT(GameRulesService::canMatch(CardModel(CFT_ACE, CST_SPADES), CardModel(CFT_KING, CST_SPADES), rules));
+    CORE_EXPECT(!GameRulesService::canMatch(CardModel(CFT_TWO, CST_CLUBS), CardModel(CFT_ACE, CST_HEARTS), rules));
+    CORE_EXPECT(!GameRulesService::canMatch(CardModel(CFT_ACE, CST_CLUBS), CardModel(CFT_KING, CST_SPADES), rules));
+}
+
+CORE_TEST(GameRulesService_PlayfieldMoveResults) {
+    auto engineContext = std::make_shared<EngineContext>(nullptr, 1);
+    GameModel gameModel(engineContext);
+    auto two = createCard(*engineContext, CFT_TWO, CST_CLUBS);
+    auto five = createCard(*engineContext, CFT_FIVE, CST_CLUBS);
+    auto faceDown = createCard(*engineContext, CFT_TWO, CST_HEARTS);
+    faceDown->setFlipped(false);
+    gameModel.addPlayfieldCard(two);
+    gameModel.addPlayfieldCard(five);
+    gameModel.addPlayfieldCard(faceDown);
+    GameRulesConfig::MatchingRules rules;
+
+    CORE_EXPECT(GameRulesService::checkPlayfieldMove(gameModel, two->getCardId(), rules) ==
+                GameRulesService::MOVE_NO_CURRENT_CARD);
+
+    gameModel.pushCurrentCard(createCard(*engineContext, CFT_ACE, CST_SPADES));
+    CORE_EXPECT(GameRulesService::checkPlayfieldMove(gameModel, five->getCardId(), rules) ==
+                GameRulesService::MOVE_NOT_MATCHABLE);
+    CORE_EXPECT(GameRulesService::checkPlayfieldMove(gameModel, faceDown->getCardId(), rules) ==
+                GameRulesService::MOVE_CARD_FACE_DOWN);
+    CORE_EXPECT(GameRulesService::checkPlayfieldMove(gameModel, -1, rules) ==
+                GameRulesService::MOVE_CARD_NOT_IN_PLAYFIELD);
+
+    // 不合法时模型不变
+    CORE_EXPECT(GameRulesService::applyPlayfieldMove(gameModel, five->getCardId(), rules) ==
+                GameRulesService::MOVE_NOT_MATCHABLE);
+    CORE_EXPECT(gameModel.getPlayfieldCards().size() == 3);
+
+    // 合法时压入底牌栈并从桌面移除，不能再打第二次
+    CORE_EXPECT(GameRulesService::applyPlayfieldMove(gameModel, two->getCardId(), rules) == GameRulesService::MOVE_OK);
+    CORE_EXPECT(gameModel.getCurrentCard() == two);
+    CORE_EXPECT(gameModel.getPlayfieldCards().size() == 2);
+    CORE_EXPECT(GameRulesService::applyPlayfieldMove(gameModel, two->getCardId(), rules) ==
+                GameRulesService::MOVE_CARD_NOT_IN_PLAYFIELD);
+}
+
+CORE_TEST(GameRulesService_StackDrawAndInitialDeal) {
+    auto engineContext = std::make_shared<EngineContext>(nullptr, 1);
+    GameModel gameModel(engineContext);
+    auto bottom = createCard(*engineContext, CFT_NINE, CST_CLUBS);
+    auto top = createCard(*engineContext, CFT_ACE, CST_HEARTS);
+    bottom->setFlipped(false);
+    gameModel.addStackCard(bottom);
+    gameModel.addStackCard(top);
+
+    // 开局发手牌堆顶的牌，已有底牌时不再发
+    CORE_EXPECT(GameRulesService::dealInitialCard(gameModel));
+    CORE_EXPECT(gameModel.getCurrentCard() == top);
+    CORE_EXPECT(!GameRulesService::dealInitialCard(gameModel));
+
+    CORE_EXPECT(GameRulesService::revealNextStackCard(gameModel) == bottom);
+    CORE_EXPECT(bottom->isFlipped());
+    CORE_EXPECT(!GameRulesService::revealNextStackCard(gameModel));
+
+    CORE_EXPECT(GameRulesService::applyStackDraw(gameModel) == GameRulesService::MOVE_OK);
+    CORE_EXPECT(gameModel.getCurrentCard() == bottom);
+    CORE_EXPECT(GameRulesService::applyStackDraw(gameModel) == GameRulesService::MOVE_STACK_EMPTY);
+    CORE_EXPECT(std::string(GameRulesService::getMoveResultName(GameRulesService::MOVE_STACK_EMPTY)) == "stack-empty");
+}
@@ -0,0 +1,74 @@
+#include "CoreTest.h"
+#include "CoreTestData.h"
+#include "configs/loaders/LevelConfigCache.h"
+
+/**
+ * 创建一个与附带关卡内容相同、ID不同的关卡配置
+ */
+static std::shared_ptr<LevelConfig> createLevel(int levelId) {
+    auto config = loadShippedLevel(1);
+    if (config) {
+        config->setLevelId(levelId);
+    }
+    return config;
+}
+
+/**
+ * 能容纳count个附带关卡的预算（条目开销留有余量）
+ */
+static size_t budgetForLevels(int count) {
+    auto config = loadShippedLevel(1);
+    return config ? (config->getMemoryFootprint() + 128) * count : 0;
+}
+
+CORE_TEST(LevelConfigCache_InsertEvictsLeastRecentlyUsed) {
+    LevelConfigCache cache(budgetForLevels(2));
+    CORE_ASSERT(cache.insert(1, createLevel(1)));
+    CORE_ASSERT(cache.insert(2, createLevel(2)));
+    CORE_EXPECT(cache.get(1));
+
+    CORE_ASSERT(cache.insert(3, createLevel(3)));
+    CORE_EXPECT(cache.peek(1));
+    CORE_EXPECT(!cache.peek(2));
+    CORE_EXPECT(cache.peek(3));
+    CORE_EXPECT(cache.getStats().evictionCount == 1);
+}
+
+CORE_TEST(LevelConfigCache_InsertIfFitsDoesNotEvict) {
+    LevelConfigCache cache(budgetForLevels(2));
+    CORE_ASSERT(cache.insert(1, createLevel(1)));
+    CORE_EXPECT(cache.insertIfFits(2, createLevel(2)));
+
+    // 预算已满：不写入，也不淘汰已有关卡
+    CORE_EXPECT(!cache.insertIfFits(3, createLevel(3)));
+    CORE_EXPECT(cache.getLevelIds() == std::vector<int>({1, 2}));
+    CORE_EXPECT(cache.getStats().evictionCount == 0);
+
+    // 已存在的关卡返回旧对象
+    auto existing = cache.peek(1);
+    CORE_EXPECT(cache.insertIfFits(1, createLevel(1)) == existing);
+}
+
+CORE_TEST(LevelConfigCache_InsertIfFitsAllowsPinnedLevels) {
+    LevelConfigCache cache(budgetForLevels(1));
+    CORE_ASSERT(cache.insert(1, createLevel(1)));
+
+    cache.pin(2);
+    CORE_EXPECT(cache.insertIfFits(2, createLevel(2)));
+    CORE_EXPECT(cache.getEntryCount() == 2);
+    cache.unpin(2);
+}
+
+CORE_TEST(LevelConfigCache_PreloadedLevelsAreEvictedFirst) {
+    LevelConfigCache cache(budgetForLevels(2));
+    CORE_ASSERT(cache.insertIfFits(1, createLevel(1)));
+    CORE_ASSERT(cache.insertIfFits(2, createLevel(2)));
+
+    CORE_ASSERT(cache.get(1));
+
+    // 正常加载的关卡需要空间时，先淘汰未被使用过的预加载关卡
+    CORE_ASSERT(cache.insert(3, createLevel(3)));
+    CORE_EXPECT(cache.peek(1));
+    CORE_EXPECT(!cache.peek(2));
+    CORE_EXPECT(cache.peek(3));
+}
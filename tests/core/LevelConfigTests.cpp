@@ -0,0 +1,90 @@
+#include "CoreTest.h"
+#include "configs/loaders/LevelConfigSaxHandler.h"
+
+/**
+ * 解析关卡JSON文本并返回内容哈希
+ * @param json JSON文本
+ * @return 内容哈希，解析失败返回0
+ */
+static uint64_t hashLevelJson(std::string json) {
+    LevelConfig config;
+    std::string errorMessage;
+    if (!LevelConfigSaxHandler::parseInsitu(&json[0], &config, errorMessage)) {
+        return 0;
+    }
+    return config.computeContentHash();
+}
+
+/**
+ * 创建测试关卡，id与名称由调用方指定
+ */
+static LevelConfig createLevel(int levelId, const std::string& levelName) {
+    LevelConfig config;
+    config.setLevelId(levelId);
+    config.setLevelName(levelName);
+    config.addPlayfieldCard(CardConfigData(CFT_KING, CST_SPADES, Vec2(250.0f, 1000.0f)));
+    config.addPlayfieldCard(CardConfigData(CFT_TWO, CST_HEARTS, Vec2(0.0f, 800.0f)));
+    config.addStackCard(CardConfigData(CFT_ACE, CST_CLUBS, Vec2::ZERO));
+    return config;
+}
+
+CORE_TEST(LevelConfig_ContentHashIgnoresFormattingAndKeyOrder) {
+    uint64_t compact = hashLevelJson(
+        "{\"LevelId\":1,\"LevelName\":\"A\","
+        "\"Playfield\":[{\"CardFace\":12,\"CardSuit\":3,\"Position\":{\"x\":250,\"y\":1000}}],"
+        "\"Stack\":[{\"CardFace\":0,\"CardSuit\":0,\"Position\":{\"x\":0,\"y\":0}}]}");
+    uint64_t reordered = hashLevelJson(
+        "{\n"
+        "    \"Stack\": [ { \"Position\": { \"y\": 0, \"x\": 0 }, \"CardSuit\": 0, \"CardFace\": 0 } ],\n"
+        "    \"Playfield\": [\n"
+        "        { \"Position\": { \"y\": 1000.0, \"x\": 250.0 }, \"CardSuit\": 3, \"CardFace\": 12 }\n"
+        "    ],\n"
+        "    \"LevelName\": \"A\",\n"
+        "    \"LevelId\": 1\n"
+        "}\n");
+    CORE_ASSERT(compact != 0);
+    CORE_EXPECT(compact == reordered);
+
+    // 内容变化时哈希随之变化
+    uint64_t moved = hashLevelJson(
+        "{\"LevelId\":1,\"LevelName\":\"A\","
+        "\"Playfield\":[{\"CardFace\":12,\"CardSuit\":3,\"Position\":{\"x\":251,\"y\":1000}}],"
+        "\"Stack\":[{\"CardFace\":0,\"CardSuit\":0,\"Position\":{\"x\":0,\"y\":0}}]}");
+    CORE_EXPECT(moved != 0 && moved != compact);
+}
+
+CORE_TEST(LevelConfig_ContentHashFoldsSignedZero) {
+    LevelConfig positiveZero = createLevel(1, "Level 1");
+    LevelConfig negativeZero;
+    negativeZero.addPlayfieldCard(CardConfigData(CFT_KING, CST_SPADES, Vec2(250.0f, 1000.0f)));
+    negativeZero.addPlayfieldCard(CardConfigData(CFT_TWO, CST_HEARTS, Vec2(-0.0f, 800.0f)));
+    negativeZero.addStackCard(CardConfigData(CFT_ACE, CST_CLUBS, Vec2::ZERO));
+    CORE_EXPECT(positiveZero.computeContentHash() == negativeZero.computeContentHash());
+
+    // JSON中的-0同样折叠为0
+    uint64_t positive = hashLevelJson(
+        "{\"Playfield\":[{\"CardFace\":1,\"CardSuit\":2,\"Position\":{\"x\":0,\"y\":800}}],\"Stack\":[]}");
+    uint64_t negative = hashLevelJson(
+        "{\"Playfield\":[{\"CardFace\":1,\"CardSuit\":2,\"Position\":{\"x\":-0.0,\"y\":800}}],\"Stack\":[]}");
+    CORE_ASSERT(positive != 0);
+    CORE_EXPECT(positive == negative);
+}
+
+CORE_TEST(LevelConfig_ContentHashExcludesIdAndName) {
+    LevelConfig first = createLevel(1, "Level 1");
+    LevelConfig second = createLevel(42, "Another name");
+    CORE_EXPECT(first.computeContentHash() == second.computeContentHash());
+
+    // 手牌堆顺序计入哈希
+    LevelConfig reordered = createLevel(1, "Level 1");
+    reordered.addStackCard(CardConfigData(CFT_FIVE, CST_DIAMONDS, Vec2::ZERO));
+    LevelConfig swapped;
+    swapped.addPlayfieldCard(CardConfigData(CFT_KING, CST_SPADES, Vec2(250.0f, 1000.0f)));
+    swapped.addPlayfieldCard(CardConfigData(CFT_TWO, CST_HEARTS, Vec2(0.0f, 800.0f)));
+    swapped.addStackCard(CardConfigData(CFT_FIVE, CST_DIAMONDS, Vec2::ZERO));
+    swapped.addStackCard(CardConfigData(CFT_ACE, CST_CLUBS, Vec2::ZERO));
+    CORE_EXPECT(reordered.computeContentHash() != swapped.computeContentHash());
+
+    first.updateContentHash();
+    CORE_EXPECT(first.getContentHash() == second.computeContentHash());
+}
@@ -0,0 +1,61 @@
+#include "CoreTest.h"
+#include "CoreTestData.h"
+#include "configs/loaders/LevelFileUtils.h"
+#include <cstdio>
+
+CORE_TEST(LevelFileUtils_ParseLevelIdFromFileName) {
+    CORE_EXPECT(LevelFileUtils::parseLevelIdFromFileName("level_1.json") == 1);
+    CORE_EXPECT(LevelFileUtils::parseLevelIdFromFileName("configs/data/levels/level_42.json") == 42);
+    CORE_EXPECT(LevelFileUtils::parseLevelIdFromFileName("index.json") == -1);
+    CORE_EXPECT(LevelFileUtils::parseLevelIdFromFileName("level_.json") == -1);
+    CORE_EXPECT(LevelFileUtils::parseLevelIdFromFileName("level_1a.json") == -1);
+    CORE_EXPECT(LevelFileUtils::parseLevelIdFromFileName("level_1.json.bak") == -1);
+    CORE_EXPECT(LevelFileUtils::parseLevelIdFromFileName("levels/") == -1);
+}
+
+CORE_TEST(LevelFileUtils_EnumeratesShippedDirectory) {
+    std::string directory = CARDGAME_TEST_LEVEL_DIRECTORY;
+    auto levelFiles = LevelFileUtils::enumerateLevelFiles(directory);
+    CORE_ASSERT(levelFiles.size() >= 2);
+    CORE_EXPECT(levelFiles[0].first == 1);
+    CORE_EXPECT(levelFiles[0].second == directory + "/level_1.json");
+    for (size_t i = 1; i < levelFiles.size(); ++i) {
+        CORE_EXPECT(levelFiles[i - 1].first < levelFiles[i].first);
+    }
+
+    // 目录参数末尾有无'/'结果相同
+    CORE_EXPECT(LevelFileUtils::enumerateLevelFiles(directory + "/") == levelFiles);
+    CORE_EXPECT(LevelFileUtils::enumerateLevelFiles(directory + "/missing").empty());
+}
+
+CORE_TEST(LevelFileUtils_PrefersLevelIndex) {
+    std::string directory = CARDGAME_TEST_OUTPUT_DIRECTORY;
+    std::string indexPath = directory + "/" + LevelFileUtils::kLevelIndexFileName;
+    FILE* file = fopen(indexPath.c_str(), "wb");
+    CORE_ASSERT(file != nullptr);
+    fputs("{\"Levels\": [3, 1, 3, -2, \"x\"]}", file);
+    fclose(file);
+
+    // 索引中的无效ID被跳过，结果按ID排序去重
+    auto levelFiles = LevelFileUtils::enumerateLevelFiles(directory);
+    remove(indexPath.c_str());
+
+    CORE_ASSERT(levelFiles.size() == 2);
+    CORE_EXPECT(levelFiles[0].first == 1);
+    CORE_EXPECT(levelFiles[0].second == directory + "/level_1.json");
+    CORE_EXPECT(levelFiles[1].first == 3);
+    CORE_EXPECT(levelFiles[1].second == directory + "/level_3.json");
+}
+
+CORE_TEST(LevelFileUtils_ReadFileReportsErrors) {
+    std::string content;
+    std::string errorMessage;
+    CORE_EXPECT(LevelFileUtils::readFile(std::string(CARDGAME_TEST_LEVEL_DIRECTORY) + "/level_1.json",
+                                         content, errorMessage));
+    CORE_EXPECT(!content.empty());
+
+    // 目录不能当作关卡文件读取
+    CORE_EXPECT(!LevelFileUtils::readFile(CARDGAME_TEST_LEVEL_DIRECTORY, content, errorMessage));
+    CORE_EXPECT(content.empty());
+    CORE_EXPECT(errorMessage == LevelFileUtils::getStatusMessage(FileUtils::Status::NotExists));
+}
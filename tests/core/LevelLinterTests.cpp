@@ -0,0 +1,121 @@
+#include "CoreTest.h"
+#include "services/LevelLinter.h"
+
+/**
+ * 创建没有问题的测试关卡
+ */
+static LevelConfig createLevel() {
+    LevelConfig config;
+    config.setPlayfieldSize(Size(1080.0f, 1500.0f));
+    config.addPlayfieldCard(CardConfigData(CFT_KING, CST_SPADES, Vec2(250.0f, 1000.0f)));
+    config.addPlayfieldCard(CardConfigData(CFT_TWO, CST_HEARTS, Vec2(500.0f, 800.0f)));
+    config.addStackCard(CardConfigData(CFT_ACE, CST_CLUBS, Vec2::ZERO));
+    return config;
+}
+
+/**
+ * 统计指定规则的问题数
+ */
+static int countIssues(const std::vector<LevelLinter::Issue>& issues, const std::string& rule) {
+    int count = 0;
+    for (const auto& issue : issues) {
+        if (issue.rule == rule) {
+            count++;
+        }
+    }
+    return count;
+}
+
+CORE_TEST(LevelLinter_CleanLevel) {
+    std::vector<LevelLinter::Issue> issues = LevelLinter::lint(createLevel());
+    CORE_EXPECT(issues.empty());
+    CORE_EXPECT(!LevelLinter::hasErrors(issues));
+}
+
+CORE_TEST(LevelLinter_InvalidCard) {
+    LevelConfig config = createLevel();
+    config.addPlayfieldCard(CardConfigData(CFT_NONE, CST_HEARTS, Vec2(750.0f, 600.0f)));
+    config.addStackCard(CardConfigData(CFT_QUEEN, CST_NUM_CARD_SUIT_TYPES, Vec2::ZERO));
+
+    std::vector<LevelLinter::Issue> issues = LevelLinter::lint(config);
+    CORE_ASSERT(issues.size() == 2);
+    CORE_EXPECT(issues[0].rule == "invalid-card" && issues[0].location == "Playfield[2]");
+    CORE_EXPECT(issues[1].rule == "invalid-card" && issues[1].location == "Stack[1]");
+    CORE_EXPECT(issues[0].severity == LevelLinter::SEVERITY_ERROR);
+    CORE_EXPECT(LevelLinter::hasErrors(issues));
+}
+
+CORE_TEST(LevelLinter_OutOfBounds) {
+    LevelConfig config = createLevel();
+    config.addPlayfieldCard(CardConfigData(CFT_FIVE, CST_CLUBS, Vec2(-1.0f, 600.0f)));
+    config.addPlayfieldCard(CardConfigData(CFT_SIX, CST_CLUBS, Vec2(600.0f, 1501.0f)));
+    // 恰好在边界上不算越界
+    config.addPlayfieldCard(CardConfigData(CFT_SEVEN, CST_CLUBS, Vec2(1080.0f, 1500.0f)));
+
+    std::vector<LevelLinter::Issue> issues = LevelLinter::lint(config);
+    CORE_ASSERT(issues.size() == 2);
+    CORE_EXPECT(issues[0].rule == "out-of-bounds" && issues[0].location == "Playfield[2]");
+    CORE_EXPECT(issues[1].rule == "out-of-bounds" && issues[1].location == "Playfield[3]");
+}
+
+CORE_TEST(LevelLinter_OverlappingPosition) {
+    LevelConfig config = createLevel();
+    config.addPlayfieldCard(CardConfigData(CFT_FIVE, CST_CLUBS, Vec2(250.5f, 1000.0f)));
+    config.addPlayfieldCard(CardConfigData(CFT_SIX, CST_CLUBS, Vec2(500.0f, 810.0f)));
+
+    std::vector<LevelLinter::Issue> issues = LevelLinter::lint(config);
+    CORE_ASSERT(issues.size() == 1);
+    CORE_EXPECT(issues[0].rule == "overlapping-position");
+    CORE_EXPECT(issues[0].location == "Playfield[2]");
+    CORE_EXPECT(issues[0].message.find("Playfield[0]") != std::string::npos);
+
+    // 放宽判定距离后第二张也算重合
+    LevelLinter::Options options;
+    options.overlapTolerance = 10.0f;
+    CORE_EXPECT(countIssues(LevelLinter::lint(config, options), "overlapping-position") == 2);
+}
+
+CORE_TEST(LevelLinter_DuplicateCard) {
+    LevelConfig config = createLevel();
+    config.addPlayfieldCard(CardConfigData(CFT_KING, CST_SPADES, Vec2(750.0f, 600.0f)));
+    config.addStackCard(CardConfigData(CFT_KING, CST_SPADES, Vec2::ZERO));
+
+    // 默认一副牌：第二、三张各报一次
+    std::vector<LevelLinter::Issue> issues = LevelLinter::lint(config);
+    CORE_ASSERT(issues.size() == 2);
+    CORE_EXPECT(issues[0].rule == "duplicate-card" && issues[0].location == "Playfield[2]");
+    CORE_EXPECT(issues[1].rule == "duplicate-card" && issues[1].location == "Stack[1]");
+    CORE_EXPECT(issues[1].message == "K of Spades appears 3 times (first at Playfield[0]), limit is 1");
+
+    LevelLinter::Options options;
+    options.maxDecks = 2;
+    issues = LevelLinter::lint(config, options);
+    CORE_ASSERT(issues.size() == 1);
+    CORE_EXPECT(issues[0].location == "Stack[1]");
+
+    options.maxDecks = 3;
+    CORE_EXPECT(LevelLinter::lint(config, options).empty());
+}
+
+CORE_TEST(LevelLinter_EmptyArea) {
+    // 备用牌堆为空只是警告
+    LevelConfig noStack;
+    noStack.setPlayfieldSize(Size(1080.0f, 1500.0f));
+    noStack.addPlayfieldCard(CardConfigData(CFT_KING, CST_SPADES, Vec2(250.0f, 1000.0f)));
+    std::vector<LevelLinter::Issue> issues = LevelLinter::lint(noStack);
+    CORE_ASSERT(issues.size() == 1);
+    CORE_EXPECT(issues[0].rule == "empty-area");
+    CORE_EXPECT(issues[0].severity == LevelLinter::SEVERITY_WARNING);
+    CORE_EXPECT(!LevelLinter::hasErrors(issues));
+
+    // 桌面为空是错误
+    LevelConfig noPlayfield;
+    noPlayfield.addStackCard(CardConfigData(CFT_ACE, CST_CLUBS, Vec2::ZERO));
+    issues = LevelLinter::lint(noPlayfield);
+    CORE_ASSERT(issues.size() == 1);
+    CORE_EXPECT(issues[0].rule == "empty-area");
+    CORE_EXPECT(issues[0].severity == LevelLinter::SEVERITY_ERROR);
+    CORE_EXPECT(issues[0].location.empty());
+
+    CORE_EXPECT(countIssues(LevelLinter::lint(LevelConfig()), "empty-area") == 2);
+}
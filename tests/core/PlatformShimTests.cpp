@@ -0,0 +1,100 @@
+#include "CoreTest.h"
+#include "CoreTestData.h"
+#include "utils/PlatformShim.h"
+#include <algorithm>
+#include <cstdio>
+
+USING_NS_CC;
+
+CORE_TEST(PlatformShim_Vec2Arithmetic) {
+    Vec2 a(3.0f, 4.0f);
+    Vec2 b(1.0f, 2.0f);
+
+    CORE_EXPECT(a + b == Vec2(4.0f, 6.0f));
+    CORE_EXPECT(a - b == Vec2(2.0f, 2.0f));
+    CORE_EXPECT(a * 2.0f == Vec2(6.0f, 8.0f));
+    CORE_EXPECT(a != b);
+    CORE_EXPECT(Vec2() == Vec2::ZERO);
+    CORE_EXPECT(a.distanceSquared(Vec2::ZERO) == 25.0f);
+    CORE_EXPECT(a.distance(Vec2::ZERO) == 5.0f);
+}
+
+CORE_TEST(PlatformShim_SizeEquality) {
+    Size size(1080.0f, 1500.0f);
+
+    CORE_EXPECT(size.equals(Size(1080.0f, 1500.0f)));
+    CORE_EXPECT(size == Size(1080.0f, 1500.0f));
+    CORE_EXPECT(size != Size(1080.0f, 580.0f));
+    CORE_EXPECT(Size() == Size::ZERO);
+}
+
+CORE_TEST(PlatformShim_StringFormat) {
+    CORE_EXPECT(StringUtils::format("level_%d.json", 42) == "level_42.json");
+    CORE_EXPECT(StringUtils::format("%s", "") == "");
+
+    // 超过栈上常见缓冲区长度的结果也完整返回
+    std::string longText(1000, 'x');
+    CORE_EXPECT(StringUtils::format("%s!", longText.c_str()).size() == 1001);
+}
+
+CORE_TEST(PlatformShim_FileUtilsReadsFiles) {
+    auto fileUtils = FileUtils::getInstance();
+    std::string levelPath = std::string(CARDGAME_TEST_LEVEL_DIRECTORY) + "/level_1.json";
+
+    CORE_EXPECT(fileUtils->isFileExist(levelPath));
+    CORE_EXPECT(!fileUtils->isFileExist(CARDGAME_TEST_LEVEL_DIRECTORY));
+    CORE_EXPECT(fileUtils->isDirectoryExist(CARDGAME_TEST_LEVEL_DIRECTORY));
+    CORE_EXPECT(fileUtils->fullPathForFilename(levelPath) == levelPath);
+    CORE_EXPECT(fileUtils->fullPathForFilename(levelPath + ".missing").empty());
+
+    std::string content;
+    CORE_ASSERT(fileUtils->getContents(levelPath, &content) == FileUtils::Status::OK);
+    CORE_EXPECT(content.find("\"LevelId\"") != std::string::npos);
+    CORE_EXPECT(fileUtils->getStringFromFile(levelPath) == content);
+}
+
+CORE_TEST(PlatformShim_FileUtilsReportsErrors) {
+    auto fileUtils = FileUtils::getInstance();
+    std::string content = "stale";
+
+    // 目录与不存在的文件都不能当作文件读取
+    CORE_EXPECT(fileUtils->getContents(CARDGAME_TEST_LEVEL_DIRECTORY, &content) == FileUtils::Status::NotExists);
+    CORE_EXPECT(fileUtils->getContents(std::string(CARDGAME_TEST_OUTPUT_DIRECTORY) + "/missing.json", &content) ==
+                FileUtils::Status::NotExists);
+    CORE_EXPECT(fileUtils->getContents("", &content) == FileUtils::Status::NotExists);
+    CORE_EXPECT(fileUtils->getContents(CARDGAME_TEST_LEVEL_DIRECTORY, nullptr) == FileUtils::Status::NotInitialized);
+    CORE_EXPECT(fileUtils->getStringFromFile(CARDGAME_TEST_LEVEL_DIRECTORY).empty());
+}
+
+CORE_TEST(PlatformShim_FileUtilsReadsEmptyFile) {
+    std::string filePath = std::string(CARDGAME_TEST_OUTPUT_DIRECTORY) + "/platform_shim_empty.json";
+    FILE* file = fopen(filePath.c_str(), "wb");
+    CORE_ASSERT(file != nullptr);
+    fclose(file);
+
+    std::string content = "stale";
+    CORE_EXPECT(FileUtils::getInstance()->getContents(filePath, &content) == FileUtils::Status::OK);
+    CORE_EXPECT(content.empty());
+    remove(filePath.c_str());
+}
+
+CORE_TEST(PlatformShim_FileUtilsListsFiles) {
+    auto fileUtils = FileUtils::getInstance();
+    std::string directory = CARDGAME_TEST_LEVEL_DIRECTORY;
+
+    // 与引擎一致：返回完整路径；目录参数末尾有无'/'结果相同
+    std::vector<std::string> files = fileUtils->listFiles(directory);
+    std::vector<std::string> filesWithSlash = fileUtils->listFiles(directory + "/");
+    std::sort(files.begin(), files.end());
+    std::sort(filesWithSlash.begin(), filesWithSlash.end());
+
+    CORE_EXPECT(files == filesWithSlash);
+    CORE_EXPECT(std::find(files.begin(), files.end(), directory + "/level_1.json") != files.end());
+    for (const auto& path : files) {
+        CORE_EXPECT(path.compare(0, directory.size() + 1, directory + "/") == 0);
+        CORE_EXPECT(path != directory + "/./" && path != directory + "/../");
+    }
+
+    CORE_EXPECT(fileUtils->listFiles(directory + "/level_1.json").empty());
+    CORE_EXPECT(fileUtils->listFiles(directory + "/missing").empty());
+}
@@ -0,0 +1,95 @@
+#include "CoreTest.h"
+#include "utils/PlayfieldViewport.h"
+#include <cmath>
+
+static bool isNear(float a, float b) {
+    return std::fabs(a - b) < 0.01f;
+}
+
+static bool isNear(const Vec2& a, const Vec2& b) {
+    return isNear(a.x, b.x) && isNear(a.y, b.y);
+}
+
+/**
+ * 1080x1500的视口，原点在(0, 580)，与默认的桌面区域一致
+ */
+static PlayfieldViewport createViewport(const Size& worldSize, float maxZoom = 2.0f) {
+    PlayfieldViewport viewport;
+    viewport.reset(Vec2(0.0f, 580.0f), Size(1080.0f, 1500.0f), worldSize);
+    viewport.setMaxZoom(maxZoom);
+    return viewport;
+}
+
+CORE_TEST(PlayfieldViewport_NormalLevelKeepsFixedLayout) {
+    PlayfieldViewport viewport = createViewport(Size(1080.0f, 1500.0f));
+    CORE_EXPECT(!viewport.isInteractive());
+    CORE_EXPECT(viewport.getZoom() == 1.0f);
+    CORE_EXPECT(viewport.getContentOrigin() == Vec2(0.0f, 580.0f));
+
+    // 不超过视口的内容不响应平移与缩放
+    viewport.panBy(Vec2(-200.0f, 300.0f));
+    viewport.zoomAt(2.0f, Vec2(540.0f, 1330.0f));
+    CORE_EXPECT(viewport.getZoom() == 1.0f);
+    CORE_EXPECT(viewport.getContentOrigin() == Vec2(0.0f, 580.0f));
+}
+
+CORE_TEST(PlayfieldViewport_MegaLevelStartsFullyVisible) {
+    // 高度为视口两倍：缩放到0.5后整体可见，宽度方向居中
+    PlayfieldViewport viewport = createViewport(Size(1080.0f, 3000.0f));
+    CORE_EXPECT(viewport.isInteractive());
+    CORE_EXPECT(isNear(viewport.getMinZoom(), 0.5f));
+    CORE_EXPECT(isNear(viewport.getZoom(), 0.5f));
+    CORE_EXPECT(isNear(viewport.getContentOrigin(), Vec2(270.0f, 580.0f)));
+}
+
+CORE_TEST(PlayfieldViewport_ZoomKeepsFocusFixed) {
+    PlayfieldViewport viewport = createViewport(Size(2160.0f, 3000.0f));
+    Vec2 focus(400.0f, 1000.0f);
+    Vec2 focusInContent = viewport.toContentSpace(focus);
+
+    viewport.zoomAt(1.0f, focus);
+    CORE_EXPECT(isNear(viewport.getZoom(), 1.0f));
+    CORE_EXPECT(isNear(viewport.toContentSpace(focus), focusInContent));
+
+    // 超出最大缩放时限制在最大缩放
+    viewport.zoomAt(10.0f, focus);
+    CORE_EXPECT(isNear(viewport.getZoom(), 2.0f));
+    CORE_EXPECT(isNear(viewport.toContentSpace(focus), focusInContent));
+
+    // 降低最大缩放时以视口中心缩小
+    Vec2 center(540.0f, 1330.0f);
+    Vec2 centerInContent = viewport.toContentSpace(center);
+    viewport.setMaxZoom(1.5f);
+    CORE_EXPECT(isNear(viewport.getZoom(), 1.5f));
+    CORE_EXPECT(isNear(viewport.toContentSpace(center), centerInContent));
+}
+
+CORE_TEST(PlayfieldViewport_PanStopsAtContentEdges) {
+    PlayfieldViewport viewport = createViewport(Size(2160.0f, 3000.0f));
+    viewport.zoomAt(1.0f, Vec2(0.0f, 580.0f));
+
+    // 不能把内容左下角拖进视口
+    viewport.panBy(Vec2(500.0f, 500.0f));
+    CORE_EXPECT(isNear(viewport.getContentOrigin(), Vec2(0.0f, 580.0f)));
+
+    // 不能把内容右上角拖进视口
+    viewport.panBy(Vec2(-5000.0f, -5000.0f));
+    CORE_EXPECT(isNear(viewport.getContentOrigin(), Vec2(1080.0f - 2160.0f, 580.0f + 1500.0f - 3000.0f)));
+    CORE_EXPECT(isNear(viewport.toContentSpace(Vec2(1080.0f, 2080.0f)), Vec2(2160.0f, 3000.0f)));
+}
+
+CORE_TEST(PlayfieldViewport_ResizeKeepsZoomAboveMinimum) {
+    PlayfieldViewport viewport = createViewport(Size(2160.0f, 3000.0f));
+    CORE_EXPECT(isNear(viewport.getZoom(), 0.5f));
+
+    // 视口变小后最小缩放降低，当前缩放保持
+    viewport.setViewport(Vec2(0.0f, 580.0f), Size(540.0f, 750.0f));
+    CORE_EXPECT(isNear(viewport.getMinZoom(), 0.25f));
+    CORE_EXPECT(isNear(viewport.getZoom(), 0.5f));
+
+    // 视口放大到容纳全部内容后不再可交互，回到固定布局
+    viewport.setViewport(Vec2(0.0f, 580.0f), Size(2160.0f, 3000.0f));
+    CORE_EXPECT(!viewport.isInteractive());
+    CORE_EXPECT(viewport.getZoom() == 1.0f);
+    CORE_EXPECT(viewport.getContentOrigin() == Vec2(0.0f, 580.0f));
+}
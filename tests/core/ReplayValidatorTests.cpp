@@ -0,0 +1,117 @@
+#include "CoreTest.h"
+#include "services/ReplayValidator.h"
+
+/**
+ * 测试关卡：桌面 [0]梅花2 [1]红桃3 [2]黑桃K，手牌堆自底向上 红桃Q、方块A（开局发A为底牌）
+ * 按默认规则的一种解法为"p0p1sp2"
+ */
+static std::shared_ptr<LevelConfig> createLevel() {
+    auto levelConfig = std::make_shared<LevelConfig>();
+    levelConfig->setLevelId(1);
+    levelConfig->addPlayfieldCard(CardConfigData(CFT_TWO, CST_CLUBS, Vec2(200.0f, 1000.0f)));
+    levelConfig->addPlayfieldCard(CardConfigData(CFT_THREE, CST_HEARTS, Vec2(500.0f, 1000.0f)));
+    levelConfig->addPlayfieldCard(CardConfigData(CFT_KING, CST_SPADES, Vec2(800.0f, 1000.0f)));
+    levelConfig->addStackCard(CardConfigData(CFT_QUEEN, CST_HEARTS, Vec2::ZERO));
+    levelConfig->addStackCard(CardConfigData(CFT_ACE, CST_DIAMONDS, Vec2::ZERO));
+    return levelConfig;
+}
+
+/**
+ * 解析并校验出牌序列
+ */
+static ReplayValidator::Result validate(const std::string& text) {
+    std::vector<ReplayValidator::Move> moves;
+    std::string errorMessage;
+    if (!ReplayValidator::parseMoves(text, moves, errorMessage)) {
+        return ReplayValidator::Result();
+    }
+    return ReplayValidator::validate(std::make_shared<EngineContext>(nullptr, 1), createLevel(), moves);
+}
+
+CORE_TEST(ReplayValidator_ParseMoves) {
+    std::vector<ReplayValidator::Move> moves;
+    std::string errorMessage;
+    CORE_ASSERT(ReplayValidator::parseMoves("p3p12s", moves, errorMessage));
+    CORE_ASSERT(moves.size() == 3);
+    CORE_EXPECT(moves[0].type == ReplayValidator::Move::PLAYFIELD && moves[0].playfieldIndex == 3);
+    CORE_EXPECT(moves[1].type == ReplayValidator::Move::PLAYFIELD && moves[1].playfieldIndex == 12);
+    CORE_EXPECT(moves[2].type == ReplayValidator::Move::STACK);
+
+    CORE_EXPECT(ReplayValidator::parseMoves("", moves, errorMessage));
+    CORE_EXPECT(moves.empty());
+}
+
+CORE_TEST(ReplayValidator_ParseMovesErrors) {
+    std::vector<ReplayValidator::Move> moves;
+    std::string errorMessage;
+
+    // 'p'后缺少下标
+    CORE_EXPECT(!ReplayValidator::parseMoves("p1sp", moves, errorMessage));
+    CORE_EXPECT(errorMessage == "Missing card index at offset 4");
+    CORE_EXPECT(!ReplayValidator::parseMoves("ps", moves, errorMessage));
+    CORE_EXPECT(errorMessage == "Missing card index at offset 1");
+
+    // 下标超出int范围
+    CORE_EXPECT(!ReplayValidator::parseMoves("p0p2147483648", moves, errorMessage));
+    CORE_EXPECT(errorMessage == "Card index too large at offset 3");
+    CORE_EXPECT(ReplayValidator::parseMoves("p2147483647", moves, errorMessage));
+
+    // 无法识别的字符
+    CORE_EXPECT(!ReplayValidator::parseMoves("p1x", moves, errorMessage));
+    CORE_EXPECT(errorMessage == "Unexpected 'x' at offset 2");
+    CORE_EXPECT(!ReplayValidator::parseMoves("-1", moves, errorMessage));
+    CORE_EXPECT(errorMessage == "Unexpected '-' at offset 0");
+}
+
+CORE_TEST(ReplayValidator_AcceptsSolve) {
+    ReplayValidator::Result result = validate("p0p1sp2");
+    CORE_EXPECT(result.isAccepted);
+    CORE_EXPECT(result.failedMoveIndex == -1);
+    CORE_EXPECT(result.reason.empty());
+}
+
+CORE_TEST(ReplayValidator_RejectsIllegalMove) {
+    // 红桃3不能打在方块A上
+    ReplayValidator::Result result = validate("p1p0sp2");
+    CORE_EXPECT(!result.isAccepted);
+    CORE_EXPECT(result.failedMoveIndex == 0);
+    CORE_EXPECT(result.reason == "not-matchable");
+
+    // 已打出的牌不能再打
+    result = validate("p0p0");
+    CORE_EXPECT(result.failedMoveIndex == 1);
+    CORE_EXPECT(result.reason == "card-not-in-playfield");
+
+    // 手牌堆翻完后不能再翻
+    result = validate("ss");
+    CORE_EXPECT(result.failedMoveIndex == 1);
+    CORE_EXPECT(result.reason == "stack-empty");
+}
+
+CORE_TEST(ReplayValidator_RejectsOutOfRangeIndex) {
+    ReplayValidator::Result result = validate("p0p3");
+    CORE_EXPECT(!result.isAccepted);
+    CORE_EXPECT(result.failedMoveIndex == 1);
+    CORE_EXPECT(result.reason == "card-index-out-of-range");
+}
+
+CORE_TEST(ReplayValidator_RejectsUnclearedLevel) {
+    // 每步都合法，但桌面还剩黑桃K
+    ReplayValidator::Result result = validate("p0p1s");
+    CORE_EXPECT(!result.isAccepted);
+    CORE_EXPECT(result.failedMoveIndex == 3);
+    CORE_EXPECT(result.reason == "level-not-cleared");
+
+    result = validate("");
+    CORE_EXPECT(result.failedMoveIndex == 0);
+    CORE_EXPECT(result.reason == "level-not-cleared");
+}
+
+CORE_TEST(ReplayValidator_RejectsInvalidLevel) {
+    std::vector<ReplayValidator::Move> moves;
+    ReplayValidator::Result result = ReplayValidator::validate(std::make_shared<EngineContext>(nullptr, 1),
+                                                               std::make_shared<LevelConfig>(), moves);
+    CORE_EXPECT(!result.isAccepted);
+    CORE_EXPECT(result.failedMoveIndex == -1);
+    CORE_EXPECT(result.reason == "invalid-level");
+}
@@ -0,0 +1,166 @@
+#include "CoreTest.h"
+#include "utils/SnapshotPublisher.h"
+#include "configs/models/GameRulesConfig.h"
+#include "external/json/document.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * 测试用快照：每代一份规则配置，统计存活的快照数
+ */
+struct RulesSnapshot {
+    static std::atomic<int> s_liveCount;
+
+    uint64_t generation;
+    std::shared_ptr<const GameRulesConfig> gameRulesConfig;
+
+    RulesSnapshot() : generation(0) { s_liveCount++; }
+    ~RulesSnapshot() { s_liveCount--; }
+};
+
+std::atomic<int> RulesSnapshot::s_liveCount(0);
+
+/**
+ * 按代数生成规则配置（模拟一次热重载）：撤销步数与起始卡牌ID都由代数决定，读者据此校验快照是否完整
+ */
+static std::shared_ptr<const RulesSnapshot> createSnapshot(uint64_t generation) {
+    std::string json = "{\"UndoSettings\":{\"MaxUndoSteps\":" + std::to_string(generation % 101) +
+                       ",\"EnableUndo\":true},\"CardGeneration\":{\"StartingCardId\":" +
+                       std::to_string(1000 + generation) + "}}";
+    rapidjson::Document document;
+    document.Parse(json.c_str());
+
+    auto config = std::make_shared<GameRulesConfig>();
+    if (document.HasParseError() || !config->fromJson(document)) {
+        return nullptr;
+    }
+
+    auto snapshot = std::make_shared<RulesSnapshot>();
+    snapshot->generation = generation;
+    snapshot->gameRulesConfig = config;
+    return snapshot;
+}
+
+CORE_TEST(SnapshotPublisher_EmptyUntilPublished) {
+    SnapshotPublisher<RulesSnapshot> publisher;
+    CORE_EXPECT(!publisher.load());
+
+    auto snapshot = createSnapshot(1);
+    CORE_ASSERT(snapshot);
+    publisher.publish(snapshot);
+    CORE_EXPECT(publisher.load() == snapshot);
+}
+
+CORE_TEST(SnapshotPublisher_ReleasesReplacedSnapshots) {
+    int liveBefore = RulesSnapshot::s_liveCount.load();
+    {
+        SnapshotPublisher<RulesSnapshot> publisher;
+        std::weak_ptr<const RulesSnapshot> first;
+        {
+            auto snapshot = createSnapshot(1);
+            CORE_ASSERT(snapshot);
+            first = snapshot;
+            publisher.publish(snapshot);
+        }
+
+        // 读者持有的旧快照在发布新快照后仍然有效
+        auto held = publisher.load();
+        for (uint64_t generation = 2; generation <= 100; ++generation) {
+            publisher.publish(createSnapshot(generation));
+        }
+        CORE_EXPECT(held->generation == 1);
+        CORE_EXPECT(!first.expired());
+
+        // 最后一个持有者释放后销毁，只保留当前快照
+        held.reset();
+        CORE_EXPECT(first.expired());
+        CORE_EXPECT(RulesSnapshot::s_liveCount.load() == liveBefore + 1);
+    }
+    CORE_EXPECT(RulesSnapshot::s_liveCount.load() == liveBefore);
+}
+
+CORE_TEST(SnapshotPublisher_ConcurrentReadersDuringReloads) {
+    const int kReaderCount = 8;
+    const uint64_t kReloadCount = 5000;
+    int liveBefore = RulesSnapshot::s_liveCount.load();
+
+    SnapshotPublisher<RulesSnapshot> publisher;
+    publisher.publish(createSnapshot(1));
+
+    std::atomic<bool> isReloading(true);
+    std::atomic<int> inconsistentCount(0);
+    std::atomic<uint64_t> readCount(0);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < kReaderCount; ++i) {
+        readers.push_back(std::thread([&]() {
+            uint64_t lastGeneration = 0;
+            uint64_t localReads = 0;
+            do {
+                auto snapshot = publisher.load();
+                const GameRulesConfig& rules = *snapshot->gameRulesConfig;
+                // 快照内容必须完整属于同一代，且代数不回退
+                if (snapshot->generation < lastGeneration ||
+                    rules.getMaxUndoSteps() != static_cast<int>(snapshot->generation % 101) ||
+                    rules.getStartingCardId() != static_cast<int>(1000 + snapshot->generation)) {
+                    inconsistentCount++;
+                }
+                lastGeneration = snapshot->generation;
+                localReads++;
+            } while (isReloading.load());
+            readCount += localReads;
+        }));
+    }
+
+    for (uint64_t generation = 2; generation <= kReloadCount; ++generation) {
+        publisher.publish(createSnapshot(generation));
+    }
+    isReloading.store(false);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    CORE_EXPECT(inconsistentCount.load() == 0);
+    CORE_EXPECT(readCount.load() >= static_cast<uint64_t>(kReaderCount));
+    CORE_EXPECT(publisher.load()->generation == kReloadCount);
+
+    // 反复发布不累积：读者退出后只剩当前快照
+    CORE_EXPECT(RulesSnapshot::s_liveCount.load() == liveBefore + 1);
+}
+
+CORE_TEST(SnapshotPublisher_MoreReadersThanHazardSlots) {
+    // 读者多于危险指针槽位时轮流占用槽位，仍然只读到完整的快照
+    const int kReaderCount = 48;
+    const int kReadsPerReader = 20000;
+
+    SnapshotPublisher<RulesSnapshot> publisher;
+    publisher.publish(createSnapshot(1));
+
+    std::atomic<int> runningCount(kReaderCount);
+    std::atomic<int> inconsistentCount(0);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < kReaderCount; ++i) {
+        readers.push_back(std::thread([&]() {
+            for (int read = 0; read < kReadsPerReader; ++read) {
+                auto snapshot = publisher.load();
+                if (snapshot->gameRulesConfig->getStartingCardId() != static_cast<int>(1000 + snapshot->generation)) {
+                    inconsistentCount++;
+                }
+            }
+            runningCount--;
+        }));
+    }
+
+    // 读者全部结束前持续发布
+    uint64_t generation = 1;
+    while (runningCount.load() > 0) {
+        publisher.publish(createSnapshot(++generation));
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    CORE_EXPECT(inconsistentCount.load() == 0);
+    CORE_EXPECT(publisher.load()->generation == generation);
+}
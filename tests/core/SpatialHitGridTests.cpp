@@ -0,0 +1,97 @@
+#include "CoreTest.h"
+#include "utils/SpatialHitGrid.h"
+#include <algorithm>
+
+/**
+ * 测试用的卡牌：只有ID
+ */
+struct GridCard {
+    int cardId;
+};
+
+typedef SpatialHitGrid<GridCard> CardGrid;
+
+static CardGrid::Bounds makeBounds(float x, float y, float width, float height) {
+    CardGrid::Bounds bounds = {x, y, x + width, y + height};
+    return bounds;
+}
+
+static bool hasCandidate(const CardGrid& grid, float x, float y, const GridCard& card) {
+    const auto& candidates = grid.getCandidates(x, y);
+    return std::find(candidates.begin(), candidates.end(), &card) != candidates.end();
+}
+
+CORE_TEST(SpatialHitGrid_CandidatesCoverCardBounds) {
+    CardGrid grid;
+    grid.reset(1000.0f, 1000.0f, 100.0f, 100.0f);
+
+    GridCard card = {1};
+    CORE_EXPECT(grid.update(&card, makeBounds(150.0f, 150.0f, 100.0f, 100.0f)));
+    CORE_EXPECT(grid.size() == 1);
+
+    // 跨越的四个格子都能查到，其它格子查不到
+    CORE_EXPECT(hasCandidate(grid, 160.0f, 160.0f, card));
+    CORE_EXPECT(hasCandidate(grid, 240.0f, 160.0f, card));
+    CORE_EXPECT(hasCandidate(grid, 160.0f, 240.0f, card));
+    CORE_EXPECT(hasCandidate(grid, 240.0f, 240.0f, card));
+    CORE_EXPECT(!hasCandidate(grid, 50.0f, 50.0f, card));
+    CORE_EXPECT(!hasCandidate(grid, 350.0f, 160.0f, card));
+}
+
+CORE_TEST(SpatialHitGrid_UpdateMovesBetweenCells) {
+    CardGrid grid;
+    grid.reset(1000.0f, 1000.0f, 100.0f, 100.0f);
+
+    GridCard card = {1};
+    grid.update(&card, makeBounds(10.0f, 10.0f, 50.0f, 50.0f));
+
+    // 仍在原格子内移动不改动索引
+    CORE_EXPECT(!grid.update(&card, makeBounds(20.0f, 20.0f, 50.0f, 50.0f)));
+
+    CORE_EXPECT(grid.update(&card, makeBounds(510.0f, 710.0f, 50.0f, 50.0f)));
+    CORE_EXPECT(!hasCandidate(grid, 30.0f, 30.0f, card));
+    CORE_EXPECT(hasCandidate(grid, 530.0f, 730.0f, card));
+    CORE_EXPECT(grid.size() == 1);
+}
+
+CORE_TEST(SpatialHitGrid_RemoveAndReset) {
+    CardGrid grid;
+    grid.reset(1000.0f, 1000.0f, 100.0f, 100.0f);
+
+    GridCard first = {1};
+    GridCard second = {2};
+    grid.update(&first, makeBounds(10.0f, 10.0f, 50.0f, 50.0f));
+    grid.update(&second, makeBounds(20.0f, 20.0f, 50.0f, 50.0f));
+
+    // 同一格子中按登记先后排列
+    const auto& candidates = grid.getCandidates(30.0f, 30.0f);
+    CORE_ASSERT(candidates.size() == 2);
+    CORE_EXPECT(candidates[0] == &first);
+    CORE_EXPECT(candidates[1] == &second);
+
+    CORE_EXPECT(grid.remove(&first));
+    CORE_EXPECT(!grid.remove(&first));
+    CORE_EXPECT(!grid.contains(&first));
+    CORE_EXPECT(grid.getCandidates(30.0f, 30.0f).size() == 1);
+
+    grid.reset(500.0f, 500.0f, 50.0f, 50.0f);
+    CORE_EXPECT(grid.size() == 0);
+    CORE_EXPECT(grid.getCandidates(30.0f, 30.0f).empty());
+}
+
+CORE_TEST(SpatialHitGrid_OutOfAreaClampsToEdgeCells) {
+    CardGrid grid;
+    grid.reset(300.0f, 300.0f, 100.0f, 100.0f);
+
+    // 部分或完全超出区域的卡牌归入边缘格子，区域外的点查询边缘格子
+    GridCard card = {1};
+    grid.update(&card, makeBounds(-80.0f, 250.0f, 100.0f, 100.0f));
+    CORE_EXPECT(hasCandidate(grid, 10.0f, 290.0f, card));
+    CORE_EXPECT(hasCandidate(grid, -50.0f, 320.0f, card));
+    CORE_EXPECT(!hasCandidate(grid, 150.0f, 290.0f, card));
+
+    // 格子尺寸无效时按1x1处理
+    grid.reset(30.0f, 30.0f, 0.0f, 0.0f);
+    grid.update(&card, makeBounds(10.0f, 10.0f, 5.0f, 5.0f));
+    CORE_EXPECT(hasCandidate(grid, 12.0f, 12.0f, card));
+}
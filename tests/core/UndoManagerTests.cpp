@@ -0,0 +1,164 @@
+#include "CoreTest.h"
+#include "managers/UndoManager.h"
+#include "managers/EngineContext.h"
+#include "services/GameRulesService.h"
+#include "models/UndoModel.h"
+#include "external/json/document.h"
+
+/**
+ * 创建一张已分配ID、正面朝上的卡牌
+ */
+static std::shared_ptr<CardModel> createCard(EngineContext& engineContext, CardFaceType face, CardSuitType suit,
+                                             const Vec2& position = Vec2::ZERO) {
+    auto card = std::make_shared<CardModel>(face, suit, position);
+    card->setCardId(engineContext.allocateCardId());
+    card->setFlipped(true);
+    return card;
+}
+
+/**
+ * 从JSON文本创建规则配置
+ */
+static std::shared_ptr<const GameRulesConfig> createRulesConfig(const char* jsonText) {
+    rapidjson::Document document;
+    document.Parse(jsonText);
+    if (document.HasParseError()) {
+        return nullptr;
+    }
+
+    auto config = std::make_shared<GameRulesConfig>();
+    if (!config->fromJson(document)) {
+        return nullptr;
+    }
+    return config;
+}
+
+/**
+ * 桌面一张4、底牌一张3的对局
+ */
+struct UndoFixture {
+    std::shared_ptr<EngineContext> engineContext;
+    std::shared_ptr<GameModel> gameModel;
+    std::shared_ptr<CardModel> playfieldCard;
+    std::shared_ptr<CardModel> stackCard;
+    std::shared_ptr<CardModel> initialCard;
+
+    explicit UndoFixture(std::shared_ptr<const GameRulesConfig> rulesConfig = nullptr)
+        : engineContext(std::make_shared<EngineContext>(rulesConfig, 1))
+        , gameModel(std::make_shared<GameModel>(engineContext)) {
+        playfieldCard = createCard(*engineContext, CFT_FOUR, CST_CLUBS, Vec2(300.0f, 900.0f));
+        stackCard = createCard(*engineContext, CFT_KING, CST_SPADES);
+        initialCard = createCard(*engineContext, CFT_THREE, CST_DIAMONDS);
+        gameModel->addPlayfieldCard(playfieldCard);
+        gameModel->addStackCard(stackCard);
+        gameModel->pushCurrentCard(initialCard);
+    }
+};
+
+CORE_TEST(UndoManager_InitRejectsMissingArguments) {
+    auto engineContext = std::make_shared<EngineContext>(nullptr, 1);
+    auto gameModel = std::make_shared<GameModel>(engineContext);
+
+    UndoManager undoManager;
+    CORE_EXPECT(!undoManager.init(nullptr, engineContext));
+    CORE_EXPECT(!undoManager.init(gameModel, nullptr));
+    CORE_EXPECT(!undoManager.canUndo());
+    CORE_EXPECT(!undoManager.recordUndo(UndoModel::createStackToCurrentAction(
+        createCard(*engineContext, CFT_ACE, CST_CLUBS), createCard(*engineContext, CFT_TWO, CST_CLUBS),
+        Vec2::ZERO, Vec2::ZERO)));
+}
+
+CORE_TEST(UndoManager_UndoPlayfieldMove) {
+    UndoFixture fixture;
+    UndoManager undoManager;
+    CORE_ASSERT(undoManager.init(fixture.gameModel, fixture.engineContext));
+
+    auto rules = fixture.engineContext->getGameRulesConfig()->getMatchingRules();
+    CORE_ASSERT(GameRulesService::applyPlayfieldMove(*fixture.gameModel, fixture.playfieldCard->getCardId(), rules)
+                == GameRulesService::MOVE_OK);
+    CORE_ASSERT(undoManager.recordUndo(UndoModel::createPlayfieldToCurrentAction(
+        fixture.playfieldCard, fixture.initialCard,
+        fixture.playfieldCard->getPosition(), Vec2::ZERO)));
+    CORE_EXPECT(fixture.gameModel->getPlayfieldCards().empty());
+    CORE_EXPECT(fixture.gameModel->getCurrentCard() == fixture.playfieldCard);
+    CORE_EXPECT(undoManager.getUndoCount() == 1);
+
+    bool callbackInvoked = false;
+    bool undone = undoManager.performUndo([&](bool success, std::shared_ptr<UndoModel> undoModel) {
+        callbackInvoked = true;
+        CORE_EXPECT(success);
+        CORE_EXPECT(undoModel && undoModel->getSourceCard() == fixture.playfieldCard);
+    });
+
+    CORE_EXPECT(undone);
+    CORE_EXPECT(callbackInvoked);
+    CORE_EXPECT(fixture.gameModel->getCurrentCard() == fixture.initialCard);
+    CORE_EXPECT(fixture.gameModel->getPlayfieldCard(fixture.playfieldCard->getCardId()) == fixture.playfieldCard);
+    CORE_EXPECT(fixture.gameModel->getCurrentCardStack().size() == 1);
+    CORE_EXPECT(!undoManager.canUndo());
+}
+
+CORE_TEST(UndoManager_UndoStackDraw) {
+    UndoFixture fixture;
+    UndoManager undoManager;
+    CORE_ASSERT(undoManager.init(fixture.gameModel, fixture.engineContext));
+
+    CORE_ASSERT(GameRulesService::applyStackDraw(*fixture.gameModel) == GameRulesService::MOVE_OK);
+    CORE_ASSERT(undoManager.recordUndo(UndoModel::createStackToCurrentAction(
+        fixture.stackCard, fixture.initialCard, Vec2::ZERO, Vec2::ZERO)));
+    CORE_EXPECT(fixture.gameModel->isStackEmpty());
+    CORE_EXPECT(fixture.gameModel->getCurrentCard() == fixture.stackCard);
+
+    CORE_EXPECT(undoManager.performUndo());
+    CORE_EXPECT(fixture.gameModel->getCurrentCard() == fixture.initialCard);
+    CORE_EXPECT(fixture.gameModel->getTopStackCard() == fixture.stackCard);
+}
+
+CORE_TEST(UndoManager_EmptyUndoInvokesCallback) {
+    UndoFixture fixture;
+    UndoManager undoManager;
+    CORE_ASSERT(undoManager.init(fixture.gameModel, fixture.engineContext));
+
+    bool callbackInvoked = false;
+    bool undone = undoManager.performUndo([&](bool success, std::shared_ptr<UndoModel> undoModel) {
+        callbackInvoked = true;
+        CORE_EXPECT(!success);
+        CORE_EXPECT(!undoModel);
+    });
+    CORE_EXPECT(!undone);
+    CORE_EXPECT(callbackInvoked);
+}
+
+CORE_TEST(UndoManager_MaxStepsFromRulesConfig) {
+    auto rulesConfig = createRulesConfig("{\"UndoSettings\":{\"MaxUndoSteps\":2,\"EnableUndo\":true}}");
+    CORE_ASSERT(rulesConfig);
+
+    UndoFixture fixture(rulesConfig);
+    UndoManager undoManager;
+    CORE_ASSERT(undoManager.init(fixture.gameModel, fixture.engineContext));
+    CORE_EXPECT(undoManager.getMaxUndoSteps() == 2);
+
+    for (int i = 0; i < 4; ++i) {
+        CORE_EXPECT(undoManager.recordUndo(UndoModel::createStackToCurrentAction(
+            createCard(*fixture.engineContext, CFT_FIVE, CST_HEARTS), fixture.initialCard,
+            Vec2::ZERO, Vec2::ZERO)));
+    }
+    CORE_EXPECT(undoManager.getUndoCount() == 2);
+
+    undoManager.setMaxUndoSteps(1);
+    CORE_EXPECT(undoManager.getUndoCount() == 1);
+
+    // 非法步数被忽略
+    undoManager.setMaxUndoSteps(0);
+    CORE_EXPECT(undoManager.getMaxUndoSteps() == 1);
+}
+
+CORE_TEST(UndoManager_DisabledByRulesConfig) {
+    auto rulesConfig = createRulesConfig("{\"UndoSettings\":{\"MaxUndoSteps\":5,\"EnableUndo\":false}}");
+    CORE_ASSERT(rulesConfig);
+
+    UndoFixture fixture(rulesConfig);
+    UndoManager undoManager;
+    CORE_ASSERT(undoManager.init(fixture.gameModel, fixture.engineContext));
+    CORE_EXPECT(undoManager.getMaxUndoSteps() == 0);
+}
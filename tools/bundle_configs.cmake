@@ -0,0 +1,122 @@
+# 合并配置文件为单个配置包，或生成内嵌默认配置的头文件（cmake -P 脚本模式运行）
+#
+# 用法：
+#   cmake -DCONFIG_ROOT=<Resources目录> -DBUNDLE_OUTPUT=<输出文件> -P tools/bundle_configs.cmake
+#   cmake -DCONFIG_ROOT=<Resources目录> -DBUNDLE_OUTPUT=<输出头文件> -DMODE=header -P tools/bundle_configs.cmake
+#
+# 配置包格式（MODE=bundle，默认；与 ConfigManager::loadConfigBundle 对应）：
+#   CFGBUNDLE 1
+#   <段名> <字节数>        每段一行，顺序即数据区顺序
+#   END
+#   <段数据>\n             各段JSON原样拼接，每段后跟一个换行符
+#
+# 运行时一次读入整个文件，把每段后的换行符改写为'\0'即可就地解析，无需再复制
+#
+# 头文件格式（MODE=header；与 ConfigManager::loadEmbeddedConfigs 对应）：
+#   每段生成一个constexpr字符数组；桌面平台运行时把磁盘上的文件与之逐字节比较，
+#   内容不同（修改后尚未重新构建）时改用磁盘上的文件
+
+if(NOT CONFIG_ROOT OR NOT BUNDLE_OUTPUT)
+    message(FATAL_ERROR "bundle_configs: CONFIG_ROOT and BUNDLE_OUTPUT are required")
+endif()
+
+if(NOT MODE)
+    set(MODE "bundle")
+endif()
+if(NOT MODE STREQUAL "bundle" AND NOT MODE STREQUAL "header")
+    message(FATAL_ERROR "bundle_configs: unknown MODE ${MODE}")
+endif()
+
+# 段名与路径须与 ConfigManager 中的常量保持一致
+set(CONFIG_SECTIONS
+    "ui_layout=configs/data/ui/layout_config.json"
+    "animation=configs/data/ui/animation_config.json"
+    "font=configs/data/ui/font_config.json"
+    "game_rules=configs/data/game/rules_config.json"
+    "card_layout=configs/data/game/card_layout_config.json"
+    "display=configs/data/display/display_config.json"
+    )
+
+set(BUNDLE_HEADER "CFGBUNDLE 1\n")
+set(BUNDLE_PAYLOAD "")
+set(EMBED_ARRAYS "")
+set(EMBED_TABLE "")
+
+foreach(section ${CONFIG_SECTIONS})
+    string(REPLACE "=" ";" section_parts "${section}")
+    list(GET section_parts 0 section_name)
+    list(GET section_parts 1 section_path)
+    set(section_file "${CONFIG_ROOT}/${section_path}")
+
+    if(NOT EXISTS "${section_file}")
+        message(FATAL_ERROR "bundle_configs: missing config file ${section_file}")
+    endif()
+
+    file(READ "${section_file}" section_content)
+    string(LENGTH "${section_content}" section_length)
+    if(section_length EQUAL 0)
+        message(FATAL_ERROR "bundle_configs: empty config file ${section_file}")
+    endif()
+
+    # 预校验：string(JSON) 需要 CMake 3.19+
+    if(NOT CMAKE_VERSION VERSION_LESS 3.19)
+        string(JSON section_type ERROR_VARIABLE section_error TYPE "${section_content}")
+        if(section_error)
+            message(FATAL_ERROR "bundle_configs: invalid JSON in ${section_file}: ${section_error}")
+        endif()
+        if(NOT section_type STREQUAL "OBJECT")
+            message(FATAL_ERROR "bundle_configs: root of ${section_file} is not an object")
+        endif()
+    else()
+        message(WARNING "bundle_configs: CMake ${CMAKE_VERSION} < 3.19, JSON validation skipped for ${section_path}")
+    endif()
+
+    string(APPEND BUNDLE_HEADER "${section_name} ${section_length}\n")
+    string(APPEND BUNDLE_PAYLOAD "${section_content}\n")
+
+    if(MODE STREQUAL "header")
+        string(FIND "${section_content}" ")cfgjson\"" delimiter_position)
+        if(NOT delimiter_position EQUAL -1)
+            message(FATAL_ERROR "bundle_configs: ${section_file} contains the raw string delimiter")
+        endif()
+
+        string(APPEND EMBED_ARRAYS "static constexpr char kEmbeddedConfig_${section_name}[] = R\"cfgjson(${section_content})cfgjson\";\n\n")
+        string(APPEND EMBED_TABLE "    { \"${section_name}\", \"${section_path}\", kEmbeddedConfig_${section_name}, sizeof(kEmbeddedConfig_${section_name}) - 1 },\n")
+    endif()
+endforeach()
+
+string(APPEND BUNDLE_HEADER "END\n")
+
+if(MODE STREQUAL "header")
+    set(OUTPUT_CONTENT
+"// 由 tools/bundle_configs.cmake 生成，请勿手动修改
+#ifndef __EMBEDDED_CONFIG_DATA_H__
+#define __EMBEDDED_CONFIG_DATA_H__
+
+#include <cstddef>
+
+/**
+ * 内嵌的默认配置段
+ */
+struct EmbeddedConfigSection {
+    const char* name;           // 段名
+    const char* path;           // 源文件路径（相对于Resources目录）
+    const char* json;           // JSON内容
+    size_t length;              // JSON字节数
+};
+
+${EMBED_ARRAYS}static constexpr EmbeddedConfigSection kEmbeddedConfigSections[] = {
+${EMBED_TABLE}};
+
+static constexpr size_t kEmbeddedConfigSectionCount = sizeof(kEmbeddedConfigSections) / sizeof(kEmbeddedConfigSections[0]);
+
+#endif // __EMBEDDED_CONFIG_DATA_H__
+")
+else()
+    set(OUTPUT_CONTENT "${BUNDLE_HEADER}${BUNDLE_PAYLOAD}")
+endif()
+
+# 先写临时文件再重命名，避免中断时留下半个输出文件
+file(WRITE "${BUNDLE_OUTPUT}.tmp" "${OUTPUT_CONTENT}")
+file(RENAME "${BUNDLE_OUTPUT}.tmp" "${BUNDLE_OUTPUT}")
+message(STATUS "bundle_configs: wrote ${BUNDLE_OUTPUT}")
@@ -0,0 +1,290 @@
+/**
+ * 多对局引擎基准
+ * 在一个进程中同时创建N局游戏（默认10000），每局各自持有引擎上下文与游戏模型，
+ * 分配到线程池的各个线程上交替推进，直到每局都清空桌面或无牌可出，
+ * 输出每局占用的内存与每秒出牌数
+ *
+ * 用法：engine_bench [--games N] [--threads N] [--seed N] [--rules game_rules.json] <level.json>
+ *   每局的随机数种子为 seed + 对局序号，手牌堆按种子打乱，结果可复现
+ *   每局的出牌策略：有可出的桌面牌时出第一张，否则翻手牌
+ *
+ * 内存取自创建对局前后的常驻内存差（/proc/self/statm），不支持的平台只输出对象估算
+ *
+ * 退出码：0 成功；1 对局生成失败或出牌被拒绝；2 参数或文件错误
+ */
+
+#include "configs/models/LevelConfig.h"
+#include "configs/models/GameRulesConfig.h"
+#include "configs/loaders/LevelConfigSaxHandler.h"
+#include "configs/loaders/LevelFileUtils.h"
+#include "managers/EngineContext.h"
+#include "models/GameModel.h"
+#include "services/GameModelFromLevelGenerator.h"
+#include "services/GameRulesService.h"
+#include "utils/ThreadPool.h"
+#include "external/json/document.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+/**
+ * 单局游戏
+ */
+struct Game {
+    std::shared_ptr<EngineContext> engineContext;   // 本局的引擎上下文
+    std::shared_ptr<GameModel> gameModel;           // 本局的游戏模型
+    size_t moveCount;                               // 已出牌步数（含翻手牌）
+    bool isFinished;                                // 是否已清空桌面或无牌可出
+    bool isWon;                                     // 是否清空桌面
+};
+
+/**
+ * 读取当前进程的常驻内存
+ * @return 字节数，不支持的平台返回0
+ */
+static size_t getResidentBytes() {
+#if defined(__linux__)
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (!file) {
+        return 0;
+    }
+    unsigned long totalPages = 0;
+    unsigned long residentPages = 0;
+    int fieldCount = fscanf(file, "%lu %lu", &totalPages, &residentPages);
+    fclose(file);
+    if (fieldCount != 2) {
+        return 0;
+    }
+    return static_cast<size_t>(residentPages) * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
+/**
+ * 估算一局游戏的对象大小（不含分配器开销），常驻内存不可用时作为参考
+ */
+static size_t estimateGameBytes(const Game& game) {
+    const GameModel& gameModel = *game.gameModel;
+    size_t cardCount = gameModel.getPlayfieldCards().size() + gameModel.getStackCards().size() +
+                       gameModel.getCurrentCardStack().size();
+    return sizeof(Game) + sizeof(EngineContext) + sizeof(GameModel) +
+           cardCount * (sizeof(CardModel) + sizeof(std::shared_ptr<CardModel>));
+}
+
+/**
+ * 读取规则配置文件
+ * @return 规则配置，失败返回nullptr
+ */
+static std::shared_ptr<const GameRulesConfig> loadGameRulesConfig(const std::string& filePath) {
+    std::string content;
+    std::string errorMessage;
+    if (!LevelFileUtils::readFile(filePath, content, errorMessage)) {
+        return nullptr;
+    }
+
+    rapidjson::Document document;
+    document.Parse(content.c_str());
+    auto config = std::make_shared<GameRulesConfig>();
+    if (document.HasParseError() || !document.IsObject() || !config->fromJson(document)) {
+        return nullptr;
+    }
+
+    return config;
+}
+
+/**
+ * 读取关卡文件
+ * @return 关卡配置，失败返回nullptr
+ */
+static std::shared_ptr<LevelConfig> loadLevelConfig(const std::string& filePath) {
+    std::string content;
+    std::string errorMessage;
+    if (!LevelFileUtils::readFile(filePath, content, errorMessage)) {
+        fprintf(stderr, "error: %s: %s\n", filePath.c_str(), errorMessage.c_str());
+        return nullptr;
+    }
+
+    auto config = std::make_shared<LevelConfig>();
+    if (!LevelConfigSaxHandler::parseInsitu(&content[0], config.get(), errorMessage)) {
+        fprintf(stderr, "error: %s: %s\n", filePath.c_str(), errorMessage.c_str());
+        return nullptr;
+    }
+    return config;
+}
+
+/**
+ * 推进一局游戏一步：出第一张可出的桌面牌，没有则翻手牌，都不行时结束
+ * @return 是否出牌成功，判定可出的牌被拒绝时返回false
+ */
+static bool playOneMove(Game& game, const GameRulesConfig::MatchingRules& rules) {
+    GameModel& gameModel = *game.gameModel;
+    for (const auto& card : gameModel.getPlayfieldCards()) {
+        int cardId = card->getCardId();
+        if (GameRulesService::checkPlayfieldMove(gameModel, cardId, rules) != GameRulesService::MOVE_OK) {
+            continue;
+        }
+        if (GameRulesService::applyPlayfieldMove(gameModel, cardId, rules) != GameRulesService::MOVE_OK) {
+            return false;
+        }
+        game.moveCount++;
+        if (gameModel.isGameWon()) {
+            game.isFinished = true;
+            game.isWon = true;
+        }
+        return true;
+    }
+
+    if (GameRulesService::applyStackDraw(gameModel) == GameRulesService::MOVE_OK) {
+        GameRulesService::revealNextStackCard(gameModel);
+        game.moveCount++;
+    } else {
+        game.isFinished = true;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int gameCount = 10000;
+    int threadCount = 0;
+    unsigned long seed = 1;
+    std::string rulesPath;
+    std::string levelPath;
+    bool isUsageError = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--games" && i + 1 < argc) {
+            gameCount = atoi(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threadCount = atoi(argv[++i]);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--rules" && i + 1 < argc) {
+            rulesPath = argv[++i];
+        } else if (arg.compare(0, 2, "--") != 0 && levelPath.empty()) {
+            levelPath = arg;
+        } else {
+            isUsageError = true;
+            break;
+        }
+    }
+
+    if (isUsageError || levelPath.empty() || gameCount < 1 || threadCount < 0) {
+        fprintf(stderr, "Usage: %s [--games N] [--threads N] [--seed N] [--rules game_rules.json] <level.json>\n", argv[0]);
+        return 2;
+    }
+
+    std::shared_ptr<const GameRulesConfig> rulesConfig = std::make_shared<GameRulesConfig>();
+    if (!rulesPath.empty()) {
+        rulesConfig = loadGameRulesConfig(rulesPath);
+        if (!rulesConfig) {
+            fprintf(stderr, "error: %s: Failed to load game rules\n", rulesPath.c_str());
+            return 2;
+        }
+    }
+
+    auto levelConfig = loadLevelConfig(levelPath);
+    if (!levelConfig) {
+        return 2;
+    }
+
+    ThreadPool pool(threadCount);
+    int workerCount = pool.getThreadCount();
+    size_t gamesPerTask = (static_cast<size_t>(gameCount) + workerCount - 1) / workerCount;
+
+    // 所有对局同时存活：先在各线程上创建全部对局，再统一推进
+    std::vector<Game> games(gameCount);
+    std::atomic<int> failedCount(0);
+    size_t residentBefore = getResidentBytes();
+    auto createStart = std::chrono::steady_clock::now();
+    for (size_t begin = 0; begin < games.size(); begin += gamesPerTask) {
+        size_t end = std::min(games.size(), begin + gamesPerTask);
+        pool.enqueue([&, begin, end]() {
+            for (size_t i = begin; i < end; i++) {
+                Game& game = games[i];
+                game.engineContext = std::make_shared<EngineContext>(rulesConfig,
+                                                                     static_cast<EngineContext::result_type>(seed + i));
+                game.gameModel = GameModelFromLevelGenerator::generateGameModel(game.engineContext, levelConfig, false, true);
+                game.moveCount = 0;
+                game.isFinished = false;
+                game.isWon = false;
+                if (!game.gameModel || !GameRulesService::dealInitialCard(*game.gameModel)) {
+                    game.isFinished = true;
+                    failedCount++;
+                }
+            }
+        });
+    }
+    pool.waitForAll();
+    double createMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - createStart).count();
+    size_t residentAfter = getResidentBytes();
+
+    if (failedCount.load() > 0) {
+        fprintf(stderr, "error: %d games failed to generate\n", failedCount.load());
+        return 1;
+    }
+
+    // 每个线程轮流推进自己负责的每一局，一轮每局只走一步，模拟同时进行的对局
+    GameRulesConfig::MatchingRules rules = rulesConfig->getMatchingRules();
+    auto playStart = std::chrono::steady_clock::now();
+    for (size_t begin = 0; begin < games.size(); begin += gamesPerTask) {
+        size_t end = std::min(games.size(), begin + gamesPerTask);
+        pool.enqueue([&, begin, end]() {
+            size_t activeCount = end - begin;
+            while (activeCount > 0) {
+                activeCount = 0;
+                for (size_t i = begin; i < end; i++) {
+                    Game& game = games[i];
+                    if (game.isFinished) {
+                        continue;
+                    }
+                    if (!playOneMove(game, rules)) {
+                        game.isFinished = true;
+                        failedCount++;
+                        continue;
+                    }
+                    if (!game.isFinished) {
+                        activeCount++;
+                    }
+                }
+            }
+        });
+    }
+    pool.waitForAll();
+    double playMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - playStart).count();
+
+    if (failedCount.load() > 0) {
+        fprintf(stderr, "error: %d games had a legal move rejected\n", failedCount.load());
+        return 1;
+    }
+
+    size_t totalMoves = 0;
+    size_t wonCount = 0;
+    for (const auto& game : games) {
+        totalMoves += game.moveCount;
+        wonCount += game.isWon ? 1 : 0;
+    }
+
+    printf("%d games on %d threads, level %d, seed %lu\n", gameCount, workerCount, levelConfig->getLevelId(), seed);
+    printf("create  %10.2f ms  %10.0f games/s\n", createMs, createMs > 0.0 ? gameCount * 1000.0 / createMs : 0.0);
+    if (residentBefore > 0 && residentAfter >= residentBefore) {
+        printf("memory  %10.1f KB resident total  %8zu bytes/game\n",
+               (residentAfter - residentBefore) / 1024.0, (residentAfter - residentBefore) / gameCount);
+    } else {
+        printf("memory  resident size unavailable\n");
+    }
+    printf("        %8zu bytes/game object estimate\n", estimateGameBytes(games[0]));
+    printf("play    %10.2f ms  %10zu moves  %12.0f moves/s\n", playMs, totalMoves,
+           playMs > 0.0 ? totalMoves * 1000.0 / playMs : 0.0);
+    printf("        %zu won, %zu stuck\n", wonCount, games.size() - wonCount);
+    return 0;
+}
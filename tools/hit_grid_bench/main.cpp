@@ -0,0 +1,182 @@
+/**
+ * 触摸命中检测基准
+ * 按卡牌数量比较两种命中检测的单次触摸耗时：
+ * - scan：逐张检查所有卡牌的包围盒并取层级最高的一张（原先每张卡牌一个触摸监听器时的检查量，
+ *   不含监听器排序与坐标转换，实际开销更高）；
+ * - grid：CardArea使用的SpatialHitGrid，只检查触摸点所在格子中的卡牌
+ * 两种方式的命中结果必须一致
+ *
+ * 用法：hit_grid_bench [--touches N] [卡牌数 ...]
+ *   默认卡牌数为 50 100 200 500 1000 2000，每种数量随机触摸N次（默认200000）
+ *   卡牌随机散布，层级为随机值；每种数量测两种桌面：
+ *   - fixed：固定1080x1500的桌面，卡牌越多堆叠越密；
+ *   - scaled：桌面高度随卡牌数增长，保持每1080x1500放50张的密度（需要平移镜头的大关卡）
+ *
+ * 退出码：0 成功；1 两种方式结果不一致；2 参数错误
+ */
+
+#include "utils/SpatialHitGrid.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+static const float kAreaWidth = 1080.0f;       // 桌面区域宽度
+static const float kAreaHeight = 1500.0f;      // 桌面区域高度（一屏）
+static const int kCardsPerScreen = 50;         // scaled桌面每屏的卡牌数
+static const float kCardWidth = 182.0f;        // 卡牌宽度（card_general.png）
+static const float kCardHeight = 282.0f;       // 卡牌高度（card_general.png）
+
+/**
+ * 测试用的卡牌：包围盒与层级
+ */
+struct BenchCard {
+    SpatialHitGrid<BenchCard>::Bounds bounds;  // 区域坐标系中的包围盒
+    int zOrder;                                 // 层级，越大越靠上
+    int orderOfArrival;                         // 加入顺序，同层级时越大越靠上
+};
+
+static bool containsPoint(const BenchCard& card, float x, float y) {
+    return x >= card.bounds.minX && x <= card.bounds.maxX && y >= card.bounds.minY && y <= card.bounds.maxY;
+}
+
+static bool isAbove(const BenchCard& card, const BenchCard* other) {
+    return !other || card.zOrder > other->zOrder ||
+           (card.zOrder == other->zOrder && card.orderOfArrival > other->orderOfArrival);
+}
+
+/**
+ * 逐张检查所有卡牌
+ */
+static const BenchCard* hitTestScan(const std::vector<BenchCard>& cards, float x, float y) {
+    const BenchCard* topCard = nullptr;
+    for (const auto& card : cards) {
+        if (containsPoint(card, x, y) && isAbove(card, topCard)) {
+            topCard = &card;
+        }
+    }
+    return topCard;
+}
+
+/**
+ * 只检查触摸点所在格子，与CardArea::hitTest相同
+ */
+static const BenchCard* hitTestGrid(const SpatialHitGrid<BenchCard>& grid, float x, float y) {
+    const BenchCard* topCard = nullptr;
+    for (auto card : grid.getCandidates(x, y)) {
+        if (containsPoint(*card, x, y) && isAbove(*card, topCard)) {
+            topCard = card;
+        }
+    }
+    return topCard;
+}
+
+/**
+ * 测量一种卡牌数量
+ * @param name 桌面名称
+ * @param cardCount 卡牌数
+ * @param areaHeight 桌面高度
+ * @param touchCount 触摸次数
+ * @return 两种方式结果是否一致
+ */
+static bool runBenchmark(const char* name, int cardCount, float areaHeight, int touchCount) {
+    std::mt19937 random(static_cast<std::mt19937::result_type>(cardCount));
+    std::uniform_real_distribution<float> xDistribution(0.0f, kAreaWidth - kCardWidth);
+    std::uniform_real_distribution<float> yDistribution(0.0f, areaHeight - kCardHeight);
+    std::uniform_int_distribution<int> zDistribution(0, cardCount);
+
+    std::vector<BenchCard> cards(cardCount);
+    SpatialHitGrid<BenchCard> grid;
+    grid.reset(kAreaWidth, areaHeight, kCardWidth, kCardHeight);
+    for (int i = 0; i < cardCount; i++) {
+        float x = xDistribution(random);
+        float y = yDistribution(random);
+        BenchCard& card = cards[i];
+        card.bounds.minX = x;
+        card.bounds.minY = y;
+        card.bounds.maxX = x + kCardWidth;
+        card.bounds.maxY = y + kCardHeight;
+        card.zOrder = zDistribution(random);
+        card.orderOfArrival = i;
+        grid.update(&card, card.bounds);
+    }
+
+    std::uniform_real_distribution<float> touchX(0.0f, kAreaWidth);
+    std::uniform_real_distribution<float> touchY(0.0f, areaHeight);
+    std::vector<float> touches(touchCount * 2);
+    for (int i = 0; i < touchCount; i++) {
+        touches[i * 2] = touchX(random);
+        touches[i * 2 + 1] = touchY(random);
+    }
+
+    // 两种方式分别计时；命中结果累加为校验和，防止被优化掉并比较结果
+    size_t scanChecksum = 0;
+    auto scanStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < touchCount; i++) {
+        const BenchCard* card = hitTestScan(cards, touches[i * 2], touches[i * 2 + 1]);
+        scanChecksum = scanChecksum * 31 + (card ? card->orderOfArrival + 1 : 0);
+    }
+    double scanNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - scanStart).count();
+
+    size_t gridChecksum = 0;
+    size_t candidateCount = 0;
+    auto gridStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < touchCount; i++) {
+        const BenchCard* card = hitTestGrid(grid, touches[i * 2], touches[i * 2 + 1]);
+        gridChecksum = gridChecksum * 31 + (card ? card->orderOfArrival + 1 : 0);
+    }
+    double gridNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - gridStart).count();
+
+    for (int i = 0; i < touchCount; i++) {
+        candidateCount += grid.getCandidates(touches[i * 2], touches[i * 2 + 1]).size();
+    }
+
+    printf("%-6s  %5d cards  scan %9.1f ns/touch  grid %7.1f ns/touch  %6.1f candidates/touch  %6.1fx\n",
+           name, cardCount, scanNs / touchCount, gridNs / touchCount,
+           static_cast<double>(candidateCount) / touchCount, gridNs > 0.0 ? scanNs / gridNs : 0.0);
+
+    if (scanChecksum != gridChecksum) {
+        fprintf(stderr, "error: %s %d cards: scan and grid hit different cards\n", name, cardCount);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int touchCount = 200000;
+    std::vector<int> cardCounts;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--touches" && i + 1 < argc) {
+            touchCount = atoi(argv[++i]);
+        } else if (arg.compare(0, 2, "--") != 0 && atoi(arg.c_str()) > 0) {
+            cardCounts.push_back(atoi(arg.c_str()));
+        } else {
+            touchCount = 0;
+            break;
+        }
+    }
+
+    if (touchCount < 1) {
+        fprintf(stderr, "Usage: %s [--touches N] [card-count ...]\n", argv[0]);
+        return 2;
+    }
+    if (cardCounts.empty()) {
+        cardCounts = {50, 100, 200, 500, 1000, 2000};
+    }
+
+    printf("%.0fx%.0f cards, %d touches per count\n", kCardWidth, kCardHeight, touchCount);
+    bool isConsistent = true;
+    for (int cardCount : cardCounts) {
+        isConsistent = runBenchmark("fixed", cardCount, kAreaHeight, touchCount) && isConsistent;
+    }
+    for (int cardCount : cardCounts) {
+        float screens = std::max(1.0f, static_cast<float>(cardCount) / kCardsPerScreen);
+        isConsistent = runBenchmark("scaled", cardCount, kAreaHeight * screens, touchCount) && isConsistent;
+    }
+    return isConsistent ? 0 : 1;
+}
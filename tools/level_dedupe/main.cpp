@@ -0,0 +1,139 @@
+/**
+ * 关卡去重工具
+ * 并行解析一组关卡文件，按内容哈希分组，报告内容相同但ID不同的关卡
+ *
+ * 用法：level_dedupe <目录|level.json>...
+ *   目录：按关卡包索引或level_<id>.json列举其中的关卡
+ *   例：level_dedupe Resources/configs/data/levels
+ *
+ * 退出码：0 无重复；1 存在重复；2 参数错误或有文件无法解析
+ */
+
+#include "configs/models/LevelConfig.h"
+#include "configs/loaders/LevelConfigSaxHandler.h"
+#include "configs/loaders/LevelFileUtils.h"
+#include "utils/ThreadPool.h"
+#include <cstdio>
+#include <exception>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * 单个关卡文件的处理结果
+ */
+struct LevelEntry {
+    std::string filePath;       // 文件路径
+    int levelId;                // 关卡ID
+    uint64_t contentHash;       // 内容哈希
+    bool isValid;               // 是否解析成功
+    std::string errorMessage;   // 错误信息
+};
+
+/**
+ * 解析关卡并计算内容哈希（工作线程）
+ * @param entry 关卡条目，filePath已填写
+ */
+static void processLevel(LevelEntry& entry) {
+    std::string content;
+    if (!LevelFileUtils::readFile(entry.filePath, content, entry.errorMessage)) {
+        return;
+    }
+
+    LevelConfig config;
+    if (!LevelConfigSaxHandler::parseInsitu(&content[0], &config, entry.errorMessage)) {
+        return;
+    }
+
+    entry.levelId = config.getLevelId();
+    entry.contentHash = config.computeContentHash();
+    entry.isValid = true;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <directory|level.json>...\n", argv[0]);
+        return 2;
+    }
+
+    // 目录参数展开为其中的关卡文件
+    std::vector<std::string> filePaths;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (FileUtils::getInstance()->isDirectoryExist(arg)) {
+            for (const auto& levelFile : LevelFileUtils::enumerateLevelFiles(arg)) {
+                filePaths.push_back(levelFile.second);
+            }
+        } else {
+            filePaths.push_back(arg);
+        }
+    }
+
+    if (filePaths.empty()) {
+        fprintf(stderr, "error: no level files found\n");
+        return 2;
+    }
+
+    std::vector<LevelEntry> entries(filePaths.size());
+    for (size_t i = 0; i < filePaths.size(); i++) {
+        LevelEntry& entry = entries[i];
+        entry.filePath = filePaths[i];
+        entry.levelId = 0;
+        entry.contentHash = 0;
+        entry.isValid = false;
+    }
+
+    // 一次并行处理所有文件，每个任务只写自己的条目
+    {
+        ThreadPool pool;
+        for (auto& entry : entries) {
+            LevelEntry* target = &entry;
+            pool.enqueue([target]() {
+                // 单个文件的异常只记为该文件的错误，不影响其他文件
+                try {
+                    processLevel(*target);
+                } catch (const std::exception& e) {
+                    target->isValid = false;
+                    target->errorMessage = e.what();
+                } catch (...) {
+                    target->isValid = false;
+                    target->errorMessage = "Unknown exception";
+                }
+            });
+        }
+        pool.waitForAll();
+    }
+
+    // 按内容哈希分组（保持命令行顺序）
+    std::map<uint64_t, std::vector<const LevelEntry*>> groups;
+    int errorCount = 0;
+    for (const auto& entry : entries) {
+        if (!entry.isValid) {
+            fprintf(stderr, "error: %s: %s\n", entry.filePath.c_str(), entry.errorMessage.c_str());
+            errorCount++;
+            continue;
+        }
+        groups[entry.contentHash].push_back(&entry);
+    }
+
+    int duplicateGroupCount = 0;
+    for (const auto& group : groups) {
+        if (group.second.size() < 2) {
+            continue;
+        }
+
+        duplicateGroupCount++;
+        printf("duplicate %016llx:\n", static_cast<unsigned long long>(group.first));
+        for (const LevelEntry* entry : group.second) {
+            printf("  level %d  %s\n", entry->levelId, entry->filePath.c_str());
+        }
+    }
+
+    printf("%zu files, %zu unique, %d duplicate groups, %d errors\n",
+           entries.size(), groups.size(), duplicateGroupCount, errorCount);
+
+    if (errorCount > 0) {
+        return 2;
+    }
+    return duplicateGroupCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,238 @@
+/**
+ * 关卡检查工具
+ * 并行解析并检查整个关卡目录或关卡包，输出可读文本或JSON
+ *
+ * 用法：level_lint [--json] [--max-decks N] <目录|level.json>...
+ *   目录：按关卡包索引或level_<id>.json列举其中的关卡
+ *
+ *   --max-decks N：允许同一张牌出现的副数，N为正整数
+ *
+ * 退出码：0 无错误；1 存在错误（含无法解析的文件）；2 参数错误
+ */
+
+#include "configs/models/LevelConfig.h"
+#include "configs/loaders/LevelConfigSaxHandler.h"
+#include "configs/loaders/LevelFileUtils.h"
+#include "services/LevelLinter.h"
+#include "utils/ThreadPool.h"
+#include "external/json/writer.h"
+#include "external/json/stringbuffer.h"
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <vector>
+
+/**
+ * 单个关卡文件的检查结果
+ */
+struct LintResult {
+    std::string filePath;                   // 文件路径
+    int levelId;                            // 关卡ID
+    std::string parseError;                 // 解析错误，为空表示解析成功
+    std::vector<LevelLinter::Issue> issues; // 内容问题
+};
+
+/**
+ * 输出用法说明
+ */
+static void printUsage(const char* programName) {
+    fprintf(stderr, "Usage: %s [--json] [--max-decks N] <directory|level.json>...\n", programName);
+}
+
+/**
+ * 解析正整数参数
+ * @param text 参数文本
+ * @param value 解析成功时写入的值
+ * @return 是否为完整的正整数
+ */
+static bool parsePositiveInt(const char* text, int& value) {
+    char* end = nullptr;
+    errno = 0;
+    long parsed = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || errno != 0 || parsed < 1 || parsed > INT_MAX) {
+        return false;
+    }
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+/**
+ * 解析并检查关卡（工作线程）
+ */
+static void lintLevel(LintResult& result, const LevelLinter::Options& options) {
+    std::string content;
+    if (!LevelFileUtils::readFile(result.filePath, content, result.parseError)) {
+        return;
+    }
+
+    LevelConfig config;
+    if (!LevelConfigSaxHandler::parseInsitu(&content[0], &config, result.parseError)) {
+        return;
+    }
+
+    result.levelId = config.getLevelId();
+    result.issues = LevelLinter::lint(config, options);
+}
+
+/**
+ * 以文本输出检查结果
+ */
+static void printText(const std::vector<LintResult>& results) {
+    for (const auto& result : results) {
+        if (!result.parseError.empty()) {
+            printf("%s: error parse: %s\n", result.filePath.c_str(), result.parseError.c_str());
+            continue;
+        }
+        for (const auto& issue : result.issues) {
+            printf("%s: %s %s %s: %s\n", result.filePath.c_str(),
+                   LevelLinter::getSeverityName(issue.severity), issue.rule.c_str(),
+                   issue.location.empty() ? "-" : issue.location.c_str(), issue.message.c_str());
+        }
+    }
+}
+
+/**
+ * 以JSON输出检查结果
+ */
+static void printJson(const std::vector<LintResult>& results, int errorCount, int warningCount) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+    writer.StartObject();
+    writer.Key("files");
+    writer.Int(static_cast<int>(results.size()));
+    writer.Key("errors");
+    writer.Int(errorCount);
+    writer.Key("warnings");
+    writer.Int(warningCount);
+
+    writer.Key("results");
+    writer.StartArray();
+    for (const auto& result : results) {
+        if (result.parseError.empty() && result.issues.empty()) {
+            continue;
+        }
+
+        writer.StartObject();
+        writer.Key("file");
+        writer.String(result.filePath.c_str());
+        writer.Key("levelId");
+        writer.Int(result.levelId);
+
+        writer.Key("issues");
+        writer.StartArray();
+        if (!result.parseError.empty()) {
+            writer.StartObject();
+            writer.Key("severity");
+            writer.String("error");
+            writer.Key("rule");
+            writer.String("parse");
+            writer.Key("message");
+            writer.String(result.parseError.c_str());
+            writer.EndObject();
+        }
+        for (const auto& issue : result.issues) {
+            writer.StartObject();
+            writer.Key("severity");
+            writer.String(LevelLinter::getSeverityName(issue.severity));
+            writer.Key("rule");
+            writer.String(issue.rule.c_str());
+            if (!issue.location.empty()) {
+                writer.Key("location");
+                writer.String(issue.location.c_str());
+            }
+            writer.Key("message");
+            writer.String(issue.message.c_str());
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    printf("%s\n", buffer.GetString());
+}
+
+int main(int argc, char** argv) {
+    bool isJsonOutput = false;
+    LevelLinter::Options options;
+    std::vector<std::string> filePaths;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--json") {
+            isJsonOutput = true;
+        } else if (arg == "--max-decks") {
+            if (i + 1 >= argc || !parsePositiveInt(argv[i + 1], options.maxDecks)) {
+                fprintf(stderr, "error: --max-decks requires a positive integer\n");
+                printUsage(argv[0]);
+                return 2;
+            }
+            i++;
+        } else if (arg.compare(0, 2, "--") == 0) {
+            fprintf(stderr, "error: unknown option %s\n", arg.c_str());
+            printUsage(argv[0]);
+            return 2;
+        } else if (FileUtils::getInstance()->isDirectoryExist(arg)) {
+            for (const auto& levelFile : LevelFileUtils::enumerateLevelFiles(arg)) {
+                filePaths.push_back(levelFile.second);
+            }
+        } else {
+            filePaths.push_back(arg);
+        }
+    }
+
+    if (filePaths.empty()) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::vector<LintResult> results(filePaths.size());
+    {
+        ThreadPool pool;
+        for (size_t i = 0; i < filePaths.size(); i++) {
+            LintResult* result = &results[i];
+            result->filePath = filePaths[i];
+            result->levelId = 0;
+            pool.enqueue([result, &options]() {
+                // 单个文件的异常只记为该文件的错误，不影响其他文件
+                try {
+                    lintLevel(*result, options);
+                } catch (const std::exception& e) {
+                    result->parseError = e.what();
+                } catch (...) {
+                    result->parseError = "Unknown exception";
+                }
+            });
+        }
+        pool.waitForAll();
+    }
+
+    int errorCount = 0;
+    int warningCount = 0;
+    for (const auto& result : results) {
+        if (!result.parseError.empty()) {
+            errorCount++;
+        }
+        for (const auto& issue : result.issues) {
+            if (issue.severity == LevelLinter::SEVERITY_ERROR) {
+                errorCount++;
+            } else {
+                warningCount++;
+            }
+        }
+    }
+
+    if (isJsonOutput) {
+        printJson(results, errorCount, warningCount);
+    } else {
+        printText(results);
+        printf("%zu files, %d errors, %d warnings\n", results.size(), errorCount, warningCount);
+    }
+
+    return errorCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,173 @@
+/**
+ * 关卡解析基准
+ * 生成约5MB的关卡JSON（或读取指定文件），分别计时单遍SAX就地解析与DOM解析后fromJson，
+ * 输出每次解析耗时与吞吐
+ *
+ * 用法：level_parse_bench [--size-mb N] [--iterations N] [level.json]
+ *   未指定文件时生成N MB（默认5）的关卡，牌面、花色、坐标按序循环
+ *
+ * 退出码：0 成功；1 解析失败或两种解析结果不一致；2 参数或文件错误
+ */
+
+#include "configs/models/LevelConfig.h"
+#include "configs/loaders/LevelConfigSaxHandler.h"
+#include "configs/loaders/LevelFileUtils.h"
+#include "external/json/document.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+/**
+ * 生成指定大小的关卡JSON
+ * @param targetBytes 目标字节数，生成结果略大于该值
+ * @return 关卡JSON文本
+ */
+static std::string generateLevelJson(size_t targetBytes) {
+    std::string json;
+    json.reserve(targetBytes + 1024);
+    json += "{\n    \"LevelId\": 9999,\n    \"LevelName\": \"Parse Benchmark\",\n    \"Playfield\": [\n";
+
+    char card[160];
+    int index = 0;
+    while (json.size() < targetBytes) {
+        snprintf(card, sizeof(card),
+                 "%s        {\"CardFace\": %d, \"CardSuit\": %d, \"Position\": {\"x\": %d, \"y\": %d}}",
+                 index > 0 ? ",\n" : "", index % CFT_NUM_CARD_FACE_TYPES, (index / CFT_NUM_CARD_FACE_TYPES) % CST_NUM_CARD_SUIT_TYPES,
+                 100 + (index * 37) % 880, 200 + (index * 53) % 1200);
+        json += card;
+        index++;
+    }
+
+    json += "\n    ],\n    \"Stack\": [\n"
+            "        {\"CardFace\": 0, \"CardSuit\": 2, \"Position\": {\"x\": 0, \"y\": 0}},\n"
+            "        {\"CardFace\": 3, \"CardSuit\": 0, \"Position\": {\"x\": 0, \"y\": 0}}\n"
+            "    ],\n"
+            "    \"PlayfieldSize\": {\"width\": 1080, \"height\": 1500},\n"
+            "    \"StackSize\": {\"width\": 1080, \"height\": 580}\n}\n";
+    return json;
+}
+
+/**
+ * SAX就地解析一次
+ * @param json 关卡JSON文本（复制后解析，原文不变）
+ * @param config 输出的关卡配置
+ * @return 是否解析成功
+ */
+static bool parseWithSax(const std::string& json, LevelConfig& config) {
+    std::string buffer = json;
+    std::string errorMessage;
+    if (!LevelConfigSaxHandler::parseInsitu(&buffer[0], &config, errorMessage)) {
+        fprintf(stderr, "error: SAX parse failed: %s\n", errorMessage.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * 就地解析为DOM后用fromJson填充一次
+ * @param json 关卡JSON文本（复制后解析，原文不变）
+ * @param config 输出的关卡配置
+ * @return 是否解析成功
+ */
+static bool parseWithDom(const std::string& json, LevelConfig& config) {
+    std::string buffer = json;
+    rapidjson::Document document;
+    document.ParseInsitu(&buffer[0]);
+    if (document.HasParseError() || !document.IsObject()) {
+        fprintf(stderr, "error: DOM parse failed at offset %zu\n", static_cast<size_t>(document.GetErrorOffset()));
+        return false;
+    }
+    config.fromJson(document);
+    return true;
+}
+
+/**
+ * 计时多次解析
+ * @param name 解析方式名称
+ * @param json 关卡JSON文本
+ * @param iterations 次数
+ * @param parse 解析函数
+ * @param config 最后一次解析的结果
+ * @return 是否全部解析成功
+ */
+static bool runBenchmark(const char* name, const std::string& json, int iterations,
+                         bool (*parse)(const std::string&, LevelConfig&), LevelConfig& config) {
+    double totalMs = 0.0;
+    double bestMs = 0.0;
+    for (int i = 0; i < iterations; i++) {
+        LevelConfig iterationConfig;
+        auto startTime = std::chrono::steady_clock::now();
+        if (!parse(json, iterationConfig)) {
+            return false;
+        }
+        double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        totalMs += elapsedMs;
+        if (i == 0 || elapsedMs < bestMs) {
+            bestMs = elapsedMs;
+        }
+        if (i == iterations - 1) {
+            config = iterationConfig;
+        }
+    }
+
+    double megabytes = static_cast<double>(json.size()) / (1024.0 * 1024.0);
+    printf("%-4s  avg %8.2f ms  best %8.2f ms  %8.1f MB/s\n", name, totalMs / iterations, bestMs,
+           bestMs > 0.0 ? megabytes * 1000.0 / bestMs : 0.0);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int sizeMb = 5;
+    int iterations = 10;
+    std::string filePath;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--size-mb" && i + 1 < argc) {
+            sizeMb = atoi(argv[++i]);
+        } else if (arg == "--iterations" && i + 1 < argc) {
+            iterations = atoi(argv[++i]);
+        } else if (arg.compare(0, 2, "--") != 0 && filePath.empty()) {
+            filePath = arg;
+        } else {
+            sizeMb = 0;
+            break;
+        }
+    }
+
+    if (sizeMb < 1 || iterations < 1) {
+        fprintf(stderr, "Usage: %s [--size-mb N] [--iterations N] [level.json]\n", argv[0]);
+        return 2;
+    }
+
+    std::string json;
+    if (filePath.empty()) {
+        json = generateLevelJson(static_cast<size_t>(sizeMb) * 1024 * 1024);
+    } else {
+        std::string errorMessage;
+        if (!LevelFileUtils::readFile(filePath, json, errorMessage)) {
+            fprintf(stderr, "error: %s: %s\n", filePath.c_str(), errorMessage.c_str());
+            return 2;
+        }
+    }
+
+    printf("input %zu bytes, %d iterations\n", json.size(), iterations);
+
+    LevelConfig saxConfig;
+    LevelConfig domConfig;
+    if (!runBenchmark("sax", json, iterations, parseWithSax, saxConfig) ||
+        !runBenchmark("dom", json, iterations, parseWithDom, domConfig)) {
+        return 1;
+    }
+
+    // 两种解析方式必须得到相同的关卡内容
+    if (saxConfig.computeContentHash() != domConfig.computeContentHash()) {
+        fprintf(stderr, "error: SAX and DOM results differ\n");
+        return 1;
+    }
+
+    printf("%zu playfield cards, %zu stack cards, results match\n",
+           saxConfig.getPlayfieldCards().size(), saxConfig.getStackCards().size());
+    return 0;
+}
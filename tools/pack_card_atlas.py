@@ -0,0 +1,312 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# 把卡牌散图打包为一张图集及cocos2d-x格式的帧索引（plist，format 2）
+#
+# 用法：
+#   python tools/pack_card_atlas.py [--verify] <Resources目录> <输出前缀>
+#   例：python tools/pack_card_atlas.py Resources Resources/res/card_atlas
+#   生成 card_atlas.png 与 card_atlas.plist
+#   加 --verify 时读回生成的图集，逐像素核对每一帧与原图、外扩像素与帧间不重叠，不一致时退出码为1
+#
+# 帧名为图片相对Resources目录的路径（如 res/number/big_black_A.png），
+# 与 CardAtlas::getSpriteFrame 使用的路径一致，图集缺失时运行时可直接回退到散图
+#
+# 仅依赖Python标准库（zlib解码/编码PNG），支持8位RGB/RGBA非隔行PNG
+
+import os
+import struct
+import sys
+import zlib
+
+# 打包的图片，相对Resources目录；须与 CardView 使用的路径保持一致
+CARD_IMAGE_DIRS = ["res/number", "res/suits"]
+CARD_IMAGE_FILES = ["res/card_general.png"]
+
+# 图片之间的间距（像素），其中一圈为边缘像素外扩，避免线性过滤时采样到相邻图片
+PADDING = 2
+EXTRUDE = 1
+
+MAX_ATLAS_SIZE = 2048
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+
+def fail(message):
+    sys.stderr.write("pack_card_atlas: %s\n" % message)
+    sys.exit(1)
+
+
+def read_png(path):
+    """读取PNG，返回 (宽, 高, RGBA逐行字节列表)"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != PNG_SIGNATURE:
+        fail("%s is not a PNG file" % path)
+
+    offset = 8
+    idat = []
+    width = height = bit_depth = color_type = interlace = None
+    while offset < len(data):
+        length, chunk_type = struct.unpack(">I4s", data[offset:offset + 8])
+        chunk = data[offset + 8:offset + 8 + length]
+        offset += 12 + length
+        if chunk_type == b"IHDR":
+            width, height, bit_depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif chunk_type == b"IDAT":
+            idat.append(chunk)
+        elif chunk_type == b"IEND":
+            break
+
+    if bit_depth != 8 or color_type not in (2, 6) or interlace != 0:
+        fail("%s: only 8-bit non-interlaced RGB/RGBA is supported" % path)
+
+    channels = 4 if color_type == 6 else 3
+    stride = width * channels
+    raw = zlib.decompress(b"".join(idat))
+
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        base = y * (stride + 1)
+        filter_type = raw[base] if isinstance(raw[base], int) else ord(raw[base])
+        row = bytearray(raw[base + 1:base + 1 + stride])
+        for i in range(stride if filter_type != 0 else 0):
+            left = row[i - channels] if i >= channels else 0
+            up = previous[i]
+            up_left = previous[i - channels] if i >= channels else 0
+            if filter_type == 1:
+                row[i] = (row[i] + left) & 0xff
+            elif filter_type == 2:
+                row[i] = (row[i] + up) & 0xff
+            elif filter_type == 3:
+                row[i] = (row[i] + ((left + up) >> 1)) & 0xff
+            elif filter_type == 4:
+                p = left + up - up_left
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - up_left)
+                if pa <= pb and pa <= pc:
+                    predictor = left
+                elif pb <= pc:
+                    predictor = up
+                else:
+                    predictor = up_left
+                row[i] = (row[i] + predictor) & 0xff
+        previous = row
+
+        if channels == 3:
+            rgba = bytearray(width * 4)
+            for x in range(width):
+                rgba[x * 4:x * 4 + 3] = row[x * 3:x * 3 + 3]
+                rgba[x * 4 + 3] = 0xff
+            row = rgba
+        rows.append(row)
+
+    return width, height, rows
+
+
+def write_png(path, width, height, pixels):
+    """写出RGBA PNG，pixels为按行排列的bytearray"""
+    stride = width * 4
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        raw.extend(pixels[y * stride:(y + 1) * stride])
+
+    def chunk(chunk_type, payload):
+        crc = zlib.crc32(chunk_type + payload) & 0xffffffff
+        return struct.pack(">I", len(payload)) + chunk_type + payload + struct.pack(">I", crc)
+
+    header = struct.pack(">IIBBBBB", width, height, 8, 6, 0, 0, 0)
+    with open(path, "wb") as f:
+        f.write(PNG_SIGNATURE)
+        f.write(chunk(b"IHDR", header))
+        f.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+def collect_images(resource_root):
+    names = list(CARD_IMAGE_FILES)
+    for directory in CARD_IMAGE_DIRS:
+        full_directory = os.path.join(resource_root, directory)
+        for file_name in sorted(os.listdir(full_directory)):
+            if file_name.endswith(".png"):
+                names.append(directory + "/" + file_name)
+    return names
+
+
+def shelf_pack(images, atlas_width):
+    """按高度降序逐行排布，返回所需高度；放不下时返回None"""
+    x = y = shelf_height = 0
+    cell = PADDING + EXTRUDE
+    for image in images:
+        width = image["width"] + cell * 2
+        height = image["height"] + cell * 2
+        if width > atlas_width:
+            return None
+        if x + width > atlas_width:
+            y += shelf_height
+            x = shelf_height = 0
+        image["x"] = x + cell
+        image["y"] = y + cell
+        x += width
+        shelf_height = max(shelf_height, height)
+    return y + shelf_height
+
+
+def choose_atlas_size(images):
+    """选取面积最小的2的幂尺寸，面积相同时取更接近正方形的"""
+    best = None
+    width = 64
+    while width <= MAX_ATLAS_SIZE:
+        used_height = shelf_pack(images, width)
+        if used_height is not None:
+            height = 64
+            while height < used_height:
+                height *= 2
+            key = (width * height, max(width, height))
+            if height <= MAX_ATLAS_SIZE and (best is None or key < best[2]):
+                best = (width, height, key)
+        width *= 2
+
+    if best is None:
+        fail("images do not fit into %dx%d" % (MAX_ATLAS_SIZE, MAX_ATLAS_SIZE))
+    shelf_pack(images, best[0])
+    return best[0], best[1]
+
+
+def blit(pixels, atlas_width, image):
+    stride = atlas_width * 4
+    width, height, rows = image["width"], image["height"], image["rows"]
+
+    # 外扩：上下左右各复制EXTRUDE圈边缘像素
+    for dy in range(-EXTRUDE, height + EXTRUDE):
+        source_row = rows[min(max(dy, 0), height - 1)]
+        target = (image["y"] + dy) * stride
+        row = bytearray()
+        row.extend(source_row[0:4] * EXTRUDE)
+        row.extend(source_row)
+        row.extend(source_row[-4:] * EXTRUDE)
+        start = target + (image["x"] - EXTRUDE) * 4
+        pixels[start:start + len(row)] = row
+
+
+def verify_atlas(path, images):
+    """读回图集，核对每一帧的像素、外扩像素与帧间不重叠，返回错误数"""
+    atlas_width, atlas_height, rows = read_png(path)
+    errors = 0
+    cell = EXTRUDE
+
+    for image in images:
+        x, y, width, height = image["x"], image["y"], image["width"], image["height"]
+        if x - cell < 0 or y - cell < 0 or x + width + cell > atlas_width or y + height + cell > atlas_height:
+            sys.stderr.write("pack_card_atlas: %s: frame outside the atlas\n" % image["name"])
+            errors += 1
+            continue
+
+        # 帧内像素与原图一致，外扩的一圈等于最近的边缘像素
+        for dy in range(-cell, height + cell):
+            source_row = image["rows"][min(max(dy, 0), height - 1)]
+            expected = source_row[0:4] * cell + source_row + source_row[-4:] * cell
+            actual = rows[y + dy][(x - cell) * 4:(x + width + cell) * 4]
+            if actual != expected:
+                sys.stderr.write("pack_card_atlas: %s: row %d differs from the source image\n" % (image["name"], dy))
+                errors += 1
+                break
+
+    # 含外扩在内的帧区域互不重叠
+    ordered = sorted(images, key=lambda item: (item["y"], item["x"]))
+    for i, first in enumerate(ordered):
+        for second in ordered[i + 1:]:
+            if second["y"] - cell >= first["y"] + first["height"] + cell:
+                break
+            if (first["x"] - cell < second["x"] + second["width"] + cell and
+                    second["x"] - cell < first["x"] + first["width"] + cell and
+                    first["y"] - cell < second["y"] + second["height"] + cell):
+                sys.stderr.write("pack_card_atlas: %s overlaps %s\n" % (first["name"], second["name"]))
+                errors += 1
+
+    return errors
+
+
+def write_plist(path, texture_file_name, atlas_size, images):
+    lines = [
+        '<?xml version="1.0" encoding="UTF-8"?>',
+        '<!DOCTYPE plist PUBLIC "-//Apple//DTD PLIST 1.0//EN" "http://www.apple.com/DTDs/PropertyList-1.0.dtd">',
+        '<plist version="1.0">',
+        '<dict>',
+        '    <key>frames</key>',
+        '    <dict>',
+    ]
+    for image in sorted(images, key=lambda item: item["name"]):
+        width, height = image["width"], image["height"]
+        lines += [
+            '        <key>%s</key>' % image["name"],
+            '        <dict>',
+            '            <key>frame</key>',
+            '            <string>{{%d,%d},{%d,%d}}</string>' % (image["x"], image["y"], width, height),
+            '            <key>offset</key>',
+            '            <string>{0,0}</string>',
+            '            <key>rotated</key>',
+            '            <false/>',
+            '            <key>sourceColorRect</key>',
+            '            <string>{{0,0},{%d,%d}}</string>' % (width, height),
+            '            <key>sourceSize</key>',
+            '            <string>{%d,%d}</string>' % (width, height),
+            '        </dict>',
+        ]
+    lines += [
+        '    </dict>',
+        '    <key>metadata</key>',
+        '    <dict>',
+        '        <key>format</key>',
+        '        <integer>2</integer>',
+        '        <key>size</key>',
+        '        <string>{%d,%d}</string>' % atlas_size,
+        '        <key>textureFileName</key>',
+        '        <string>%s</string>' % texture_file_name,
+        '    </dict>',
+        '</dict>',
+        '</plist>',
+        '',
+    ]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    arguments = sys.argv[1:]
+    verify = "--verify" in arguments
+    if verify:
+        arguments.remove("--verify")
+    if len(arguments) != 2:
+        fail("usage: pack_card_atlas.py [--verify] <resource root> <output prefix>")
+
+    resource_root, output_prefix = arguments
+
+    images = []
+    for name in collect_images(resource_root):
+        width, height, rows = read_png(os.path.join(resource_root, name))
+        images.append({"name": name, "width": width, "height": height, "rows": rows})
+
+    images.sort(key=lambda item: (-item["height"], -item["width"], item["name"]))
+    atlas_width, atlas_height = choose_atlas_size(images)
+
+    pixels = bytearray(atlas_width * atlas_height * 4)
+    for image in images:
+        blit(pixels, atlas_width, image)
+
+    write_png(output_prefix + ".png", atlas_width, atlas_height, pixels)
+    write_plist(output_prefix + ".plist", os.path.basename(output_prefix) + ".png",
+                (atlas_width, atlas_height), images)
+
+    print("pack_card_atlas: %d images -> %s.png (%dx%d)" % (len(images), output_prefix, atlas_width, atlas_height))
+
+    if verify:
+        errors = verify_atlas(output_prefix + ".png", images)
+        if errors:
+            fail("%d errors in %s.png" % (errors, output_prefix))
+        print("pack_card_atlas: verified %d frames against the source images" % len(images))
+
+
+if __name__ == "__main__":
+    main()
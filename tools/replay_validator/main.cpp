@@ -0,0 +1,298 @@
+/**
+ * 回放校验工具
+ * 批量重放提交的出牌序列，按游戏规则校验是否合法并清空桌面，可作为校验服务的标准输入/输出前端
+ *
+ * 用法：replay_validator [--threads N] [--rules game_rules.json] --levels <关卡目录> [批量文件|-]
+ *   未指定批量文件或为"-"时从标准输入读取，按块处理并逐块输出，可接在管道中长期运行
+ *
+ * 输入每行一条提交：<提交ID> <关卡ID> <出牌序列>，如"a17 1 p3p7sp0"；空行与#开头的行忽略
+ * 输出按输入顺序每行一条结果：
+ *   <提交ID> accept
+ *   <提交ID> reject <第一个失败步骤的下标|-> <原因>
+ *
+ * 退出码：0 全部通过；1 存在拒绝；2 参数或文件错误
+ */
+
+#include "configs/models/LevelConfig.h"
+#include "configs/models/GameRulesConfig.h"
+#include "configs/loaders/LevelConfigSaxHandler.h"
+#include "managers/EngineContext.h"
+#include "services/ReplayValidator.h"
+#include "utils/ThreadPool.h"
+#include "external/json/document.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+static const size_t kBlockSize = 4096;          // 每块读取的提交数，读完一块即校验并输出
+static const size_t kTaskSize = 64;             // 每个线程池任务校验的提交数
+
+/**
+ * 单条提交及其校验结果
+ */
+struct Submission {
+    std::string submissionId;                   // 提交ID
+    int levelId;                                // 关卡ID
+    std::string moveText;                       // 出牌序列
+    std::shared_ptr<LevelConfig> levelConfig;   // 关卡配置，关卡无效时为nullptr
+    std::string inputError;                     // 行格式或关卡错误，为空表示可以重放
+    ReplayValidator::Result result;             // 校验结果
+};
+
+/**
+ * 读取整个文件
+ */
+static bool readFile(const std::string& filePath, std::string& content) {
+    std::ifstream file(filePath.c_str(), std::ios::in | std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+/**
+ * 读取规则配置文件
+ * @return 规则配置，失败返回nullptr
+ */
+static std::shared_ptr<const GameRulesConfig> loadGameRulesConfig(const std::string& filePath) {
+    std::string content;
+    if (!readFile(filePath, content)) {
+        return nullptr;
+    }
+
+    rapidjson::Document document;
+    document.Parse(content.c_str());
+    auto config = std::make_shared<GameRulesConfig>();
+    if (document.HasParseError() || !document.IsObject() || !config->fromJson(document)) {
+        return nullptr;
+    }
+
+    return config;
+}
+
+/**
+ * 关卡配置缓存（主线程加载，工作线程只读）
+ */
+class LevelCache {
+public:
+    explicit LevelCache(const std::string& directory) : _directory(directory) {}
+
+    /**
+     * 获取关卡配置，首次访问时从目录加载
+     * @return 关卡配置，文件缺失或无效时返回nullptr
+     */
+    std::shared_ptr<LevelConfig> get(int levelId) {
+        auto it = _levels.find(levelId);
+        if (it != _levels.end()) {
+            return it->second;
+        }
+
+        std::shared_ptr<LevelConfig> config;
+        std::string content;
+        std::string errorMessage;
+        std::string filePath = _directory + "/level_" + std::to_string(levelId) + ".json";
+        if (readFile(filePath, content)) {
+            config = std::make_shared<LevelConfig>();
+            if (!LevelConfigSaxHandler::parseInsitu(&content[0], config.get(), errorMessage)) {
+                fprintf(stderr, "error: %s: %s\n", filePath.c_str(), errorMessage.c_str());
+                config = nullptr;
+            }
+        }
+
+        _levels[levelId] = config;
+        return config;
+    }
+
+private:
+    std::string _directory;
+    std::map<int, std::shared_ptr<LevelConfig>> _levels;
+};
+
+/**
+ * 解析一行提交
+ * @return 是否为提交行（空行与注释行返回false）
+ */
+static bool parseLine(const std::string& line, size_t lineNumber, LevelCache& levels, Submission& submission) {
+    size_t start = line.find_first_not_of(" \t\r");
+    if (start == std::string::npos || line[start] == '#') {
+        return false;
+    }
+
+    std::istringstream stream(line);
+    std::string levelText;
+    std::string extra;
+    stream >> submission.submissionId >> levelText >> submission.moveText;
+    submission.levelId = 0;
+    submission.levelConfig = nullptr;
+    submission.inputError.clear();
+
+    if (submission.moveText.empty() || (stream >> extra)) {
+        if (submission.submissionId.empty()) {
+            submission.submissionId = "line:" + std::to_string(lineNumber);
+        }
+        submission.inputError = "malformed-line";
+        return true;
+    }
+
+    char* end = nullptr;
+    long levelId = strtol(levelText.c_str(), &end, 10);
+    if (*end != '\0' || levelId <= 0) {
+        submission.inputError = "malformed-line";
+        return true;
+    }
+
+    submission.levelId = static_cast<int>(levelId);
+    submission.levelConfig = levels.get(submission.levelId);
+    if (!submission.levelConfig) {
+        submission.inputError = "unknown-level";
+    }
+    return true;
+}
+
+/**
+ * 校验一条提交（工作线程）
+ */
+static void validateSubmission(Submission& submission, const std::shared_ptr<EngineContext>& engineContext) {
+    if (!submission.inputError.empty()) {
+        submission.result.isAccepted = false;
+        submission.result.failedMoveIndex = -1;
+        submission.result.reason = submission.inputError;
+        return;
+    }
+
+    std::vector<ReplayValidator::Move> moves;
+    std::string errorMessage;
+    if (!ReplayValidator::parseMoves(submission.moveText, moves, errorMessage)) {
+        submission.result.isAccepted = false;
+        submission.result.failedMoveIndex = -1;
+        submission.result.reason = "invalid-moves";
+        return;
+    }
+
+    submission.result = ReplayValidator::validate(engineContext, submission.levelConfig, moves);
+}
+
+/**
+ * 并行校验一块提交并按输入顺序输出
+ * @return 拒绝的数量
+ */
+static size_t processBlock(std::vector<Submission>& block, ThreadPool& pool,
+                           const std::shared_ptr<const GameRulesConfig>& rulesConfig) {
+    // 每个任务处理一段连续的提交，只写自己的条目；各任务使用独立的引擎上下文，卡牌ID分配互不争用
+    for (size_t begin = 0; begin < block.size(); begin += kTaskSize) {
+        Submission* first = &block[begin];
+        size_t count = std::min(kTaskSize, block.size() - begin);
+        pool.enqueue([first, count, &rulesConfig]() {
+            auto engineContext = std::make_shared<EngineContext>(rulesConfig, 0);
+            for (size_t i = 0; i < count; i++) {
+                validateSubmission(first[i], engineContext);
+            }
+        });
+    }
+    pool.waitForAll();
+
+    size_t rejectedCount = 0;
+    for (const auto& submission : block) {
+        const ReplayValidator::Result& result = submission.result;
+        if (result.isAccepted) {
+            printf("%s accept\n", submission.submissionId.c_str());
+            continue;
+        }
+
+        rejectedCount++;
+        if (result.failedMoveIndex >= 0) {
+            printf("%s reject %d %s\n", submission.submissionId.c_str(), result.failedMoveIndex, result.reason.c_str());
+        } else {
+            printf("%s reject - %s\n", submission.submissionId.c_str(), result.reason.c_str());
+        }
+    }
+    fflush(stdout);
+    return rejectedCount;
+}
+
+int main(int argc, char** argv) {
+    int threadCount = 0;
+    std::string levelDirectory;
+    std::string rulesPath;
+    std::string batchPath = "-";
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) {
+            threadCount = atoi(argv[++i]);
+        } else if (arg == "--levels" && i + 1 < argc) {
+            levelDirectory = argv[++i];
+        } else if (arg == "--rules" && i + 1 < argc) {
+            rulesPath = argv[++i];
+        } else {
+            batchPath = arg;
+        }
+    }
+
+    if (levelDirectory.empty()) {
+        fprintf(stderr, "Usage: %s [--threads N] [--rules game_rules.json] --levels <directory> [batch.txt|-]\n", argv[0]);
+        return 2;
+    }
+
+    std::shared_ptr<const GameRulesConfig> rulesConfig = std::make_shared<GameRulesConfig>();
+    if (!rulesPath.empty()) {
+        rulesConfig = loadGameRulesConfig(rulesPath);
+        if (!rulesConfig) {
+            fprintf(stderr, "error: %s: Failed to load game rules\n", rulesPath.c_str());
+            return 2;
+        }
+    }
+
+    std::ifstream batchFile;
+    if (batchPath != "-") {
+        batchFile.open(batchPath.c_str());
+        if (!batchFile) {
+            fprintf(stderr, "error: %s: Failed to read file\n", batchPath.c_str());
+            return 2;
+        }
+    }
+    std::istream& input = batchPath == "-" ? std::cin : batchFile;
+
+    LevelCache levels(levelDirectory);
+    ThreadPool pool(threadCount);
+    std::vector<Submission> block;
+    block.reserve(kBlockSize);
+
+    size_t submissionCount = 0;
+    size_t rejectedCount = 0;
+    size_t lineNumber = 0;
+    std::string line;
+    while (std::getline(input, line)) {
+        lineNumber++;
+        Submission submission;
+        if (!parseLine(line, lineNumber, levels, submission)) {
+            continue;
+        }
+
+        block.push_back(std::move(submission));
+        if (block.size() == kBlockSize) {
+            submissionCount += block.size();
+            rejectedCount += processBlock(block, pool, rulesConfig);
+            block.clear();
+        }
+    }
+    if (!block.empty()) {
+        submissionCount += block.size();
+        rejectedCount += processBlock(block, pool, rulesConfig);
+    }
+
+    fprintf(stderr, "%zu submissions, %zu accepted, %zu rejected\n",
+            submissionCount, submissionCount - rejectedCount, rejectedCount);
+
+    return rejectedCount > 0 ? 1 : 0;
+}